@@ -0,0 +1,566 @@
+/*
+ * Linux io_uring support.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+#include "qemu/osdep.h"
+#include <liburing.h>
+#include "qemu-common.h"
+#include "block/aio.h"
+#include "qemu/queue.h"
+#include "block/block.h"
+#include "block/raw-aio.h"
+#include "qemu/coroutine.h"
+#include "qapi/error.h"
+#include "exec/cpu-common.h"
+#include "exec/ramlist.h"
+#include "trace.h"
+
+/* io_uring ring size */
+#define MAX_ENTRIES 128
+
+/* The kernel limits a single registered buffer to 1 GiB and the number of
+ * registered buffers to UIO_MAXIOV.
+ */
+#define MAX_FIXED_BUF_SIZE (1ULL << 30)
+#define MAX_FIXED_BUFS 1024
+
+typedef struct LuringAIOCB {
+    Coroutine *co;
+    struct io_uring_sqe sqeq;
+    ssize_t ret;
+    QEMUIOVector *qiov;
+    bool is_read;
+    QSIMPLEQ_ENTRY(LuringAIOCB) next;
+
+    /* Buffered reads may complete short and are then resubmitted for the
+     * remainder, see luring_resubmit_short_read().
+     */
+    int total_read;
+    QEMUIOVector resubmit_qiov;
+} LuringAIOCB;
+
+typedef struct LuringQueue {
+    int plugged;
+    unsigned int in_queue;
+    unsigned int in_flight;
+    bool blocked;
+    QSIMPLEQ_HEAD(, LuringAIOCB) submit_queue;
+} LuringQueue;
+
+struct LuringState {
+    AioContext *aio_context;
+
+    struct io_uring ring;
+
+    /* io queue for submit at batch.  Protected by AioContext lock. */
+    LuringQueue io_q;
+
+    /* I/O completion processing.  Only runs in I/O thread.  */
+    QEMUBH *completion_bh;
+
+    /* Guest RAM registered with the ring as fixed buffers, so that the
+     * kernel does not need to map the pages for every request.  The RAM
+     * blocks are tracked in @ram_regions; @fixed_bufs is what is currently
+     * registered, split into chunks the kernel accepts.  Protected by
+     * AioContext lock.
+     */
+    bool register_ram;
+    RAMBlockNotifier ram_notifier;
+    GArray *ram_regions;
+    struct iovec *fixed_bufs;
+    unsigned int nr_fixed_bufs;
+};
+
+static void ioq_submit(LuringState *s);
+
+static void luring_resubmit(LuringState *s, LuringAIOCB *luringcb)
+{
+    QSIMPLEQ_INSERT_TAIL(&s->io_q.submit_queue, luringcb, next);
+    s->io_q.in_queue++;
+}
+
+/*
+ * luring_resubmit_short_read()
+ *
+ * Short reads are rare but may occur, e.g. for buffered reads crossing the
+ * end of the page cache.  Submit a new request for the remaining bytes.
+ */
+static void luring_resubmit_short_read(LuringState *s, LuringAIOCB *luringcb,
+                                       int nread)
+{
+    QEMUIOVector *resubmit_qiov;
+    size_t remaining;
+
+    trace_luring_resubmit_short_read(s, luringcb, nread);
+
+    luringcb->total_read += nread;
+    remaining = luringcb->qiov->size - luringcb->total_read;
+    luringcb->sqeq.off += nread;
+
+    if (luringcb->sqeq.opcode == IORING_OP_READ_FIXED) {
+        /* Still one contiguous range inside the same fixed buffer */
+        luringcb->sqeq.addr += nread;
+        luringcb->sqeq.len = remaining;
+    } else {
+        resubmit_qiov = &luringcb->resubmit_qiov;
+        if (resubmit_qiov->iov == NULL) {
+            qemu_iovec_init(resubmit_qiov, luringcb->qiov->niov);
+        } else {
+            qemu_iovec_reset(resubmit_qiov);
+        }
+        qemu_iovec_concat(resubmit_qiov, luringcb->qiov,
+                          luringcb->total_read, remaining);
+
+        luringcb->sqeq.addr = (__u64)(uintptr_t)resubmit_qiov->iov;
+        luringcb->sqeq.len = resubmit_qiov->niov;
+    }
+
+    luring_resubmit(s, luringcb);
+}
+
+/*
+ * luring_process_completions()
+ *
+ * Reap all completed requests from the completion queue and wake up the
+ * coroutines waiting for them.
+ */
+static void luring_process_completions(LuringState *s)
+{
+    struct io_uring_cqe *cqe;
+
+    /*
+     * Request completion callbacks can run the nested event loop.
+     * Schedule ourselves so the nested event loop will "see" remaining
+     * completed requests and process them.  Without this, completion
+     * callbacks that wait for other requests using a nested event loop
+     * would hang forever.
+     */
+    qemu_bh_schedule(s->completion_bh);
+
+    while (io_uring_peek_cqe(&s->ring, &cqe) == 0 && cqe) {
+        LuringAIOCB *luringcb = io_uring_cqe_get_data(cqe);
+        int ret = cqe->res;
+        int total_bytes;
+
+        io_uring_cqe_seen(&s->ring, cqe);
+
+        /* Change counters one-by-one because we can be nested. */
+        s->io_q.in_flight--;
+
+        /* total_read is non-zero only for resubmitted read requests */
+        total_bytes = ret + luringcb->total_read;
+
+        if (ret < 0) {
+            if (ret == -EINTR) {
+                luring_resubmit(s, luringcb);
+                continue;
+            }
+        } else if (!luringcb->qiov) {
+            ret = 0;
+        } else if (total_bytes == luringcb->qiov->size) {
+            ret = 0;
+        } else if (luringcb->is_read) {
+            if (ret > 0) {
+                luring_resubmit_short_read(s, luringcb, ret);
+                continue;
+            }
+            /* Read past the end of the file: pad with zeroes */
+            qemu_iovec_memset(luringcb->qiov, total_bytes, 0,
+                              luringcb->qiov->size - total_bytes);
+            ret = 0;
+        } else {
+            ret = -ENOSPC;
+        }
+
+        luringcb->ret = ret;
+        qemu_iovec_destroy(&luringcb->resubmit_qiov);
+
+        /*
+         * If the coroutine is already entered it must be in ioq_submit()
+         * and will notice luringcb->ret has been filled in when it
+         * eventually runs later. Coroutines cannot be entered recursively
+         * so avoid doing that!
+         */
+        if (!qemu_coroutine_entered(luringcb->co)) {
+            aio_co_wake(luringcb->co);
+        }
+    }
+
+    qemu_bh_cancel(s->completion_bh);
+}
+
+static void luring_process_completions_and_submit(LuringState *s)
+{
+    aio_context_acquire(s->aio_context);
+    luring_process_completions(s);
+
+    if (!s->io_q.plugged && s->io_q.in_queue > 0) {
+        ioq_submit(s);
+    }
+    aio_context_release(s->aio_context);
+}
+
+static void qemu_luring_completion_bh(void *opaque)
+{
+    LuringState *s = opaque;
+
+    luring_process_completions_and_submit(s);
+}
+
+static void qemu_luring_completion_cb(void *opaque)
+{
+    LuringState *s = opaque;
+
+    luring_process_completions_and_submit(s);
+}
+
+static bool qemu_luring_poll_cb(void *opaque)
+{
+    LuringState *s = opaque;
+
+    if (!io_uring_cq_ready(&s->ring)) {
+        return false;
+    }
+
+    luring_process_completions_and_submit(s);
+    return true;
+}
+
+static void ioq_init(LuringQueue *io_q)
+{
+    QSIMPLEQ_INIT(&io_q->submit_queue);
+    io_q->plugged = 0;
+    io_q->in_queue = 0;
+    io_q->in_flight = 0;
+    io_q->blocked = false;
+}
+
+/*
+ * ioq_submit()
+ *
+ * Move as many queued requests as fit into the submission queue and hand
+ * them to the kernel with a single io_uring_enter() call.
+ */
+static void ioq_submit(LuringState *s)
+{
+    LuringAIOCB *luringcb, *luringcb_next;
+    int ret;
+
+    while (s->io_q.in_queue > 0) {
+        QSIMPLEQ_FOREACH_SAFE(luringcb, &s->io_q.submit_queue, next,
+                              luringcb_next) {
+            struct io_uring_sqe *sqe = io_uring_get_sqe(&s->ring);
+            if (!sqe) {
+                break;
+            }
+            *sqe = luringcb->sqeq;
+            QSIMPLEQ_REMOVE_HEAD(&s->io_q.submit_queue, next);
+        }
+
+        ret = io_uring_submit(&s->ring);
+        trace_luring_io_uring_submit(s, ret);
+        if (ret == -EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            /* -EAGAIN/-EBUSY: retry once some requests have completed */
+            break;
+        }
+
+        s->io_q.in_flight += ret;
+        s->io_q.in_queue -= ret;
+    }
+    s->io_q.blocked = (s->io_q.in_queue > 0);
+
+    if (s->io_q.in_flight) {
+        /* We can try to complete something just right away if there are
+         * still requests in-flight.
+         */
+        luring_process_completions(s);
+    }
+}
+
+void luring_io_plug(BlockDriverState *bs, LuringState *s)
+{
+    assert(s);
+    s->io_q.plugged++;
+}
+
+void luring_io_unplug(BlockDriverState *bs, LuringState *s)
+{
+    assert(s->io_q.plugged);
+    if (--s->io_q.plugged == 0 &&
+        !s->io_q.blocked && s->io_q.in_queue > 0) {
+        ioq_submit(s);
+    }
+}
+
+/*
+ * luring_fixed_buf_index()
+ *
+ * Return the index of the registered buffer that contains all of @qiov, or
+ * -1 if @qiov is not a single range of registered guest RAM.
+ */
+static int luring_fixed_buf_index(LuringState *s, QEMUIOVector *qiov)
+{
+    uintptr_t base, end;
+    unsigned int i;
+
+    if (qiov->niov != 1 || !s->nr_fixed_bufs) {
+        return -1;
+    }
+
+    base = (uintptr_t)qiov->iov[0].iov_base;
+    end = base + qiov->iov[0].iov_len;
+    for (i = 0; i < s->nr_fixed_bufs; i++) {
+        uintptr_t buf = (uintptr_t)s->fixed_bufs[i].iov_base;
+
+        if (base >= buf && end <= buf + s->fixed_bufs[i].iov_len) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int luring_do_submit(int fd, LuringAIOCB *luringcb, LuringState *s,
+                            uint64_t offset, int type)
+{
+    struct io_uring_sqe *sqe = &luringcb->sqeq;
+    QEMUIOVector *qiov = luringcb->qiov;
+    int buf_index = luring_fixed_buf_index(s, qiov);
+
+    switch (type) {
+    case QEMU_AIO_WRITE:
+        if (buf_index >= 0) {
+            io_uring_prep_write_fixed(sqe, fd, qiov->iov[0].iov_base,
+                                      qiov->iov[0].iov_len, offset,
+                                      buf_index);
+        } else {
+            io_uring_prep_writev(sqe, fd, qiov->iov, qiov->niov, offset);
+        }
+        break;
+    case QEMU_AIO_READ:
+        if (buf_index >= 0) {
+            io_uring_prep_read_fixed(sqe, fd, qiov->iov[0].iov_base,
+                                     qiov->iov[0].iov_len, offset,
+                                     buf_index);
+        } else {
+            io_uring_prep_readv(sqe, fd, qiov->iov, qiov->niov, offset);
+        }
+        break;
+    default:
+        fprintf(stderr, "%s: invalid AIO request type 0x%x.\n",
+                        __func__, type);
+        return -EIO;
+    }
+    io_uring_sqe_set_data(sqe, luringcb);
+
+    QSIMPLEQ_INSERT_TAIL(&s->io_q.submit_queue, luringcb, next);
+    s->io_q.in_queue++;
+    if (!s->io_q.blocked &&
+        (!s->io_q.plugged ||
+         s->io_q.in_flight + s->io_q.in_queue >= MAX_ENTRIES)) {
+        ioq_submit(s);
+    }
+
+    return 0;
+}
+
+int coroutine_fn luring_co_submit(BlockDriverState *bs, LuringState *s, int fd,
+                                  uint64_t offset, QEMUIOVector *qiov,
+                                  int type)
+{
+    int ret;
+    LuringAIOCB luringcb = {
+        .co         = qemu_coroutine_self(),
+        .ret        = -EINPROGRESS,
+        .qiov       = qiov,
+        .is_read    = (type == QEMU_AIO_READ),
+    };
+
+    ret = luring_do_submit(fd, &luringcb, s, offset, type);
+    if (ret < 0) {
+        return ret;
+    }
+
+    if (luringcb.ret == -EINPROGRESS) {
+        qemu_coroutine_yield();
+    }
+    return luringcb.ret;
+}
+
+/*
+ * luring_update_fixed_bufs()
+ *
+ * Replace the registered buffers of the ring with the current set of guest
+ * RAM blocks.  Registration pins the memory, so it may fail because of
+ * RLIMIT_MEMLOCK; requests then simply use the vectored opcodes.
+ */
+static void luring_update_fixed_bufs(LuringState *s)
+{
+    GArray *bufs = g_array_new(false, false, sizeof(struct iovec));
+    unsigned int i;
+    int ret;
+
+    for (i = 0; i < s->ram_regions->len; i++) {
+        struct iovec *region = &g_array_index(s->ram_regions, struct iovec, i);
+        uint8_t *host = region->iov_base;
+        size_t size = region->iov_len;
+
+        while (size > 0) {
+            struct iovec chunk = {
+                .iov_base = host,
+                .iov_len = MIN(size, MAX_FIXED_BUF_SIZE),
+            };
+            g_array_append_val(bufs, chunk);
+            host += chunk.iov_len;
+            size -= chunk.iov_len;
+        }
+    }
+
+    if (s->nr_fixed_bufs) {
+        io_uring_unregister_buffers(&s->ring);
+        g_free(s->fixed_bufs);
+        s->fixed_bufs = NULL;
+        s->nr_fixed_bufs = 0;
+    }
+
+    if (bufs->len == 0 || bufs->len > MAX_FIXED_BUFS) {
+        g_array_free(bufs, true);
+        return;
+    }
+
+    ret = io_uring_register_buffers(&s->ring, (struct iovec *)bufs->data,
+                                    bufs->len);
+    trace_luring_register_buffers(s, bufs->len, ret);
+    if (ret < 0) {
+        g_array_free(bufs, true);
+        return;
+    }
+
+    s->nr_fixed_bufs = bufs->len;
+    s->fixed_bufs = (struct iovec *)g_array_free(bufs, false);
+}
+
+static void luring_add_ram_region(LuringState *s, void *host, size_t size)
+{
+    struct iovec region = {
+        .iov_base = host,
+        .iov_len = size,
+    };
+
+    if (host && size) {
+        g_array_append_val(s->ram_regions, region);
+    }
+}
+
+static int luring_ram_block_found(const char *block_name, void *host_addr,
+                                  ram_addr_t offset, ram_addr_t length,
+                                  void *opaque)
+{
+    luring_add_ram_region(opaque, host_addr, length);
+    return 0;
+}
+
+static void luring_ram_block_added(RAMBlockNotifier *n, void *host,
+                                   size_t size)
+{
+    LuringState *s = container_of(n, LuringState, ram_notifier);
+
+    aio_context_acquire(s->aio_context);
+    luring_add_ram_region(s, host, size);
+    luring_update_fixed_bufs(s);
+    aio_context_release(s->aio_context);
+}
+
+static void luring_ram_block_removed(RAMBlockNotifier *n, void *host,
+                                     size_t size)
+{
+    LuringState *s = container_of(n, LuringState, ram_notifier);
+    unsigned int i;
+
+    aio_context_acquire(s->aio_context);
+    for (i = 0; i < s->ram_regions->len; i++) {
+        if (g_array_index(s->ram_regions, struct iovec, i).iov_base == host) {
+            g_array_remove_index_fast(s->ram_regions, i);
+            break;
+        }
+    }
+    luring_update_fixed_bufs(s);
+    aio_context_release(s->aio_context);
+}
+
+/*
+ * luring_register_guest_ram()
+ *
+ * Register all guest RAM with the ring and keep the registration up to
+ * date as RAM blocks come and go.  Single-buffer requests into guest RAM
+ * then use IORING_OP_READ_FIXED/IORING_OP_WRITE_FIXED.  Must be called
+ * with the AioContext lock held.
+ */
+void luring_register_guest_ram(LuringState *s)
+{
+    if (s->register_ram) {
+        return;
+    }
+    s->register_ram = true;
+
+    qemu_ram_foreach_block(luring_ram_block_found, s);
+    luring_update_fixed_bufs(s);
+
+    s->ram_notifier.ram_block_added = luring_ram_block_added;
+    s->ram_notifier.ram_block_removed = luring_ram_block_removed;
+    ram_block_notifier_add(&s->ram_notifier);
+}
+
+void luring_detach_aio_context(LuringState *s, AioContext *old_context)
+{
+    aio_set_fd_handler(old_context, s->ring.ring_fd, false,
+                       NULL, NULL, NULL, NULL);
+    qemu_bh_delete(s->completion_bh);
+    s->aio_context = NULL;
+}
+
+void luring_attach_aio_context(LuringState *s, AioContext *new_context)
+{
+    s->aio_context = new_context;
+    s->completion_bh = aio_bh_new(new_context, qemu_luring_completion_bh, s);
+    aio_set_fd_handler(s->aio_context, s->ring.ring_fd, false,
+                       qemu_luring_completion_cb, NULL,
+                       qemu_luring_poll_cb, s);
+}
+
+LuringState *luring_init(Error **errp)
+{
+    int rc;
+    LuringState *s = g_new0(LuringState, 1);
+
+    trace_luring_init_state(s, sizeof(*s));
+
+    rc = io_uring_queue_init(MAX_ENTRIES, &s->ring, 0);
+    if (rc < 0) {
+        error_setg_errno(errp, -rc, "failed to init linux io_uring ring");
+        g_free(s);
+        return NULL;
+    }
+
+    ioq_init(&s->io_q);
+    s->ram_regions = g_array_new(false, false, sizeof(struct iovec));
+
+    return s;
+}
+
+void luring_cleanup(LuringState *s)
+{
+    if (s->register_ram) {
+        ram_block_notifier_remove(&s->ram_notifier);
+    }
+    /* Tearing down the ring also drops the registered buffers */
+    io_uring_queue_exit(&s->ring);
+    g_array_free(s->ram_regions, true);
+    g_free(s->fixed_bufs);
+    g_free(s);
+}
@@ -0,0 +1,287 @@
+/*
+ * Threaded data processing for the QCOW2 format: cluster compression
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "qemu/osdep.h"
+#include <zlib.h>
+#ifdef CONFIG_ZSTD
+#include <zstd.h>
+#include <zstd_errors.h>
+#endif
+
+#include "block/block_int.h"
+#include "block/thread-pool.h"
+#include "qemu-common.h"
+#include "qcow2.h"
+
+#define QCOW2_ZSTD_LEVEL 3
+
+typedef ssize_t (*Qcow2CompressFunc)(void *dest, size_t dest_size,
+                                     const void *src, size_t src_size);
+
+typedef struct Qcow2CompressData {
+    void *dest;
+    size_t dest_size;
+    const void *src;
+    size_t src_size;
+    ssize_t ret;
+
+    Qcow2CompressFunc func;
+} Qcow2CompressData;
+
+/*
+ * qcow2_zlib_compress()
+ *
+ * Compress @src_size bytes of @src into @dest as a raw deflate stream
+ * (best compression, small window, no zlib header).
+ *
+ * Returns the compressed size on success, -ENOMEM if the result does not
+ * fit into @dest_size bytes and -EIO on any other error.
+ */
+static ssize_t qcow2_zlib_compress(void *dest, size_t dest_size,
+                                   const void *src, size_t src_size)
+{
+    ssize_t ret;
+    z_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                       -12, 9, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        return -EIO;
+    }
+
+    strm.avail_in = src_size;
+    strm.next_in = (uint8_t *) src;
+    strm.avail_out = dest_size;
+    strm.next_out = dest;
+
+    ret = deflate(&strm, Z_FINISH);
+    if (ret == Z_STREAM_END) {
+        ret = dest_size - strm.avail_out;
+    } else {
+        ret = (ret == Z_OK ? -ENOMEM : -EIO);
+    }
+
+    deflateEnd(&strm);
+
+    return ret;
+}
+
+/*
+ * qcow2_zlib_decompress()
+ *
+ * Decompress a raw deflate stream from @src into exactly @dest_size bytes
+ * of @dest. @src may contain trailing padding after the stream.
+ *
+ * Returns 0 on success and -EIO on error.
+ */
+static ssize_t qcow2_zlib_decompress(void *dest, size_t dest_size,
+                                     const void *src, size_t src_size)
+{
+    int ret;
+    z_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+    strm.avail_in = src_size;
+    strm.next_in = (uint8_t *) src;
+    strm.avail_out = dest_size;
+    strm.next_out = dest;
+
+    ret = inflateInit2(&strm, -12);
+    if (ret != Z_OK) {
+        return -EIO;
+    }
+
+    ret = inflate(&strm, Z_FINISH);
+    if ((ret != Z_STREAM_END && ret != Z_BUF_ERROR) || strm.avail_out != 0) {
+        /* We approve Z_BUF_ERROR because we need @dest buffer to be filled,
+         * but @src buffer may be processed partly (because in qcow2 we
+         * know size of compressed data with precision of one sector) */
+        ret = -EIO;
+    } else {
+        ret = 0;
+    }
+
+    inflateEnd(&strm);
+
+    return ret;
+}
+
+#ifdef CONFIG_ZSTD
+
+/*
+ * qcow2_zstd_compress()
+ *
+ * Compress @src_size bytes of @src into @dest as a single zstd frame.
+ *
+ * Returns the compressed size on success, -ENOMEM if the result does not
+ * fit into @dest_size bytes and -EIO on any other error.
+ */
+static ssize_t qcow2_zstd_compress(void *dest, size_t dest_size,
+                                   const void *src, size_t src_size)
+{
+    size_t ret;
+
+    ret = ZSTD_compress(dest, dest_size, src, src_size, QCOW2_ZSTD_LEVEL);
+    if (ZSTD_isError(ret)) {
+        if (ZSTD_getErrorCode(ret) == ZSTD_error_dstSize_tooSmall) {
+            return -ENOMEM;
+        }
+        return -EIO;
+    }
+
+    return ret;
+}
+
+/*
+ * qcow2_zstd_decompress()
+ *
+ * Decompress a zstd frame from @src into exactly @dest_size bytes of
+ * @dest. The frame is decoded as a stream because @src is rounded up to
+ * whole sectors and may carry padding behind the end of the frame.
+ *
+ * Returns 0 on success and -EIO on error.
+ */
+static ssize_t qcow2_zstd_decompress(void *dest, size_t dest_size,
+                                     const void *src, size_t src_size)
+{
+    ZSTD_DStream *dstream;
+    ZSTD_inBuffer input = { src, src_size, 0 };
+    ZSTD_outBuffer output = { dest, dest_size, 0 };
+    ssize_t ret = 0;
+    size_t zret;
+
+    dstream = ZSTD_createDStream();
+    if (!dstream) {
+        return -EIO;
+    }
+    zret = ZSTD_initDStream(dstream);
+    if (ZSTD_isError(zret)) {
+        ret = -EIO;
+        goto out;
+    }
+
+    while (output.pos < output.size) {
+        zret = ZSTD_decompressStream(dstream, &output, &input);
+        if (ZSTD_isError(zret)) {
+            ret = -EIO;
+            break;
+        }
+        if (zret == 0 || input.pos == input.size) {
+            /* end of frame, or no more input to make progress with */
+            break;
+        }
+    }
+
+    if (ret == 0 && output.pos != output.size) {
+        ret = -EIO;
+    }
+
+out:
+    ZSTD_freeDStream(dstream);
+    return ret;
+}
+
+#endif
+
+static int qcow2_compress_pool_func(void *opaque)
+{
+    Qcow2CompressData *data = opaque;
+
+    data->ret = data->func(data->dest, data->dest_size,
+                           data->src, data->src_size);
+
+    return 0;
+}
+
+/*
+ * qcow2_co_compress()
+ *
+ * Compress one cluster with the image's compression type on a worker of
+ * the AioContext's thread pool, so that several clusters can be
+ * compressed at once. At most QCOW2_MAX_THREADS requests per image are
+ * handed to the pool at a time; the others wait for a free slot.
+ *
+ * Returns the compressed size on success, -ENOMEM if the data does not
+ * compress into @dest_size bytes and another negative errno on error.
+ */
+ssize_t coroutine_fn qcow2_co_compress(BlockDriverState *bs,
+                                       void *dest, size_t dest_size,
+                                       const void *src, size_t src_size)
+{
+    BDRVQcow2State *s = bs->opaque;
+    ThreadPool *pool = aio_get_thread_pool(bdrv_get_aio_context(bs));
+    Qcow2CompressData arg = {
+        .dest = dest,
+        .dest_size = dest_size,
+        .src = src,
+        .src_size = src_size,
+    };
+
+    switch (s->compression_type) {
+    case QCOW2_COMPRESSION_TYPE_ZLIB:
+        arg.func = qcow2_zlib_compress;
+        break;
+#ifdef CONFIG_ZSTD
+    case QCOW2_COMPRESSION_TYPE_ZSTD:
+        arg.func = qcow2_zstd_compress;
+        break;
+#endif
+    default:
+        return -ENOTSUP;
+    }
+
+    while (s->nb_compress_threads >= QCOW2_MAX_THREADS) {
+        qemu_co_queue_wait(&s->compress_wait_queue, NULL);
+    }
+
+    s->nb_compress_threads++;
+    thread_pool_submit_co(pool, qcow2_compress_pool_func, &arg);
+    s->nb_compress_threads--;
+
+    qemu_co_queue_next(&s->compress_wait_queue);
+
+    return arg.ret;
+}
+
+/*
+ * qcow2_decompress()
+ *
+ * Decompress the data of one compressed cluster from @src into exactly
+ * @dest_size bytes of @dest, using the image's compression type.
+ *
+ * Returns 0 on success and a negative errno on error.
+ */
+int qcow2_decompress(BDRVQcow2State *s, void *dest, size_t dest_size,
+                     const void *src, size_t src_size)
+{
+    switch (s->compression_type) {
+    case QCOW2_COMPRESSION_TYPE_ZLIB:
+        return qcow2_zlib_decompress(dest, dest_size, src, src_size);
+#ifdef CONFIG_ZSTD
+    case QCOW2_COMPRESSION_TYPE_ZSTD:
+        return qcow2_zstd_decompress(dest, dest_size, src, src_size);
+#endif
+    default:
+        return -ENOTSUP;
+    }
+}
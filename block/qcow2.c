@@ -25,7 +25,6 @@
 #include "block/block_int.h"
 #include "sysemu/block-backend.h"
 #include "qemu/module.h"
-#include <zlib.h>
 #include "block/qcow2.h"
 #include "qemu/error-report.h"
 #include "qapi/qmp/qerror.h"
@@ -451,6 +450,11 @@ static QemuOptsList qcow2_runtime_opts = {
             .type = QEMU_OPT_SIZE,
             .help = "Maximum L2 table cache size",
         },
+        {
+            .name = QCOW2_OPT_L2_CACHE_ENTRY_SIZE,
+            .type = QEMU_OPT_SIZE,
+            .help = "Size of each entry in the L2 cache",
+        },
         {
             .name = QCOW2_OPT_REFCOUNT_CACHE_SIZE,
             .type = QEMU_OPT_SIZE,
@@ -581,6 +585,7 @@ static void read_cache_sizes(BlockDriverState *bs, QemuOpts *opts,
 typedef struct Qcow2ReopenState {
     Qcow2Cache *l2_table_cache;
     Qcow2Cache *refcount_block_cache;
+    int l2_slice_size; /* Number of entries in a slice of the L2 table */
     bool use_lazy_refcounts;
     int overlap_check;
     bool discard_passthrough[QCOW2_DISCARD_MAX];
@@ -596,7 +601,7 @@ static int qcow2_update_options_prepare(BlockDriverState *bs,
     QemuOpts *opts = NULL;
     const char *opt_overlap_check, *opt_overlap_check_template;
     int overlap_check_template = 0;
-    uint64_t l2_cache_size, refcount_cache_size;
+    uint64_t l2_cache_size, l2_cache_entry_size, refcount_cache_size;
     int i;
     Error *local_err = NULL;
     int ret;
@@ -618,7 +623,23 @@ static int qcow2_update_options_prepare(BlockDriverState *bs,
         goto fail;
     }
 
-    l2_cache_size /= s->cluster_size;
+    /* Caching L2 tables in slices smaller than a cluster lets the same
+     * amount of memory cover more of a large image under random I/O. */
+    l2_cache_entry_size = qemu_opt_get_size(opts,
+                                            QCOW2_OPT_L2_CACHE_ENTRY_SIZE,
+                                            s->cluster_size);
+    if (l2_cache_entry_size < (1 << MIN_CLUSTER_BITS) ||
+        l2_cache_entry_size > s->cluster_size ||
+        !is_power_of_2(l2_cache_entry_size)) {
+        error_setg(errp, "L2 cache entry size must be a power of two "
+                   "between %d and the cluster size (%d)",
+                   1 << MIN_CLUSTER_BITS, s->cluster_size);
+        ret = -EINVAL;
+        goto fail;
+    }
+    r->l2_slice_size = l2_cache_entry_size / sizeof(uint64_t);
+
+    l2_cache_size /= l2_cache_entry_size;
     if (l2_cache_size < MIN_L2_CACHE_SIZE) {
         l2_cache_size = MIN_L2_CACHE_SIZE;
     }
@@ -656,8 +677,10 @@ static int qcow2_update_options_prepare(BlockDriverState *bs,
         }
     }
 
-    r->l2_table_cache = qcow2_cache_create(bs, l2_cache_size);
-    r->refcount_block_cache = qcow2_cache_create(bs, refcount_cache_size);
+    r->l2_table_cache = qcow2_cache_create(bs, l2_cache_size,
+                                           l2_cache_entry_size);
+    r->refcount_block_cache = qcow2_cache_create(bs, refcount_cache_size,
+                                                 s->cluster_size);
     if (r->l2_table_cache == NULL || r->refcount_block_cache == NULL) {
         error_setg(errp, "Could not allocate metadata caches");
         ret = -ENOMEM;
@@ -772,6 +795,7 @@ static void qcow2_update_options_commit(BlockDriverState *bs,
     }
     s->l2_table_cache = r->l2_table_cache;
     s->refcount_block_cache = r->refcount_block_cache;
+    s->l2_slice_size = r->l2_slice_size;
 
     s->overlap_check = r->overlap_check;
     s->use_lazy_refcounts = r->use_lazy_refcounts;
@@ -897,6 +921,11 @@ static int qcow2_do_open(BlockDriverState *bs, QDict *options, int flags,
         goto fail;
     }
 
+    /* The bytes read beyond a shorter header belong to header extensions */
+    if (header.header_length <= offsetof(QCowHeader, compression_type)) {
+        header.compression_type = QCOW2_COMPRESSION_TYPE_ZLIB;
+    }
+
     if (header.header_length > sizeof(header)) {
         s->unknown_header_fields_size = header.header_length - sizeof(header);
         s->unknown_header_fields = g_malloc(s->unknown_header_fields_size);
@@ -938,6 +967,28 @@ static int qcow2_do_open(BlockDriverState *bs, QDict *options, int flags,
         goto fail;
     }
 
+    /* Initialise compression type */
+    if (!!header.compression_type !=
+        !!(s->incompatible_features & QCOW2_INCOMPAT_COMPRESSION)) {
+        error_setg(errp, "qcow2: Compression type field does not match the "
+                   "compression type incompatible feature bit");
+        ret = -EINVAL;
+        goto fail;
+    }
+    switch (header.compression_type) {
+    case QCOW2_COMPRESSION_TYPE_ZLIB:
+#ifdef CONFIG_ZSTD
+    case QCOW2_COMPRESSION_TYPE_ZSTD:
+#endif
+        s->compression_type = header.compression_type;
+        break;
+    default:
+        error_setg(errp, "qcow2: Unsupported compression type %u",
+                   header.compression_type);
+        ret = -ENOTSUP;
+        goto fail;
+    }
+
     if (s->incompatible_features & QCOW2_INCOMPAT_CORRUPT) {
         /* Corrupt images may not be written to unless they are being repaired
          */
@@ -1163,6 +1214,8 @@ static int qcow2_do_open(BlockDriverState *bs, QDict *options, int flags,
 
     /* Initialise locks */
     qemu_co_mutex_init(&s->lock);
+    qemu_co_queue_init(&s->compress_wait_queue);
+    qemu_co_queue_init(&s->compress_order_queue);
     bs->supported_zero_flags = BDRV_REQ_MAY_UNMAP;
 
     /* Repair image if dirty */
@@ -1835,6 +1888,20 @@ static size_t header_ext_add(char *buf, uint32_t magic, const void *s,
     return ext_len;
 }
 
+/*
+ * Length of the fixed part of a version 3 header. The compression type
+ * field is only written when it is needed, so that images using zlib keep
+ * the 104 byte header older versions create.
+ */
+static size_t qcow2_header_length(BDRVQcow2State *s)
+{
+    if (s->compression_type != QCOW2_COMPRESSION_TYPE_ZLIB ||
+        s->unknown_header_fields_size) {
+        return sizeof(QCowHeader);
+    }
+    return offsetof(QCowHeader, compression_type);
+}
+
 /*
  * Updates the qcow2 header, including the variable length parts of it, i.e.
  * the backing file name and all extensions. qcow2 was not designed to allow
@@ -1865,7 +1932,7 @@ int qcow2_update_header(BlockDriverState *bs)
         goto fail;
     }
 
-    header_length = sizeof(*header) + s->unknown_header_fields_size;
+    header_length = qcow2_header_length(s) + s->unknown_header_fields_size;
     total_size = bs->total_sectors * BDRV_SECTOR_SIZE;
     refcount_table_clusters = s->refcount_table_size >> (s->cluster_bits - 3);
 
@@ -1891,6 +1958,7 @@ int qcow2_update_header(BlockDriverState *bs)
         .autoclear_features     = cpu_to_be64(s->autoclear_features),
         .refcount_order         = cpu_to_be32(s->refcount_order),
         .header_length          = cpu_to_be32(header_length),
+        .compression_type       = s->compression_type,
     };
 
     /* For older versions, write a shorter header */
@@ -1899,7 +1967,7 @@ int qcow2_update_header(BlockDriverState *bs)
         ret = offsetof(QCowHeader, incompatible_features);
         break;
     case 3:
-        ret = sizeof(*header);
+        ret = qcow2_header_length(s);
         break;
     default:
         ret = -EINVAL;
@@ -1949,6 +2017,11 @@ int qcow2_update_header(BlockDriverState *bs)
                 .bit  = QCOW2_INCOMPAT_CORRUPT_BITNR,
                 .name = "corrupt bit",
             },
+            {
+                .type = QCOW2_FEAT_TYPE_INCOMPATIBLE,
+                .bit  = QCOW2_INCOMPAT_COMPRESSION_BITNR,
+                .name = "compression type",
+            },
             {
                 .type = QCOW2_FEAT_TYPE_COMPATIBLE,
                 .bit  = QCOW2_COMPAT_LAZY_REFCOUNTS_BITNR,
@@ -2099,7 +2172,7 @@ static int qcow2_create2(const char *filename, int64_t total_size,
                          const char *backing_file, const char *backing_format,
                          int flags, size_t cluster_size, PreallocMode prealloc,
                          QemuOpts *opts, int version, int refcount_order,
-                         Error **errp)
+                         Qcow2CompressionType compression_type, Error **errp)
 {
     int cluster_bits;
     QDict *options;
@@ -2225,8 +2298,18 @@ static int qcow2_create2(const char *filename, int64_t total_size,
         .refcount_table_clusters    = cpu_to_be32(1),
         .refcount_order             = cpu_to_be32(refcount_order),
         .header_length              = cpu_to_be32(sizeof(*header)),
+        .compression_type           = compression_type,
     };
 
+    if (compression_type == QCOW2_COMPRESSION_TYPE_ZLIB) {
+        /* Keep the header older versions create */
+        header->header_length =
+            cpu_to_be32(offsetof(QCowHeader, compression_type));
+    } else {
+        header->incompatible_features |=
+            cpu_to_be64(QCOW2_INCOMPAT_COMPRESSION);
+    }
+
     if (flags & BLOCK_FLAG_ENCRYPT) {
         header->crypt_method = cpu_to_be32(QCOW_CRYPT_AES);
     } else {
@@ -2356,6 +2439,7 @@ static int qcow2_create(const char *filename, QemuOpts *opts, Error **errp)
     int version = 3;
     uint64_t refcount_bits = 16;
     int refcount_order;
+    Qcow2CompressionType compression_type = QCOW2_COMPRESSION_TYPE_ZLIB;
     Error *local_err = NULL;
     int ret;
 
@@ -2429,9 +2513,37 @@ static int qcow2_create(const char *filename, QemuOpts *opts, Error **errp)
 
     refcount_order = ctz32(refcount_bits);
 
+    g_free(buf);
+    buf = qemu_opt_get_del(opts, BLOCK_OPT_COMPRESSION_TYPE);
+    compression_type = qapi_enum_parse(Qcow2CompressionType_lookup, buf,
+                                       QCOW2_COMPRESSION_TYPE__MAX,
+                                       QCOW2_COMPRESSION_TYPE_ZLIB,
+                                       &local_err);
+    if (local_err) {
+        error_propagate(errp, local_err);
+        ret = -EINVAL;
+        goto finish;
+    }
+
+#ifndef CONFIG_ZSTD
+    if (compression_type == QCOW2_COMPRESSION_TYPE_ZSTD) {
+        error_setg(errp, "zstd compression is not supported by this build");
+        ret = -ENOTSUP;
+        goto finish;
+    }
+#endif
+
+    if (version < 3 && compression_type != QCOW2_COMPRESSION_TYPE_ZLIB) {
+        error_setg(errp, "Non-zlib compression type is only supported with "
+                   "compatibility level 1.1 and above (use compat=1.1 or "
+                   "greater)");
+        ret = -EINVAL;
+        goto finish;
+    }
+
     ret = qcow2_create2(filename, size, backing_file, backing_fmt, flags,
                         cluster_size, prealloc, opts, version, refcount_order,
-                        &local_err);
+                        compression_type, &local_err);
     error_propagate(errp, local_err);
 
 finish:
@@ -2566,6 +2678,23 @@ static int qcow2_truncate(BlockDriverState *bs, int64_t offset)
     return 0;
 }
 
+/* Wait until all compressed writes submitted before @ticket have allocated
+ * their host clusters */
+static void coroutine_fn qcow2_compress_wait_turn(BDRVQcow2State *s,
+                                                  uint64_t ticket)
+{
+    while (s->compress_ticket_done != ticket) {
+        qemu_co_queue_wait(&s->compress_order_queue, NULL);
+    }
+}
+
+/* Let the next compressed write allocate its host clusters */
+static void coroutine_fn qcow2_compress_end_turn(BDRVQcow2State *s)
+{
+    s->compress_ticket_done++;
+    qemu_co_queue_restart_all(&s->compress_order_queue);
+}
+
 /* XXX: put compressed sectors first, then all the cluster aligned
    tables to avoid losing bytes in alignment */
 static coroutine_fn int
@@ -2575,10 +2704,11 @@ qcow2_co_pwritev_compressed(BlockDriverState *bs, uint64_t offset,
     BDRVQcow2State *s = bs->opaque;
     QEMUIOVector hd_qiov;
     struct iovec iov;
-    z_stream strm;
-    int ret, out_len;
+    int ret;
+    ssize_t out_len;
     uint8_t *buf, *out_buf;
     uint64_t cluster_offset;
+    uint64_t ticket;
 
     if (bytes == 0) {
         /* align end of file to a sector boundary to ease reading with
@@ -2602,38 +2732,28 @@ qcow2_co_pwritev_compressed(BlockDriverState *bs, uint64_t offset,
 
     out_buf = g_malloc(s->cluster_size);
 
-    /* best compression, small window, no zlib header */
-    memset(&strm, 0, sizeof(strm));
-    ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION,
-                       Z_DEFLATED, -12,
-                       9, Z_DEFAULT_STRATEGY);
-    if (ret != 0) {
-        ret = -EINVAL;
-        goto fail;
-    }
-
-    strm.avail_in = s->cluster_size;
-    strm.next_in = (uint8_t *)buf;
-    strm.avail_out = s->cluster_size;
-    strm.next_out = out_buf;
+    /* Compression runs concurrently for several requests, but host clusters
+     * are allocated in the order the requests came in, so the compressed
+     * data is laid out in the image just as a serial writer would do it */
+    ticket = s->compress_ticket_next++;
 
-    ret = deflate(&strm, Z_FINISH);
-    if (ret != Z_STREAM_END && ret != Z_OK) {
-        deflateEnd(&strm);
-        ret = -EINVAL;
-        goto fail;
-    }
-    out_len = strm.next_out - out_buf;
+    out_len = qcow2_co_compress(bs, out_buf, s->cluster_size - 1,
+                                buf, s->cluster_size);
 
-    deflateEnd(&strm);
+    qcow2_compress_wait_turn(s, ticket);
 
-    if (ret != Z_STREAM_END || out_len >= s->cluster_size) {
+    if (out_len == -ENOMEM) {
         /* could not compress: write normal cluster */
         ret = qcow2_co_pwritev(bs, offset, bytes, qiov, 0);
+        qcow2_compress_end_turn(s);
         if (ret < 0) {
             goto fail;
         }
         goto success;
+    } else if (out_len < 0) {
+        qcow2_compress_end_turn(s);
+        ret = -EINVAL;
+        goto fail;
     }
 
     qemu_co_mutex_lock(&s->lock);
@@ -2641,6 +2761,7 @@ qcow2_co_pwritev_compressed(BlockDriverState *bs, uint64_t offset,
         qcow2_alloc_compressed_cluster_offset(bs, offset, out_len);
     if (!cluster_offset) {
         qemu_co_mutex_unlock(&s->lock);
+        qcow2_compress_end_turn(s);
         ret = -EIO;
         goto fail;
     }
@@ -2648,6 +2769,7 @@ qcow2_co_pwritev_compressed(BlockDriverState *bs, uint64_t offset,
 
     ret = qcow2_pre_write_overlap_check(bs, 0, cluster_offset, out_len);
     qemu_co_mutex_unlock(&s->lock);
+    qcow2_compress_end_turn(s);
     if (ret < 0) {
         goto fail;
     }
@@ -2895,6 +3017,7 @@ static int qcow2_get_info(BlockDriverState *bs, BlockDriverInfo *bdi)
     bdi->can_write_zeroes_with_unmap = (s->qcow_version >= 3);
     bdi->cluster_size = s->cluster_size;
     bdi->vm_state_offset = qcow2_vm_state_offset(s);
+    bdi->ordered_compressed_writes = true;
     return 0;
 }
 
@@ -2922,6 +3045,9 @@ static ImageInfoSpecific *qcow2_get_specific_info(BlockDriverState *bs)
                                   QCOW2_INCOMPAT_CORRUPT,
             .has_corrupt        = true,
             .refcount_bits      = s->refcount_bits,
+            .compression_type   = s->compression_type,
+            .has_compression_type = s->compression_type !=
+                                    QCOW2_COMPRESSION_TYPE_ZLIB,
         };
     } else {
         /* if this assertion fails, this probably means a new version was
@@ -3180,6 +3306,15 @@ static int qcow2_amend_options(BlockDriverState *bs, QemuOpts *opts,
                              "not exceed 64 bits");
                 return -EINVAL;
             }
+        } else if (!strcmp(desc->name, BLOCK_OPT_COMPRESSION_TYPE)) {
+            const char *type = qemu_opt_get(opts, BLOCK_OPT_COMPRESSION_TYPE);
+
+            if (type && strcmp(type,
+                    Qcow2CompressionType_lookup[s->compression_type])) {
+                error_report("Changing the compression type is not "
+                             "supported");
+                return -ENOTSUP;
+            }
         } else {
             /* if this point is reached, this probably means a new option was
              * added without having it covered here */
@@ -3401,6 +3536,12 @@ static QemuOptsList qcow2_create_opts = {
             .help = "Width of a reference count entry in bits",
             .def_value_str = "16"
         },
+        {
+            .name = BLOCK_OPT_COMPRESSION_TYPE,
+            .type = QEMU_OPT_STRING,
+            .help = "Compression method used for image cluster compression "
+                    "(zlib, zstd)",
+        },
         { /* end of list */ }
     }
 };
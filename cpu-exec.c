@@ -27,6 +27,7 @@
 #include "qemu/timer.h"
 #include "exec/address-spaces.h"
 #include "qemu/rcu.h"
+#include "qemu/main-loop.h"
 #include "exec/tb-hash.h"
 #include "exec/log.h"
 #if defined(TARGET_I386) && !defined(CONFIG_USER_ONLY)
@@ -45,6 +46,16 @@ const int has_llvm_engine = 1;
 
 int generate_llvm = 0;
 int execute_llvm = 0;
+/* Run TBs as TCG code and move those dispatched tiered_llvm_threshold times
+   to optimized LLVM code compiled in the background. */
+int tiered_llvm = 0;
+uint32_t tiered_llvm_threshold = 0;
+/* Set while tb_tier_up translates a TB again: the front ends translate
+   exactly tb->icount instructions and leave rr state alone. */
+int tiered_llvm_lifting = 0;
+/* Number of profiled exits after which a TB is considered for superblock
+   formation; 0 disables superblocks. */
+uint32_t superblock_threshold = 0;
 extern bool panda_tb_chaining;
 
 extern bool panda_exit_loop;
@@ -194,7 +205,17 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
     if (execute_llvm) {
         assert(itb->llvm_tc_ptr);
         ret = tcg_llvm_qemu_tb_exec(env, itb);
+    } else if (tiered_llvm && atomic_read(&itb->llvm_tc_ptr)) {
+        /* Pairs with the release store in compileTieredFunction. */
+        smp_rmb();
+        ret = tcg_llvm_qemu_tb_exec(env, itb);
     } else {
+        if (tiered_llvm && !(itb->cflags & CF_NOCACHE) && !itb->invalid
+            && atomic_inc_fetch(&itb->llvm_exec_count) == tiered_llvm_threshold) {
+            tb_lock();
+            tb_tier_up(cpu, itb);
+            tb_unlock();
+        }
         assert(tb_ptr);
         ret = tcg_qemu_tb_exec(env, tb_ptr);
     }
@@ -378,6 +399,110 @@ static TranslationBlock *tb_htable_lookup(CPUState *cpu,
     return qht_lookup(&tcg_ctx.tb_ctx.htable, tb_cmp, &desc, h);
 }
 
+/* Returns the exit of @tb that was taken at least 7 times out of 8, or -1
+   if neither direction dominates. */
+static int tb_dominant_exit(TranslationBlock *tb)
+{
+    uint32_t total = tb->exit_count[0] + tb->exit_count[1];
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        if (total && tb->exit_count[i] >= total - total / 8) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Follow the dominant exits starting at @head and, if they lead anywhere,
+ * replace @head with a single TB translated along that path.  Only
+ * forward edges within the head's page are followed, so the trace cannot
+ * loop and the superblock is invalidated together with its code.  Called
+ * with mmap_lock and tb_lock held.
+ */
+static void tb_form_superblock(CPUState *cpu, TranslationBlock *head)
+{
+    TBTrace trace = { 0 };
+    TranslationBlock *cur = head;
+    target_ulong page = head->pc & TARGET_PAGE_MASK;
+
+    while (trace.nb_branches < TB_TRACE_MAX_BRANCHES) {
+        target_ulong fallthrough = cur->pc + cur->size;
+        target_ulong next;
+        int dir = tb_dominant_exit(cur);
+
+        if (dir < 0) {
+            break;
+        }
+        next = cur->exit_pc[dir];
+        if (next < fallthrough || (next & TARGET_PAGE_MASK) != page) {
+            break;
+        }
+        trace.branch[trace.nb_branches].fallthrough = fallthrough;
+        trace.branch[trace.nb_branches].taken = next != fallthrough;
+        trace.nb_branches++;
+
+        cur = tb_htable_lookup(cpu, next, head->cs_base, head->flags);
+        if (!cur || (cur->cflags & CF_SUPERBLOCK)) {
+            break;
+        }
+    }
+    if (trace.nb_branches == 0) {
+        return;
+    }
+
+    tb_phys_invalidate(head, -1);
+    tcg_ctx.tb_ctx.trace = &trace;
+    panda_callbacks_before_block_translate(cpu, head->pc);
+    cur = tb_gen_code(cpu, head->pc, head->cs_base, head->flags,
+                      CF_SUPERBLOCK);
+    panda_callbacks_after_block_translate(cpu, cur);
+    tcg_ctx.tb_ctx.trace = NULL;
+}
+
+/* Record that @last_tb left through @tb_exit to @pc, and form a superblock
+   from it once it has been profiled for long enough. */
+static void tb_profile_exit(CPUState *cpu, TranslationBlock *last_tb,
+                            int tb_exit, target_ulong pc,
+                            target_ulong cs_base, uint32_t flags)
+{
+    if ((last_tb->cflags & (CF_SUPERBLOCK | CF_NOCACHE)) || last_tb->invalid
+        || last_tb->cs_base != cs_base || last_tb->flags != flags
+        || use_icount || generate_llvm || execute_llvm) {
+        return;
+    }
+    last_tb->exit_pc[tb_exit] = pc;
+    if (++last_tb->exit_count[tb_exit] + last_tb->exit_count[tb_exit ^ 1]
+        == superblock_threshold) {
+        mmap_lock();
+        tb_lock();
+        tb_form_superblock(cpu, last_tb);
+        tb_unlock();
+        mmap_unlock();
+    }
+}
+
+/* TBs are left unchained until their exits have been profiled. */
+static inline bool tb_profile_done(TranslationBlock *tb)
+{
+    return !superblock_threshold || (tb->cflags & CF_SUPERBLOCK)
+        || tb->exit_count[0] + tb->exit_count[1] >= superblock_threshold;
+}
+
+/* In tiered mode nothing is chained to a TB while its dispatches are
+   still being counted, nor once its LLVM code is published, since that is
+   only entered from the cpu loop. */
+static inline bool tb_tier_chainable(TranslationBlock *tb)
+{
+#ifdef CONFIG_LLVM
+    return !tiered_llvm
+        || (atomic_read(&tb->llvm_exec_count) >= tiered_llvm_threshold
+            && !atomic_read(&tb->llvm_tc_ptr));
+#else
+    return true;
+#endif
+}
+
 static inline TranslationBlock *tb_find(CPUState *cpu,
                                         TranslationBlock *last_tb,
                                         int tb_exit)
@@ -392,6 +517,12 @@ static inline TranslationBlock *tb_find(CPUState *cpu,
        always be the same before a given translated block
        is executed. */
     cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
+    if (superblock_threshold && last_tb) {
+        tb_profile_exit(cpu, last_tb, tb_exit, pc, cs_base, flags);
+        if (last_tb->invalid) {
+            last_tb = NULL;
+        }
+    }
     tb = atomic_rcu_read(&cpu->tb_jmp_cache[tb_jmp_cache_hash_func(pc)]);
     if (unlikely(!tb || tb->pc != pc || tb->cs_base != cs_base ||
                  tb->flags != flags)) {
@@ -434,9 +565,10 @@ static inline TranslationBlock *tb_find(CPUState *cpu,
 #endif
     /* See if we can patch the calling TB. */
 #ifdef CONFIG_SOFTMMU
-    if (rr_mode != RR_REPLAY && panda_tb_chaining) { 
+    if (rr_mode != RR_REPLAY && panda_tb_chaining) {
 #endif
-    if (last_tb && !qemu_loglevel_mask(CPU_LOG_TB_NOCHAIN)) {
+    if (last_tb && !qemu_loglevel_mask(CPU_LOG_TB_NOCHAIN)
+        && tb_profile_done(last_tb) && tb_tier_chainable(tb)) {
         if (!have_tb_lock) {
             tb_lock();
             have_tb_lock = true;
@@ -490,6 +622,24 @@ static inline void cpu_handle_debug_exception(CPUState *cpu)
     cc->debug_excp_handler(cpu);
 }
 
+/* True if tb, translated earlier at another instruction count, starts at an
+ * rr breakpoint or reverse-debugging stop (see cpu_rr_next_stop) or would run
+ * past the next one. */
+static inline bool rr_stop_misses_tb(CPUState *cpu, TranslationBlock *tb)
+{
+    uint64_t icount;
+
+    if (likely(cpu->rr_breakpoints->len == 0 && cpu->reverse_flags == 0)) {
+        return false;
+    }
+    icount = rr_get_guest_instr_count();
+    if (cpu->rr_translated_instr == icount) {
+        return false;
+    }
+    return cpu_rr_next_stop(cpu, icount) == icount
+        || tb->icount > cpu_rr_next_stop(cpu, icount + 1) - icount;
+}
+
 static inline bool cpu_handle_exception(CPUState *cpu, int *ret)
 {
 
@@ -529,7 +679,16 @@ static inline bool cpu_handle_exception(CPUState *cpu, int *ret)
                 rr_exception_index_at(RR_CALLSITE_CPU_EXCEPTION_INDEX, &cpu->exception_index);
 #endif
                 CPUClass *cc = CPU_GET_CLASS(cpu);
+                bool locked = false;
+                /* MTTCG vCPUs run without the BQL */
+                if (!qemu_mutex_iothread_locked()) {
+                    qemu_mutex_lock_iothread();
+                    locked = true;
+                }
                 cc->do_interrupt(cpu);
+                if (locked) {
+                    qemu_mutex_unlock_iothread();
+                }
                 cpu->exception_index = -1;
             } else if (!replay_has_interrupt()) {
                 /* give a chance to iothread in replay mode */
@@ -551,8 +710,8 @@ static inline bool cpu_handle_exception(CPUState *cpu, int *ret)
     return false;
 }
 
-static inline bool cpu_handle_interrupt(CPUState *cpu,
-                                        TranslationBlock **last_tb)
+static inline bool cpu_handle_interrupt_locked(CPUState *cpu,
+                                               TranslationBlock **last_tb)
 {
     CPUClass *cc = CPU_GET_CLASS(cpu);
     int interrupt_request = cpu->interrupt_request;
@@ -643,6 +802,28 @@ static inline bool cpu_handle_interrupt(CPUState *cpu,
     return false;
 }
 
+static inline bool cpu_handle_interrupt(CPUState *cpu,
+                                        TranslationBlock **last_tb)
+{
+    bool locked = false;
+    bool ret;
+
+    /* MTTCG vCPUs run without the BQL, but interrupt delivery touches
+     * device state.  If the target hook longjmps out, cpu_exec() drops
+     * the lock again.
+     */
+    if (unlikely(atomic_read(&cpu->interrupt_request)) &&
+        !qemu_mutex_iothread_locked()) {
+        qemu_mutex_lock_iothread();
+        locked = true;
+    }
+    ret = cpu_handle_interrupt_locked(cpu, last_tb);
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
+    return ret;
+}
+
 static inline void cpu_loop_exec_tb(CPUState *cpu, TranslationBlock *tb,
                                     TranslationBlock **last_tb, int *tb_exit,
                                     SyncClocks *sc)
@@ -783,6 +964,9 @@ int cpu_exec(CPUState *cpu)
 #endif /* buggy compiler */
         cpu->can_do_io = 1;
         tb_lock_reset();
+        if (qemu_tcg_mttcg_enabled() && qemu_mutex_iothread_locked()) {
+            qemu_mutex_unlock_iothread();
+        }
     }
 
     /* if an exception is pending, we execute it here */
@@ -828,9 +1012,11 @@ int cpu_exec(CPUState *cpu)
             uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
             if (panda_invalidate_tb
                     || (rr_mode == RR_REPLAY && until_interrupt > 0
-                        && tb->icount > until_interrupt)) {
+                        && tb->icount > until_interrupt)
+                    || (rr_mode == RR_REPLAY && rr_stop_misses_tb(cpu, tb))) {
                 /* Retranslate so that basic block boundary matches
-                 * record & replay for interrupt delivery. */
+                 * record & replay for interrupt delivery, and so that
+                 * rr breakpoints fall on the start of a block. */
                 tb_lock();
                 tb_phys_invalidate(tb, -1);
                 tb_unlock();
@@ -31,6 +31,7 @@
 #include "exec/log.h"
 #include "exec/helper-proto.h"
 #include "qemu/atomic.h"
+#include "qemu/main-loop.h"
 
 #include "panda/rr/rr_log_all.h"
 #include "panda/rr/rr_log.h"
@@ -98,6 +99,191 @@ static void flush_all_helper(CPUState *src, run_on_cpu_func fn,
 /* statistics */
 int tlb_flush_count;
 
+#if TCG_TARGET_IMPLEMENTS_DYN_TLB
+/* Length, in flushes of the MMU index, of the window over which the TLB
+ * use rate is observed.  A wall-clock window would make the TLB size, and
+ * so which accesses fill the TLB and set guest page table A/D bits, depend
+ * on host timing.
+ */
+#define TLB_RESIZE_WINDOW_FLUSHES 128
+
+static inline void tlb_window_reset(CPUTLBDesc *desc, size_t max_entries)
+{
+    desc->window_begin_flush = desc->n_flushes;
+    desc->window_max_entries = max_entries;
+}
+
+static void tlb_alloc_mmuidx(CPUArchState *env, int mmu_idx, size_t n_entries)
+{
+    env->tlb_mask[mmu_idx] = (n_entries - 1) << CPU_TLB_ENTRY_BITS;
+    env->tlb_table[mmu_idx] = g_try_new(CPUTLBEntry, n_entries);
+    env->iotlb[mmu_idx] = g_try_new(CPUIOTLBEntry, n_entries);
+}
+
+static void tlb_free_mmuidx(CPUArchState *env, int mmu_idx)
+{
+    g_free(env->tlb_table[mmu_idx]);
+    g_free(env->iotlb[mmu_idx]);
+    env->tlb_table[mmu_idx] = NULL;
+    env->iotlb[mmu_idx] = NULL;
+}
+
+/* Resize the TLB of @mmu_idx, if needed, just before it is flushed.
+ *
+ * The use rate is the largest number of entries that were valid at any
+ * flush in the current window, relative to the TLB size.  A TLB more
+ * than 70% in use is doubled straight away, since misses are expensive;
+ * one that stayed below 30% for a whole window is shrunk so that the
+ * observed maximum would use it at most 70%.  Shrinking waits for the
+ * window so that a short burst of flushes does not throw away a TLB that
+ * a busy guest is about to refill.
+ */
+static void tlb_mmu_resize(CPUArchState *env, int mmu_idx)
+{
+    CPUTLBDesc *desc = &env->tlb_d[mmu_idx];
+    size_t old_size = tlb_n_entries(env, mmu_idx);
+    size_t new_size = old_size;
+    size_t rate;
+    bool window_expired;
+
+    desc->n_flushes++;
+    window_expired = desc->n_flushes - desc->window_begin_flush >
+                     TLB_RESIZE_WINDOW_FLUSHES;
+
+    if (desc->n_used_entries > desc->window_max_entries) {
+        desc->window_max_entries = desc->n_used_entries;
+    }
+    rate = desc->window_max_entries * 100 / old_size;
+
+    if (rate > 70) {
+        new_size = MIN(old_size << 1, 1 << CPU_TLB_DYN_MAX_BITS);
+    } else if (rate < 30 && window_expired) {
+        size_t ceil = pow2ceil(desc->window_max_entries);
+        size_t expected_rate = desc->window_max_entries * 100 / ceil;
+
+        if (expected_rate > 70) {
+            ceil *= 2;
+        }
+        new_size = MAX(ceil, 1 << CPU_TLB_DYN_MIN_BITS);
+    }
+
+    if (new_size == old_size) {
+        if (window_expired) {
+            tlb_window_reset(desc, desc->n_used_entries);
+        }
+        return;
+    }
+
+    tlb_debug("mmu_idx %d: %zu -> %zu entries\n", mmu_idx, old_size, new_size);
+    tlb_free_mmuidx(env, mmu_idx);
+    tlb_window_reset(desc, 0);
+    tlb_alloc_mmuidx(env, mmu_idx, new_size);
+    /* Fall back to smaller tables if the host is short of memory.  */
+    while (!env->tlb_table[mmu_idx] || !env->iotlb[mmu_idx]) {
+        if (new_size == (1 << CPU_TLB_DYN_MIN_BITS)) {
+            error_report("%s: %s", __func__, strerror(errno));
+            abort();
+        }
+        new_size = MAX(new_size >> 1, 1 << CPU_TLB_DYN_MIN_BITS);
+        tlb_free_mmuidx(env, mmu_idx);
+        tlb_alloc_mmuidx(env, mmu_idx, new_size);
+    }
+}
+
+static inline void tlb_n_used_entries_inc(CPUArchState *env, int mmu_idx)
+{
+    env->tlb_d[mmu_idx].n_used_entries++;
+}
+
+static inline void tlb_n_used_entries_dec(CPUArchState *env, int mmu_idx)
+{
+    env->tlb_d[mmu_idx].n_used_entries--;
+}
+
+void tlb_init(CPUState *cpu)
+{
+    CPUArchState *env = cpu->env_ptr;
+    int mmu_idx;
+
+    for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+        env->tlb_d[mmu_idx].n_flushes = 0;
+        tlb_window_reset(&env->tlb_d[mmu_idx], 0);
+        env->tlb_d[mmu_idx].n_used_entries = 0;
+        tlb_alloc_mmuidx(env, mmu_idx, 1 << CPU_TLB_DYN_DEFAULT_BITS);
+        if (!env->tlb_table[mmu_idx] || !env->iotlb[mmu_idx]) {
+            error_report("%s: %s", __func__, strerror(errno));
+            abort();
+        }
+        memset(env->tlb_table[mmu_idx], -1,
+               tlb_n_entries(env, mmu_idx) * sizeof(CPUTLBEntry));
+        memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
+    }
+}
+
+void tlb_destroy(CPUState *cpu)
+{
+    CPUArchState *env = cpu->env_ptr;
+    int mmu_idx;
+
+    for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+        tlb_free_mmuidx(env, mmu_idx);
+    }
+}
+
+/* Start over from an empty TLB of the default size, as after tlb_init().
+ * Record and replay both call this when they begin, so the replay sees
+ * the TLB geometry and contents the recording did.  The CPU must not be
+ * running.
+ */
+void tlb_reset(CPUState *cpu)
+{
+    tlb_destroy(cpu);
+    tlb_init(cpu);
+}
+#else
+static inline void tlb_mmu_resize(CPUArchState *env, int mmu_idx)
+{
+}
+
+static inline void tlb_n_used_entries_inc(CPUArchState *env, int mmu_idx)
+{
+}
+
+static inline void tlb_n_used_entries_dec(CPUArchState *env, int mmu_idx)
+{
+}
+
+void tlb_init(CPUState *cpu)
+{
+}
+
+void tlb_destroy(CPUState *cpu)
+{
+}
+
+void tlb_reset(CPUState *cpu)
+{
+    tlb_flush(cpu);
+}
+#endif /* TCG_TARGET_IMPLEMENTS_DYN_TLB */
+
+static inline bool tlb_entry_is_empty(const CPUTLBEntry *te)
+{
+    return te->addr_read == -1 && te->addr_write == -1 && te->addr_code == -1;
+}
+
+/* Resize and flush the TLB of one MMU index, including its victim TLB. */
+static void tlb_flush_one_mmuidx(CPUArchState *env, int mmu_idx)
+{
+    tlb_mmu_resize(env, mmu_idx);
+#if TCG_TARGET_IMPLEMENTS_DYN_TLB
+    env->tlb_d[mmu_idx].n_used_entries = 0;
+#endif
+    memset(env->tlb_table[mmu_idx], -1,
+           tlb_n_entries(env, mmu_idx) * sizeof(CPUTLBEntry));
+    memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
+}
+
 /* This is OK because CPU architectures generally permit an
  * implementation to drop entries from the TLB at any time, so
  * flushing more entries than required is only an efficiency issue,
@@ -106,6 +292,7 @@ int tlb_flush_count;
 static void tlb_flush_nocheck(CPUState *cpu)
 {
     CPUArchState *env = cpu->env_ptr;
+    int mmu_idx;
 
     /* The QOM tests will trigger tlb_flushes without setting up TCG
      * so we bug out here in that case.
@@ -119,8 +306,9 @@ static void tlb_flush_nocheck(CPUState *cpu)
 
     tb_lock();
 
-    memset(env->tlb_table, -1, sizeof(env->tlb_table));
-    memset(env->tlb_v_table, -1, sizeof(env->tlb_v_table));
+    for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+        tlb_flush_one_mmuidx(env, mmu_idx);
+    }
     memset(cpu->tb_jmp_cache, 0, sizeof(cpu->tb_jmp_cache));
 
     env->vtlb_index = 0;
@@ -181,8 +369,7 @@ static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
         if (test_bit(mmu_idx, &mmu_idx_bitmask)) {
             tlb_debug("%d\n", mmu_idx);
 
-            memset(env->tlb_table[mmu_idx], -1, sizeof(env->tlb_table[0]));
-            memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
+            tlb_flush_one_mmuidx(env, mmu_idx);
         }
     }
 
@@ -237,7 +424,8 @@ void tlb_flush_by_mmuidx_all_cpus_synced(CPUState *src_cpu,
 
 
 
-static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
+/* Returns true if the entry was flushed.  */
+static inline bool tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
 {
     if (addr == (tlb_entry->addr_read &
                  (TARGET_PAGE_MASK | TLB_INVALID_MASK)) ||
@@ -246,14 +434,15 @@ static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
         addr == (tlb_entry->addr_code &
                  (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
         memset(tlb_entry, -1, sizeof(*tlb_entry));
+        return true;
     }
+    return false;
 }
 
 static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
 {
     CPUArchState *env = cpu->env_ptr;
     target_ulong addr = (target_ulong) data.target_ptr;
-    int i;
     int mmu_idx;
 
     assert_cpu_is_self(cpu);
@@ -271,9 +460,10 @@ static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
     }
 
     addr &= TARGET_PAGE_MASK;
-    i = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
-        tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
+        if (tlb_flush_entry(tlb_entry(env, mmu_idx, addr), addr)) {
+            tlb_n_used_entries_dec(env, mmu_idx);
+        }
     }
 
     /* check whether there are entries that need to be flushed in the vtlb */
@@ -311,18 +501,19 @@ static void tlb_flush_page_by_mmuidx_async_work(CPUState *cpu,
     target_ulong addr_and_mmuidx = (target_ulong) data.target_ptr;
     target_ulong addr = addr_and_mmuidx & TARGET_PAGE_MASK;
     unsigned long mmu_idx_bitmap = addr_and_mmuidx & ALL_MMUIDX_BITS;
-    int page = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     int mmu_idx;
     int i;
 
     assert_cpu_is_self(cpu);
 
-    tlb_debug("page:%d addr:"TARGET_FMT_lx" mmu_idx:0x%lx\n",
-              page, addr, mmu_idx_bitmap);
+    tlb_debug("addr:"TARGET_FMT_lx" mmu_idx:0x%lx\n",
+              addr, mmu_idx_bitmap);
 
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         if (test_bit(mmu_idx, &mmu_idx_bitmap)) {
-            tlb_flush_entry(&env->tlb_table[mmu_idx][page], addr);
+            if (tlb_flush_entry(tlb_entry(env, mmu_idx, addr), addr)) {
+                tlb_n_used_entries_dec(env, mmu_idx);
+            }
 
             /* check whether there are vltb entries that need to be flushed */
             for (i = 0; i < CPU_VTLB_SIZE; i++) {
@@ -529,7 +720,7 @@ void tlb_reset_dirty(CPUState *cpu, ram_addr_t start1, ram_addr_t length)
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         unsigned int i;
 
-        for (i = 0; i < CPU_TLB_SIZE; i++) {
+        for (i = 0; i < tlb_n_entries(env, mmu_idx); i++) {
             tlb_reset_dirty_range(&env->tlb_table[mmu_idx][i],
                                   start1, length);
         }
@@ -553,15 +744,13 @@ static inline void tlb_set_dirty1(CPUTLBEntry *tlb_entry, target_ulong vaddr)
 void tlb_set_dirty(CPUState *cpu, target_ulong vaddr)
 {
     CPUArchState *env = cpu->env_ptr;
-    int i;
     int mmu_idx;
 
     assert_cpu_is_self(cpu);
 
     vaddr &= TARGET_PAGE_MASK;
-    i = (vaddr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
-        tlb_set_dirty1(&env->tlb_table[mmu_idx][i], vaddr);
+        tlb_set_dirty1(tlb_entry(env, mmu_idx, vaddr), vaddr);
     }
 
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
@@ -645,10 +834,13 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
     iotlb = memory_region_section_get_iotlb(cpu, section, vaddr, paddr, xlat,
                                             prot, &address);
 
-    index = (vaddr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
-    te = &env->tlb_table[mmu_idx][index];
+    index = tlb_index(env, mmu_idx, vaddr);
+    te = tlb_entry(env, mmu_idx, vaddr);
     /* do not discard the translation in te, evict it into a victim tlb */
     tv = &env->tlb_v_table[mmu_idx][vidx];
+    if (tlb_entry_is_empty(te)) {
+        tlb_n_used_entries_inc(env, mmu_idx);
+    }
 
     /* addr_write can race with tlb_reset_dirty_range */
     copy_tlb_helper(tv, te, true);
@@ -762,8 +954,8 @@ tb_page_addr_t get_page_addr_code(CPUArchState *env1, target_ulong addr)
     CPUState *cpu = ENV_GET_CPU(env1);
     CPUIOTLBEntry *iotlbentry;
 
-    page_index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
     mmu_idx = cpu_mmu_index(env1, true);
+    page_index = tlb_index(env1, mmu_idx, addr);
     if (unlikely(env1->tlb_table[mmu_idx][page_index].addr_code !=
                  (addr & TARGET_PAGE_MASK))) {
         cpu_ldub_code(env1, addr);
@@ -791,6 +983,7 @@ static uint64_t io_readx(CPUArchState *env, CPUIOTLBEntry *iotlbentry,
     hwaddr physaddr = iotlbentry->addr;
     MemoryRegion *mr = iotlb_to_region(cpu, physaddr, iotlbentry->attrs);
     uint64_t val;
+    bool locked = false;
 
     physaddr = (physaddr & TARGET_PAGE_MASK) + addr;
     cpu->mem_io_pc = retaddr;
@@ -799,17 +992,27 @@ static uint64_t io_readx(CPUArchState *env, CPUIOTLBEntry *iotlbentry,
     }
 
     cpu->mem_io_vaddr = addr;
+
+    /* Only MTTCG vCPUs run without the BQL */
+    if (mr->global_locking && !qemu_mutex_iothread_locked()) {
+        qemu_mutex_lock_iothread();
+        locked = true;
+    }
+
     if (mr->name && !strcmp(mr->name, "watch")){
         memory_region_dispatch_read(mr, physaddr, &val, size, iotlbentry->attrs);
-        return val;
+    } else {
+        RR_DO_RECORD_OR_REPLAY(
+            /* action= */
+            memory_region_dispatch_read(mr, physaddr, &val, size, iotlbentry->attrs),
+            /* record= */ rr_input_8(&val),
+            /* replay= */ rr_input_8(&val),
+            /* location= */ RR_CALLSITE_IO_READ_ALL);
     }
 
-    RR_DO_RECORD_OR_REPLAY(
-        /* action= */
-        memory_region_dispatch_read(mr, physaddr, &val, size, iotlbentry->attrs),
-        /* record= */ rr_input_8(&val),
-        /* replay= */ rr_input_8(&val),
-        /* location= */ RR_CALLSITE_IO_READ_ALL);
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
 
     return val;
 }
@@ -821,6 +1024,7 @@ static void io_writex(CPUArchState *env, CPUIOTLBEntry *iotlbentry,
     CPUState *cpu = ENV_GET_CPU(env);
     hwaddr physaddr = iotlbentry->addr;
     MemoryRegion *mr = iotlb_to_region(cpu, physaddr, iotlbentry->attrs);
+    bool locked = false;
 
     physaddr = (physaddr & TARGET_PAGE_MASK) + addr;
     if (mr != &io_mem_rom && mr != &io_mem_notdirty && !cpu->can_do_io) {
@@ -829,13 +1033,16 @@ static void io_writex(CPUArchState *env, CPUIOTLBEntry *iotlbentry,
 
     cpu->mem_io_vaddr = addr;
     cpu->mem_io_pc = retaddr;
-    
-    if (mr->name && !strcmp(mr->name, "watch")){
-        memory_region_dispatch_write(mr, physaddr, val, size, iotlbentry->attrs);
-        return;
+
+    /* Only MTTCG vCPUs run without the BQL */
+    if (mr->global_locking && !qemu_mutex_iothread_locked()) {
+        qemu_mutex_lock_iothread();
+        locked = true;
     }
 
-    if (mr != &io_mem_rom && mr != &io_mem_notdirty) {
+    if (mr->name && !strcmp(mr->name, "watch")){
+        memory_region_dispatch_write(mr, physaddr, val, size, iotlbentry->attrs);
+    } else if (mr != &io_mem_rom && mr != &io_mem_notdirty) {
         RR_DO_RECORD_OR_REPLAY(
             /* action= */
             memory_region_dispatch_write(mr, physaddr, val, size, iotlbentry->attrs),
@@ -845,6 +1052,10 @@ static void io_writex(CPUArchState *env, CPUIOTLBEntry *iotlbentry,
     } else {
         memory_region_dispatch_write(mr, physaddr, val, size, iotlbentry->attrs);
     }
+
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
 }
 
 /* Return true if ADDR is present in the victim tlb, and has been copied
@@ -861,6 +1072,9 @@ static bool victim_tlb_hit(CPUArchState *env, size_t mmu_idx, size_t index,
             /* Found entry in victim tlb, swap tlb and iotlb.  */
             CPUTLBEntry tmptlb, *tlb = &env->tlb_table[mmu_idx][index];
 
+            if (tlb_entry_is_empty(tlb)) {
+                tlb_n_used_entries_inc(env, mmu_idx);
+            }
             copy_tlb_helper(&tmptlb, tlb, false);
             copy_tlb_helper(tlb, vtlb, true);
             copy_tlb_helper(vtlb, &tmptlb, true);
@@ -888,7 +1102,7 @@ static bool victim_tlb_hit(CPUArchState *env, size_t mmu_idx, size_t index,
 void probe_write(CPUArchState *env, target_ulong addr, int mmu_idx,
                  uintptr_t retaddr)
 {
-    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    uintptr_t index = tlb_index(env, mmu_idx, addr);
     target_ulong tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
 
     if ((addr & TARGET_PAGE_MASK)
@@ -906,8 +1120,8 @@ static void *atomic_mmu_lookup(CPUArchState *env, target_ulong addr,
                                TCGMemOpIdx oi, uintptr_t retaddr)
 {
     size_t mmu_idx = get_mmuidx(oi);
-    size_t index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
-    CPUTLBEntry *tlbe = &env->tlb_table[mmu_idx][index];
+    size_t index = tlb_index(env, mmu_idx, addr);
+    CPUTLBEntry *tlbe = tlb_entry(env, mmu_idx, addr);
     target_ulong tlb_addr = tlbe->addr_write;
     TCGMemOp mop = get_memop(oi);
     int a_bits = get_alignment_bits(mop);
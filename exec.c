@@ -73,7 +73,6 @@
 #include "qemu/mmap-alloc.h"
 #endif
 
-#include <zlib.h>
 #include "panda/callback_support.h"
 #include "panda/checkpoint.h"
 
@@ -715,6 +714,9 @@ void cpu_exec_unrealizefn(CPUState *cpu)
     CPUClass *cc = CPU_GET_CLASS(cpu);
 
     cpu_list_remove(cpu);
+    tlb_destroy(cpu);
+    g_free(cpu->panda_pc_cache);
+    cpu->panda_pc_cache = NULL;
 
     if (cc->vmsd != NULL) {
         vmstate_unregister(NULL, cc->vmsd, cpu);
@@ -753,6 +755,7 @@ void cpu_exec_realizefn(CPUState *cpu, Error **errp)
     CPUClass *cc ATTRIBUTE_UNUSED = CPU_GET_CLASS(cpu);
 
     cpu_list_add(cpu);
+    tlb_init(cpu);
 
 #ifndef CONFIG_USER_ONLY
     if (qdev_get_vmsd(DEVICE(cpu)) == NULL) {
@@ -934,6 +937,8 @@ int cpu_rr_breakpoint_insert(CPUState *cpu, uint64_t rr_instr_count, int flags,
     } else {
         QTAILQ_INSERT_TAIL(&cpu->breakpoints, bp, entry);
     }
+    g_array_insert_val(cpu->rr_breakpoints,
+                       cpu_rr_breakpoint_lower_bound(cpu, rr_instr_count), bp);
 
     //breakpoint_invalidate(cpu, pc);
     tb_flush(cpu);
@@ -965,9 +970,18 @@ int cpu_breakpoint_remove_by_instr(CPUState *cpu, uint64_t rr_instr_count, int f
 {
     CPUBreakpoint *bp;
 
-    QTAILQ_FOREACH(bp, &cpu->breakpoints, entry) {
-        if (bp->rr_instr_count == rr_instr_count && bp->flags == flags) {
+    guint i;
+
+    for (i = cpu_rr_breakpoint_lower_bound(cpu, rr_instr_count);
+         i < cpu->rr_breakpoints->len; i++) {
+        bp = g_array_index(cpu->rr_breakpoints, CPUBreakpoint *, i);
+        if (bp->rr_instr_count != rr_instr_count) {
+            break;
+        }
+        if (bp->flags == flags) {
             cpu_breakpoint_remove_by_ref(cpu, bp);
+            /* blocks may have been cut short or end in a debug exit here */
+            tb_flush(cpu);
             return 0;
         }
     }
@@ -979,6 +993,17 @@ void cpu_breakpoint_remove_by_ref(CPUState *cpu, CPUBreakpoint *breakpoint)
 {
     QTAILQ_REMOVE(&cpu->breakpoints, breakpoint, entry);
 
+    if (breakpoint->rr_instr_count != 0) {
+        guint i;
+        for (i = cpu_rr_breakpoint_lower_bound(cpu, breakpoint->rr_instr_count);
+             i < cpu->rr_breakpoints->len; i++) {
+            if (g_array_index(cpu->rr_breakpoints, CPUBreakpoint *, i) == breakpoint) {
+                g_array_remove_index(cpu->rr_breakpoints, i);
+                break;
+            }
+        }
+    }
+
     //breakpoint_invalidate(cpu, breakpoint->pc);
 
     g_free(breakpoint);
@@ -1033,6 +1058,8 @@ void cpu_rcont_check_restore(CPUState* cpu, uint64_t rr_instr_count){
                  panda_restore(prev_checkpoint);
             } else {
                 // Re-run from checkpoint to latest breakpoint!
+                // The hit is a stop (see cpu_rr_next_stop), so the block
+                // reaching it gets retranslated to break there.
                 cpu->reverse_flags = GDB_RCONT_BREAK;
                 panda_restore_by_num(closest_num);
             }
@@ -1040,6 +1067,39 @@ void cpu_rcont_check_restore(CPUState* cpu, uint64_t rr_instr_count){
     }
 }
 
+/*
+ * First instruction count at or after rr_instr_count at which replay must
+ * leave the translated code: an rr breakpoint, the end of the checkpoint
+ * region a reverse-continue is scanning (or rr_instr_count itself if that
+ * is already behind us), or the hit the second pass of a reverse-continue
+ * is running to. UINT64_MAX if there is none.
+ *
+ * Translation cuts blocks short so that each stop starts a block, and the
+ * stop checks are then made only there rather than on every instruction.
+ */
+uint64_t cpu_rr_next_stop(CPUState *cpu, uint64_t rr_instr_count)
+{
+    uint64_t stop = UINT64_MAX;
+    guint i;
+
+    if (likely(cpu->rr_breakpoints->len == 0 && cpu->reverse_flags == 0)) {
+        return stop;
+    }
+
+    i = cpu_rr_breakpoint_lower_bound(cpu, rr_instr_count);
+    if (i < cpu->rr_breakpoints->len) {
+        stop = g_array_index(cpu->rr_breakpoints, CPUBreakpoint *, i)->rr_instr_count;
+    }
+    if (cpu->reverse_flags & GDB_RCONT) {
+        uint64_t region_end = MAX(cpu->last_gdb_instr - 1, rr_instr_count);
+        stop = MIN(stop, region_end);
+    } else if ((cpu->reverse_flags & GDB_RCONT_BREAK) &&
+               cpu->last_bp_hit_instr >= rr_instr_count) {
+        stop = MIN(stop, cpu->last_bp_hit_instr);
+    }
+    return stop;
+}
+
 /* enable or disable single step mode. EXCP_DEBUG is returned by the
    CPU loop after each instruction */
 void cpu_single_step(CPUState *cpu, int enabled)
@@ -2115,6 +2175,22 @@ void qemu_ram_remap(ram_addr_t addr, ram_addr_t length)
         }
     }
 }
+
+/* Called after something outside exec.c has mapped new pages over
+ * [host, host + length) of a RAM block.  Redo the madvise() calls that
+ * ram_block_add() made, and re-announce the range to the RAM block
+ * notifiers so that users pinning the old pages (e.g. io_uring registered
+ * buffers) pick up the new ones.
+ */
+void qemu_ram_remapped(void *host, ram_addr_t length)
+{
+    memory_try_enable_merging(host, length);
+    qemu_ram_setup_dump(host, length);
+    qemu_madvise(host, length, QEMU_MADV_HUGEPAGE);
+    qemu_madvise(host, length, QEMU_MADV_DONTFORK);
+    ram_block_notify_remove(host, length);
+    ram_block_notify_add(host, length);
+}
 #endif /* !_WIN32 */
 
 /* Return a host pointer to ram allocated with qemu_ram_alloc.
@@ -3344,9 +3420,6 @@ address_space_extend_translation(AddressSpace *as, hwaddr addr, hwaddr target_le
     }
 }
 
-QLIST_HEAD(rr_map_list, RR_MapList) rr_map_list
-    = QLIST_HEAD_INITIALIZER(rr_map_list);
-
 /* Map a physical memory region into a host virtual address.
  * May map a subset of the requested range, given by and returned in *plen.
  * May return NULL if resources needed to perform the mapping are exhausted.
@@ -3401,14 +3474,10 @@ void *address_space_map(AddressSpace *as,
     ptr = qemu_ram_ptr_length(mr->ram_block, xlat, plen, true);
     rcu_read_unlock();
 
-    if (!rr_in_replay()) {
-        // Keep a list of these so we can find out when they change
-        RR_MapList *region = g_malloc(sizeof(*region));
-        region->addr = addr;
-        region->len = *plen; // can't use len because it was modified
-        region->ptr = ptr;
-        region->crc = crc32(crc32(0, Z_NULL, 0), region->ptr, region->len);
-        QLIST_INSERT_HEAD(&rr_map_list, region, link);
+    if (is_write && rr_in_record()) {
+        // Devices may write through ptr before unmapping it; keep track of
+        // it so we can find out when it changes
+        rr_tracked_mem_region_add(addr, ptr, *plen);
     }
 
     return ptr;
@@ -3440,19 +3509,8 @@ void address_space_unmap(AddressSpace *as, void *buffer, hwaddr len,
         memory_region_unref(mr);
 
         // Remove it from the tracked map regions for rec/replay
-        if (!rr_in_replay()) {
-            RR_MapList *region;
-            bool found = false;
-            QLIST_FOREACH(region, &rr_map_list, link) {
-                if (region->ptr == buffer && region->len == len) {
-                    found = true;
-                    break;
-                }
-            }
-            if (found) {
-                QLIST_REMOVE(region, link);
-                g_free(region);
-            }
+        if (is_write && rr_in_record()) {
+            rr_tracked_mem_region_remove(buffer, len);
         }
 
         return;
@@ -84,6 +84,9 @@ this code that are retained.
  */
 #include "qemu/osdep.h"
 
+#include <math.h>
+#include <float.h>
+
 #include "fpu/softfloat.h"
 
 /* We only need stdlib for abort() */
@@ -105,6 +108,205 @@ this code that are retained.
 *----------------------------------------------------------------------------*/
 #include "softfloat-specialize.h"
 
+/*----------------------------------------------------------------------------
+| Host FPU fast path.  If the guest is rounding to nearest-even and has
+| already accumulated the inexact flag, and the operands are zero or normal,
+| the host's own IEEE operation returns the same result that the code below
+| would compute, and the only flag softfloat could raise is inexact.  That
+| stops being true once the result overflows or lands in the subnormal
+| range, so those cases are handed back to the software routines.  This
+| keeps results and flags bit-exact, which record/replay depends on.
+|
+| Only hosts whose compiler evaluates float and double in their own
+| precision (no x87 excess precision) take the fast path.
+*----------------------------------------------------------------------------*/
+#if defined(__x86_64__) || defined(__aarch64__)
+#define QEMU_HARDFLOAT 1
+#else
+#define QEMU_HARDFLOAT 0
+#endif
+
+typedef union {
+    uint32_t s;
+    float h;
+} union_float32;
+
+typedef union {
+    uint64_t s;
+    double h;
+} union_float64;
+
+static inline bool can_use_fpu(const float_status *s)
+{
+    return QEMU_HARDFLOAT
+        && (s->float_exception_flags & float_flag_inexact)
+        && s->float_rounding_mode == float_round_nearest_even;
+}
+
+static inline bool float32_is_zero_or_normal(float32 a)
+{
+    uint32_t exp = (float32_val(a) >> 23) & 0xff;
+
+    return exp != 0xff && (exp != 0 || (float32_val(a) & 0x7fffffff) == 0);
+}
+
+static inline bool float64_is_zero_or_normal(float64 a)
+{
+    uint64_t exp = (float64_val(a) >> 52) & 0x7ff;
+
+    return exp != 0x7ff
+        && (exp != 0 || (float64_val(a) & 0x7fffffffffffffffULL) == 0);
+}
+
+static inline bool float32_is_zero_bits(float32 a)
+{
+    return (float32_val(a) & 0x7fffffff) == 0;
+}
+
+static inline bool float64_is_zero_bits(float64 a)
+{
+    return (float64_val(a) & 0x7fffffffffffffffULL) == 0;
+}
+
+/* A result is safe to return if it is finite and normal, or if it is an
+   exact zero produced by a zero operand.  */
+static inline bool float32_hard_result_ok(float r, bool exact_zero)
+{
+    if (unlikely(isinf(r))) {
+        return false;
+    }
+    return fabsf(r) > FLT_MIN || (exact_zero && r == 0);
+}
+
+static inline bool float64_hard_result_ok(double r, bool exact_zero)
+{
+    if (unlikely(isinf(r))) {
+        return false;
+    }
+    return fabs(r) > DBL_MIN || (exact_zero && r == 0);
+}
+
+typedef enum {
+    hard_add,
+    hard_sub,
+    hard_mul,
+    hard_div,
+} HardFloatOp;
+
+static bool float32_hard_op(HardFloatOp op, float32 a, float32 b,
+                            float32 *res, float_status *s)
+{
+    union_float32 ua, ub, ur;
+    bool exact_zero = false;
+
+    if (!can_use_fpu(s)
+        || !float32_is_zero_or_normal(a) || !float32_is_zero_or_normal(b)) {
+        return false;
+    }
+    ua.s = float32_val(a);
+    ub.s = float32_val(b);
+    switch (op) {
+    case hard_add:
+        ur.h = ua.h + ub.h;
+        exact_zero = float32_is_zero_bits(a) && float32_is_zero_bits(b);
+        break;
+    case hard_sub:
+        ur.h = ua.h - ub.h;
+        exact_zero = float32_is_zero_bits(a) && float32_is_zero_bits(b);
+        break;
+    case hard_mul:
+        ur.h = ua.h * ub.h;
+        exact_zero = float32_is_zero_bits(a) || float32_is_zero_bits(b);
+        break;
+    case hard_div:
+        if (float32_is_zero_bits(b)) {
+            return false;
+        }
+        ur.h = ua.h / ub.h;
+        exact_zero = float32_is_zero_bits(a);
+        break;
+    default:
+        g_assert_not_reached();
+    }
+    if (!float32_hard_result_ok(ur.h, exact_zero)) {
+        return false;
+    }
+    *res = make_float32(ur.s);
+    return true;
+}
+
+static bool float64_hard_op(HardFloatOp op, float64 a, float64 b,
+                            float64 *res, float_status *s)
+{
+    union_float64 ua, ub, ur;
+    bool exact_zero = false;
+
+    if (!can_use_fpu(s)
+        || !float64_is_zero_or_normal(a) || !float64_is_zero_or_normal(b)) {
+        return false;
+    }
+    ua.s = float64_val(a);
+    ub.s = float64_val(b);
+    switch (op) {
+    case hard_add:
+        ur.h = ua.h + ub.h;
+        exact_zero = float64_is_zero_bits(a) && float64_is_zero_bits(b);
+        break;
+    case hard_sub:
+        ur.h = ua.h - ub.h;
+        exact_zero = float64_is_zero_bits(a) && float64_is_zero_bits(b);
+        break;
+    case hard_mul:
+        ur.h = ua.h * ub.h;
+        exact_zero = float64_is_zero_bits(a) || float64_is_zero_bits(b);
+        break;
+    case hard_div:
+        if (float64_is_zero_bits(b)) {
+            return false;
+        }
+        ur.h = ua.h / ub.h;
+        exact_zero = float64_is_zero_bits(a);
+        break;
+    default:
+        g_assert_not_reached();
+    }
+    if (!float64_hard_result_ok(ur.h, exact_zero)) {
+        return false;
+    }
+    *res = make_float64(ur.s);
+    return true;
+}
+
+/* sqrt of a non-negative zero or normal number is always finite and
+   normal (or an exact zero), so only the inputs need checking.  */
+static bool float32_hard_sqrt(float32 a, float32 *res, float_status *s)
+{
+    union_float32 ua, ur;
+
+    if (!can_use_fpu(s) || !float32_is_zero_or_normal(a)
+        || (float32_val(a) >> 31)) {
+        return false;
+    }
+    ua.s = float32_val(a);
+    ur.h = sqrtf(ua.h);
+    *res = make_float32(ur.s);
+    return true;
+}
+
+static bool float64_hard_sqrt(float64 a, float64 *res, float_status *s)
+{
+    union_float64 ua, ur;
+
+    if (!can_use_fpu(s) || !float64_is_zero_or_normal(a)
+        || (float64_val(a) >> 63)) {
+        return false;
+    }
+    ua.s = float64_val(a);
+    ur.h = sqrt(ua.h);
+    *res = make_float64(ur.s);
+    return true;
+}
+
 /*----------------------------------------------------------------------------
 | Returns the fraction bits of the half-precision floating-point value `a'.
 *----------------------------------------------------------------------------*/
@@ -2186,6 +2388,11 @@ static float32 subFloat32Sigs(float32 a, float32 b, flag zSign,
 float32 float32_add(float32 a, float32 b, float_status *status)
 {
     flag aSign, bSign;
+    float32 hard_res;
+
+    if (float32_hard_op(hard_add, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float32_squash_input_denormal(a, status);
     b = float32_squash_input_denormal(b, status);
 
@@ -2209,6 +2416,11 @@ float32 float32_add(float32 a, float32 b, float_status *status)
 float32 float32_sub(float32 a, float32 b, float_status *status)
 {
     flag aSign, bSign;
+    float32 hard_res;
+
+    if (float32_hard_op(hard_sub, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float32_squash_input_denormal(a, status);
     b = float32_squash_input_denormal(b, status);
 
@@ -2236,7 +2448,11 @@ float32 float32_mul(float32 a, float32 b, float_status *status)
     uint32_t aSig, bSig;
     uint64_t zSig64;
     uint32_t zSig;
+    float32 hard_res;
 
+    if (float32_hard_op(hard_mul, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float32_squash_input_denormal(a, status);
     b = float32_squash_input_denormal(b, status);
 
@@ -2299,6 +2515,11 @@ float32 float32_div(float32 a, float32 b, float_status *status)
     flag aSign, bSign, zSign;
     int aExp, bExp, zExp;
     uint32_t aSig, bSig, zSig;
+    float32 hard_res;
+
+    if (float32_hard_op(hard_div, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float32_squash_input_denormal(a, status);
     b = float32_squash_input_denormal(b, status);
 
@@ -2698,6 +2919,11 @@ float32 float32_sqrt(float32 a, float_status *status)
     int aExp, zExp;
     uint32_t aSig, zSig;
     uint64_t rem, term;
+    float32 hard_res;
+
+    if (float32_hard_sqrt(a, &hard_res, status)) {
+        return hard_res;
+    }
     a = float32_squash_input_denormal(a, status);
 
     aSig = extractFloat32Frac( a );
@@ -3981,6 +4207,11 @@ static float64 subFloat64Sigs(float64 a, float64 b, flag zSign,
 float64 float64_add(float64 a, float64 b, float_status *status)
 {
     flag aSign, bSign;
+    float64 hard_res;
+
+    if (float64_hard_op(hard_add, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float64_squash_input_denormal(a, status);
     b = float64_squash_input_denormal(b, status);
 
@@ -4004,6 +4235,11 @@ float64 float64_add(float64 a, float64 b, float_status *status)
 float64 float64_sub(float64 a, float64 b, float_status *status)
 {
     flag aSign, bSign;
+    float64 hard_res;
+
+    if (float64_hard_op(hard_sub, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float64_squash_input_denormal(a, status);
     b = float64_squash_input_denormal(b, status);
 
@@ -4029,7 +4265,11 @@ float64 float64_mul(float64 a, float64 b, float_status *status)
     flag aSign, bSign, zSign;
     int aExp, bExp, zExp;
     uint64_t aSig, bSig, zSig0, zSig1;
+    float64 hard_res;
 
+    if (float64_hard_op(hard_mul, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float64_squash_input_denormal(a, status);
     b = float64_squash_input_denormal(b, status);
 
@@ -4094,6 +4334,11 @@ float64 float64_div(float64 a, float64 b, float_status *status)
     uint64_t aSig, bSig, zSig;
     uint64_t rem0, rem1;
     uint64_t term0, term1;
+    float64 hard_res;
+
+    if (float64_hard_op(hard_div, a, b, &hard_res, status)) {
+        return hard_res;
+    }
     a = float64_squash_input_denormal(a, status);
     b = float64_squash_input_denormal(b, status);
 
@@ -4506,6 +4751,11 @@ float64 float64_sqrt(float64 a, float_status *status)
     int aExp, zExp;
     uint64_t aSig, zSig, doubleZSig;
     uint64_t rem0, rem1, term0, term1;
+    float64 hard_res;
+
+    if (float64_hard_sqrt(a, &hard_res, status)) {
+        return hard_res;
+    }
     a = float64_squash_input_denormal(a, status);
 
     aSig = extractFloat64Frac( a );
@@ -901,6 +901,8 @@ static void gdb_breakpoint_remove_all(void)
         cpu_breakpoint_remove_all(cpu, BP_GDB);
 #ifndef CONFIG_USER_ONLY
         cpu_watchpoint_remove_all(cpu, BP_GDB);
+        /* the rrlastwrite watchpoint is BP_GDB too, so it is gone now */
+        cpu->rr_lastwrite_wp = NULL;
 #endif
     }
 }
@@ -1035,6 +1037,32 @@ out:
     return res;
 }
 
+/* The rrlastwrite watchpoints only last until the next stop.  */
+static void gdb_remove_lastwrite_watchpoints(void) {
+	CPUState *cpu;
+
+	CPU_FOREACH(cpu) {
+		if (cpu->rr_lastwrite_wp) {
+			cpu_watchpoint_remove_by_ref(cpu, cpu->rr_lastwrite_wp);
+			cpu->rr_lastwrite_wp = NULL;
+		}
+	}
+}
+
+static bool gdb_has_pc_breakpoints_or_watchpoints(CPUState *cpu) {
+	CPUBreakpoint *bp;
+
+	if (!QTAILQ_EMPTY(&cpu->watchpoints)) {
+		return true;
+	}
+	QTAILQ_FOREACH(bp, &cpu->breakpoints, entry) {
+		if (bp->rr_instr_count == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
 static void gdb_handle_reverse(GDBState *s, const char *p) {
 	uint64_t cur_instr_count = rr_get_guest_instr_count();
 
@@ -1052,6 +1080,24 @@ static void gdb_handle_reverse(GDBState *s, const char *p) {
 		s->c_cpu->reverse_flags = GDB_RCONT ;
 		s->c_cpu->last_gdb_instr = cur_instr_count; 
 		s->c_cpu->last_bp_hit_instr = 0;
+
+		if (!gdb_has_pc_breakpoints_or_watchpoints(s->c_cpu)) {
+			// Only rr breakpoints, so the one to stop at is known: run
+			// straight to it instead of scanning checkpoint regions
+			guint i = cpu_rr_breakpoint_lower_bound(s->c_cpu, cur_instr_count);
+			if (i == 0) {
+				// None before here, stop at the beginning
+				gdb_rr_breakpoint_insert(1, GDB_BREAKPOINT_SW);
+				s->c_cpu->reverse_flags = 0;
+				cur_instr_count = 1;
+			} else {
+				CPUBreakpoint *bp = g_array_index(s->c_cpu->rr_breakpoints,
+												  CPUBreakpoint *, i - 1);
+				s->c_cpu->reverse_flags = GDB_RCONT_BREAK;
+				s->c_cpu->last_bp_hit_instr = bp->rr_instr_count;
+				cur_instr_count = bp->rr_instr_count;
+			}
+		}
 	}
 
 	// revert to most recent checkpoint 
@@ -1117,18 +1163,52 @@ static void gdb_handle_panda_cmd(GDBState *s, const char* p) {
         
 		memtohex(buf, (uint8_t*)membuf, membufsize);
         put_packet(s, buf);
+	} else if (!strncmp(p, "rrlastwrite", 11)) {
+		// Watch for writes to addr until the next stop. The gdb command
+		// then reverse-continues, which stops at the last write before now.
+		CPUState *cpu;
+		target_ulong addr = 0, len = 1;
+		p += 11;
+		if (*p == ':') {
+			addr = strtoull(p+1, (char **)&p, 0);
+		}
+		if (*p == ':') {
+			len = strtoull(p+1, (char **)&p, 0);
+		}
+
+		int err = 0;
+		CPU_FOREACH(cpu) {
+			if (cpu->rr_lastwrite_wp) {
+				cpu_watchpoint_remove_by_ref(cpu, cpu->rr_lastwrite_wp);
+				cpu->rr_lastwrite_wp = NULL;
+			}
+			err = cpu_watchpoint_insert(cpu, addr, len, BP_MEM_WRITE | BP_GDB,
+										&cpu->rr_lastwrite_wp);
+			if (err) {
+				break;
+			}
+		}
+		if (err) {
+			snprintf(membuf, sizeof(membuf), "Can't watch " TARGET_FMT_lx " (%d)", addr, err);
+		} else {
+			snprintf(membuf, sizeof(membuf), "Watching writes to " TARGET_FMT_lx "+" TARGET_FMT_lu,
+					 addr, len);
+		}
+
+		memtohex(buf, (uint8_t*)membuf, strlen(membuf));
+		put_packet(s, buf);
 	} else if (!strncmp(p, "rrlist", 6)) {
 		CPUBreakpoint *bp;
+		guint i;
         int membufsize = 0;
         const char msg[] = "rr breakpoints: \n";
         snprintf(membuf, sizeof(membuf), msg); 
         membufsize += sizeof(msg)-1;
 
-        QTAILQ_FOREACH(bp, &s->c_cpu->breakpoints, entry) {
-           if (bp->rr_instr_count != 0) {
-				chars_written = snprintf(membuf+membufsize, sizeof(membuf), "%lu\n", bp->rr_instr_count);
-				membufsize += chars_written;
-            }
+        for (i = 0; i < s->c_cpu->rr_breakpoints->len; i++) {
+			bp = g_array_index(s->c_cpu->rr_breakpoints, CPUBreakpoint *, i);
+			chars_written = snprintf(membuf+membufsize, sizeof(membuf), "%lu\n", bp->rr_instr_count);
+			membufsize += chars_written;
 		}
         
 		if (membufsize > MAX_PACKET_LENGTH/2)
@@ -1596,8 +1676,10 @@ static void gdb_vm_state_change(void *opaque, int running, RunState state)
                      GDB_SIGNAL_TRAP, cpu_index(cpu), type,
                      (target_ulong)cpu->watchpoint_hit->virtaddr);
             cpu->watchpoint_hit = NULL;
+            gdb_remove_lastwrite_watchpoints();
             goto send_packet;
         }
+        gdb_remove_lastwrite_watchpoints();
         tb_flush(cpu);
         ret = GDB_SIGNAL_TRAP;
         break;
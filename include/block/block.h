@@ -43,6 +43,11 @@ typedef struct BlockDriverInfo {
      * True if this block driver only supports compressed writes
      */
     bool needs_compressed_writes;
+    /*
+     * True if compressed writes land in the image in the order they were
+     * submitted even if several of them are in flight at once
+     */
+    bool ordered_compressed_writes;
 } BlockDriverInfo;
 
 typedef struct BlockFragInfo {
@@ -98,6 +103,7 @@ typedef struct HDGeometry {
                                       select an appropriate protocol driver,
                                       ignoring the format layer */
 #define BDRV_O_NO_IO       0x10000 /* don't initialize for I/O */
+#define BDRV_O_IO_URING    0x20000 /* use io_uring instead of the thread pool */
 
 #define BDRV_O_CACHE_MASK  (BDRV_O_NOCACHE | BDRV_O_NO_FLUSH)
 
@@ -64,6 +64,26 @@ typedef uint64_t target_ulong;
 #define CPU_TLB_ENTRY_BITS 5
 #endif
 
+#if TCG_TARGET_IMPLEMENTS_DYN_TLB
+/* The TLB of each MMU mode is allocated separately and resized on flush,
+ * between 2^CPU_TLB_DYN_MIN_BITS and 2^CPU_TLB_DYN_MAX_BITS entries,
+ * according to how many entries were in use since the last resize.
+ * Generated code loads the table pointer and index mask from env.
+ */
+#define CPU_TLB_DYN_MIN_BITS 6
+#define CPU_TLB_DYN_DEFAULT_BITS 8
+
+#if HOST_LONG_BITS == 32
+/* Make sure we do not require a double-word shift for the TLB load */
+#define CPU_TLB_DYN_MAX_BITS (32 - TARGET_PAGE_BITS)
+#else
+/* 2^22 entries of 4k pages cover 16G, about what the second level TLB
+   of a current x86 host reaches. */
+#define CPU_TLB_DYN_MAX_BITS 22
+#endif
+
+#else /* !TCG_TARGET_IMPLEMENTS_DYN_TLB */
+
 /* TCG_TARGET_TLB_DISPLACEMENT_BITS is used in CPU_TLB_BITS to ensure that
  * the TLB is not unnecessarily small, but still small enough for the
  * TLB lookup instruction sequence used by the TCG target.
@@ -96,6 +116,8 @@ typedef uint64_t target_ulong;
 
 #define CPU_TLB_SIZE (1 << CPU_TLB_BITS)
 
+#endif /* TCG_TARGET_IMPLEMENTS_DYN_TLB */
+
 typedef struct CPUTLBEntry {
     /* bit TARGET_LONG_BITS to TARGET_PAGE_BITS : virtual address
        bit TARGET_PAGE_BITS-1..4  : Nonzero for accesses that should not
@@ -129,11 +151,36 @@ typedef struct CPUIOTLBEntry {
     MemTxAttrs attrs;
 } CPUIOTLBEntry;
 
+#if TCG_TARGET_IMPLEMENTS_DYN_TLB
+typedef struct CPUTLBDesc {
+    /* Flushes of this MMU index so far, the flush that started the current
+       resize window and the most entries that were in use at any flush
+       within it.  The window is measured in flushes rather than time so
+       that the TLB size only depends on what the guest does, which keeps
+       record and replay in step. */
+    uint64_t n_flushes;
+    uint64_t window_begin_flush;
+    size_t window_max_entries;
+    /* Valid entries filled since the last flush. */
+    size_t n_used_entries;
+} CPUTLBDesc;
+
+#define CPU_COMMON_TLB_TABLES                                           \
+    CPUTLBDesc tlb_d[NB_MMU_MODES];                                     \
+    /* (n_entries - 1) << CPU_TLB_ENTRY_BITS, for the TCG fast path */  \
+    uintptr_t tlb_mask[NB_MMU_MODES];                                   \
+    CPUTLBEntry *tlb_table[NB_MMU_MODES];                               \
+    CPUIOTLBEntry *iotlb[NB_MMU_MODES];
+#else
+#define CPU_COMMON_TLB_TABLES                                           \
+    CPUTLBEntry tlb_table[NB_MMU_MODES][CPU_TLB_SIZE];                  \
+    CPUIOTLBEntry iotlb[NB_MMU_MODES][CPU_TLB_SIZE];
+#endif
+
 #define CPU_COMMON_TLB \
     /* The meaning of the MMU modes is defined in the target code. */   \
-    CPUTLBEntry tlb_table[NB_MMU_MODES][CPU_TLB_SIZE];                  \
+    CPU_COMMON_TLB_TABLES                                               \
     CPUTLBEntry tlb_v_table[NB_MMU_MODES][CPU_VTLB_SIZE];               \
-    CPUIOTLBEntry iotlb[NB_MMU_MODES][CPU_TLB_SIZE];                    \
     CPUIOTLBEntry iotlb_v[NB_MMU_MODES][CPU_VTLB_SIZE];                 \
     target_ulong tlb_flush_addr;                                        \
     target_ulong tlb_flush_mask;                                        \
@@ -65,6 +65,9 @@ void restore_state_to_opc(CPUArchState *env, struct TranslationBlock *tb,
 
 void cpu_gen_init(void);
 bool cpu_restore_state(CPUState *cpu, uintptr_t searched_pc);
+/* Sets cpu->panda_guest_pc to the guest instruction whose code contains
+ * retaddr, unless generated code already maintains it.  */
+void panda_update_guest_pc(CPUState *cpu, uintptr_t retaddr);
 
 void QEMU_NORETURN cpu_loop_exit_noexc(CPUState *cpu);
 void QEMU_NORETURN cpu_io_recompile(CPUState *cpu, uintptr_t retaddr);
@@ -99,6 +102,21 @@ void cpu_reloading_memory_map(void);
  */
 void cpu_address_space_init(CPUState *cpu, AddressSpace *as, int asidx);
 /* cputlb.c */
+/**
+ * tlb_init - initialize a CPU's TLB
+ * @cpu: CPU whose TLB should be initialized
+ */
+void tlb_init(CPUState *cpu);
+/**
+ * tlb_destroy - free a CPU's TLB
+ * @cpu: CPU whose TLB should be freed
+ */
+void tlb_destroy(CPUState *cpu);
+/**
+ * tlb_reset - empty a CPU's TLB and return it to its initial size
+ * @cpu: CPU whose TLB should be reset; must not be running
+ */
+void tlb_reset(CPUState *cpu);
 /**
  * tlb_flush_page:
  * @cpu: CPU whose TLB should be flushed
@@ -259,6 +277,15 @@ void tb_invalidate_phys_addr(AddressSpace *as, hwaddr addr);
 void probe_write(CPUArchState *env, target_ulong addr, int mmu_idx,
                  uintptr_t retaddr);
 #else
+static inline void tlb_init(CPUState *cpu)
+{
+}
+static inline void tlb_destroy(CPUState *cpu)
+{
+}
+static inline void tlb_reset(CPUState *cpu)
+{
+}
 static inline void tlb_flush_page(CPUState *cpu, target_ulong addr)
 {
 }
@@ -350,6 +377,7 @@ struct TranslationBlock {
 #define CF_NOCACHE     0x10000 /* To be freed after execution */
 #define CF_USE_ICOUNT  0x20000
 #define CF_IGNORE_ICOUNT 0x40000 /* Do not generate icount code */
+#define CF_SUPERBLOCK  0x80000 /* Translated along a hot trace */
 
     uint16_t invalid;
 
@@ -391,6 +419,11 @@ struct TranslationBlock {
     uintptr_t jmp_list_next[2];
     uintptr_t jmp_list_first;
 
+    /* Exit profile used to form superblocks: how often each direct exit
+       was taken and the guest pc it last led to. */
+    uint32_t exit_count[2];
+    target_ulong exit_pc[2];
+
 #ifdef CONFIG_LLVM
     /* pointer to LLVM translated code */
     struct TCGLLVMContext *tcg_llvm_context;
@@ -402,11 +435,49 @@ struct TranslationBlock {
     uint8_t *llvm_tc_ptr;
     uint8_t *llvm_tc_end;
     struct TranslationBlock* llvm_tb_next[2];
+    /* dispatch count used to find hot TBs in tiered mode */
+    uint32_t llvm_exec_count;
 #endif
 
 };
 
+/* A hot path through a chain of TBs, handed to the front end while a
+ * CF_SUPERBLOCK TB is translated.  Each entry names a conditional or
+ * direct branch by the address of the instruction following it and
+ * says which way the trace continues.
+ */
+#define TB_TRACE_MAX_BRANCHES 4
+
+typedef struct TBTrace {
+    int nb_branches;
+    struct {
+        target_ulong fallthrough;
+        bool taken;
+    } branch[TB_TRACE_MAX_BRANCHES];
+} TBTrace;
+
+/* Returns the recorded direction for the branch ending at @fallthrough,
+   or -1 if it is not on the trace. */
+static inline int tb_trace_direction(const TBTrace *trace,
+                                     target_ulong fallthrough)
+{
+    int i;
+
+    if (trace) {
+        for (i = 0; i < trace->nb_branches; i++) {
+            if (trace->branch[i].fallthrough == fallthrough) {
+                return trace->branch[i].taken;
+            }
+        }
+    }
+    return -1;
+}
+
 void tb_free(TranslationBlock *tb);
+#ifdef CONFIG_LLVM
+void tb_tier_up(CPUState *cpu, TranslationBlock *tb);
+void tb_tier_unchain(TranslationBlock *tb);
+#endif
 void tb_flush(CPUState *cpu);
 void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr);
 
@@ -565,6 +636,10 @@ extern bool exit_request;
 
 extern int generate_llvm;
 extern int execute_llvm;
+extern int tiered_llvm;
+extern uint32_t tiered_llvm_threshold;
+extern int tiered_llvm_lifting;
+extern uint32_t superblock_threshold;
 extern const int has_llvm_engine;
 
 #endif
@@ -36,6 +36,8 @@ struct TBContext {
     int nb_tbs;
     /* any access to the tbs or the page table must use this lock */
     QemuMutex tb_lock;
+    /* hot path to follow while translating a CF_SUPERBLOCK TB */
+    const struct TBTrace *trace;
 
     /* statistics */
     unsigned tb_flush_count;
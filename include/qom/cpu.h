@@ -356,6 +356,8 @@ struct CPUState {
 
     /* ice debug support */
     QTAILQ_HEAD(breakpoints_head, CPUBreakpoint) breakpoints;
+    // The breakpoints above with an rr_instr_count, sorted by it
+    GArray *rr_breakpoints;
 
     QTAILQ_HEAD(watchpoints_head, CPUWatchpoint) watchpoints;
     CPUWatchpoint *watchpoint_hit;
@@ -392,12 +394,18 @@ struct CPUState {
     int32_t exception_index; /* used by m68k TCG */
     uint64_t rr_guest_instr_count;
     uint64_t panda_guest_pc;
+    // Host-to-guest PC lookups of this vCPU (see panda_update_guest_pc)
+    struct PandaPCCacheEntry *panda_pc_cache;
+    // Per-vCPU plugin state, one slot per loaded plugin (see panda_get_cpu_ctx)
+    void *panda_plugin_ctx[16];
 
     // Used for rr reverse debugging
     uint8_t reverse_flags;
     uint64_t last_gdb_instr; // Instruction count from which we last sent a GDB command
     uint64_t last_bp_hit_instr; // Last bp observed during this checkpoint run
     uint64_t temp_rr_bp_instr; // Saved bp. Used by rstep/rcont, which disables bp to move forward, then restores on next tb in cpu-exec.c
+    uint64_t rr_translated_instr; // Instr count at which the last block was translated
+    CPUWatchpoint *rr_lastwrite_wp; // One-shot write watchpoint set by the rrlastwrite gdb command
 
     /* Used to keep track of an outstanding cpu throttle thread for migration
      * autoconverge
@@ -1001,16 +1009,39 @@ static inline bool cpu_breakpoint_test(CPUState *cpu, vaddr pc, int mask)
     return false;
 }
 
-/* Return true if address matches an installed breakpoint.  */
+/* Index of the first rr breakpoint at or after instruction cur_instr_count. */
+static inline guint cpu_rr_breakpoint_lower_bound(CPUState *cpu, uint64_t cur_instr_count)
+{
+    guint lo = 0, hi = cpu->rr_breakpoints->len;
+
+    while (lo < hi) {
+        guint mid = lo + (hi - lo) / 2;
+        if (g_array_index(cpu->rr_breakpoints, CPUBreakpoint *, mid)->rr_instr_count
+                < cur_instr_count) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* Return true if an rr breakpoint is set at instruction cur_instr_count.  */
 static inline bool cpu_rr_breakpoint_test(CPUState *cpu,  uint64_t cur_instr_count, int mask)
 {
-    CPUBreakpoint *bp;
+    guint i;
 
-    if (unlikely(!QTAILQ_EMPTY(&cpu->breakpoints))) {
-        QTAILQ_FOREACH(bp, &cpu->breakpoints, entry) {
-           if (bp->rr_instr_count != 0 && bp->rr_instr_count == cur_instr_count && (bp->flags & mask)) {
-                return true;
-            }
+    if (likely(cpu->rr_breakpoints->len == 0)) {
+        return false;
+    }
+    for (i = cpu_rr_breakpoint_lower_bound(cpu, cur_instr_count);
+         i < cpu->rr_breakpoints->len; i++) {
+        CPUBreakpoint *bp = g_array_index(cpu->rr_breakpoints, CPUBreakpoint *, i);
+        if (bp->rr_instr_count != cur_instr_count) {
+            break;
+        }
+        if (bp->flags & mask) {
+            return true;
         }
     }
     return false;
@@ -1024,6 +1055,7 @@ void cpu_watchpoint_remove_by_ref(CPUState *cpu, CPUWatchpoint *watchpoint);
 void cpu_watchpoint_remove_all(CPUState *cpu, int mask);
 
 void cpu_rcont_check_restore(CPUState* cpu, uint64_t rr_instr_count);
+uint64_t cpu_rr_next_stop(CPUState *cpu, uint64_t rr_instr_count);
 
 //#ifdef CONFIG_SOFTMMU
 //#include "../exec/cpu-defs.h"
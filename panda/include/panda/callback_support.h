@@ -19,6 +19,9 @@ void panda_callbacks_before_cpu_exec_exit(CPUState *cpu, bool ranBlock);
 // target-i386/translate.c
 bool panda_callbacks_insn_translate(CPUState *env, target_ulong pc);
 bool panda_callbacks_after_insn_translate(CPUState *env, target_ulong pc);
+// translate-all.c
+bool panda_has_insn_translate_callbacks(void);
+bool panda_cb_serialize_translate_begin(void);
 // softmmu_template.h
 void panda_callbacks_before_mem_read(CPUState *env, target_ulong pc, target_ulong addr,
                                      uint32_t data_size, void *ram_ptr);
@@ -22,6 +22,7 @@ extern "C" {
 #include "qemu/osdep.h"
 #include "qemu-common.h"
 #include "cpu.h"
+#include "qemu/rcu.h"
 
 #include "panda/common.h"
 #include "exec/exec-all.h"
@@ -13,3 +13,4 @@
 PANDAENDCOMMENT */
 DEF_HELPER_1(panda_insn_exec, void, tl)
 DEF_HELPER_1(panda_after_insn_exec, void, tl)
+DEF_HELPER_0(panda_rcont_bp_hit, void)
@@ -20,16 +20,27 @@ PANDAENDCOMMENT */
 void helper_panda_insn_exec(target_ulong pc) {
     // PANDA instrumentation: before basic block
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_INSN_EXEC);
     for(plist = panda_cbs[PANDA_CB_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.insn_exec(first_cpu, pc);
+        plist->entry.insn_exec(current_cpu, pc);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 void helper_panda_after_insn_exec(target_ulong pc) {
     // PANDA instrumentation: after basic block
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_INSN_EXEC);
     for(plist = panda_cbs[PANDA_CB_AFTER_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_insn_exec(first_cpu, pc);
+        plist->entry.after_insn_exec(current_cpu, pc);
+    }
+    panda_cb_serialize_end(serialized);
+}
+
+void helper_panda_rcont_bp_hit(void) {
+    // First pass of a gdb reverse-continue: remember the latest breakpoint hit
+    if (current_cpu->reverse_flags & GDB_RCONT) {
+        current_cpu->last_bp_hit_instr = current_cpu->rr_guest_instr_count;
     }
 }
 
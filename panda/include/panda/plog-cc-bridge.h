@@ -29,6 +29,9 @@ void pandalog_cc_init_read_bwd(const char* path);
 //Open C++ pandalog for write
 void pandalog_cc_init_write(const char* path);
 
+//Open C++ pandalog for write in the columnar format
+void pandalog_cc_init_write_columnar(const char* path);
+
 //Seek to an instr
 void pandalog_cc_seek(uint64_t instr);
 
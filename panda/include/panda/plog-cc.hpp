@@ -25,6 +25,7 @@ extern "C" {
 #include <memory>
 #include <stdint.h>
 #include "plog.pb.h"
+#include "panda/plog-columnar.hpp"
 
 #define PL_CURRENT_VERSION 2
 // compression level
@@ -83,17 +84,23 @@ class PandaLog {
     PandalogCcDir dir;
     PandalogCcChunk chunk;
     uint32_t chunk_num;
+    // set when writing a columnar log instead (open_write_columnar)
+    PandaLogColumnar *columnar;
 
 public:    
     //default constructor
     PandaLog(): mode(PL_MODE_UNKNOWN){
         mode = PL_MODE_UNKNOWN;
         chunk_num = 0;
+        columnar = NULL;
     };
 
     // open pandalog for write with this uncompressed chunk size
     void open_write(const char *path, uint32_t chunk_size);
 
+    // open a columnar pandalog (see plog-columnar.hpp) for write
+    void open_write_columnar(const char *path);
+
     void open_read(const char *path, PlMode mode);
 
     // open pandalog for reading in forward direction
@@ -0,0 +1,138 @@
+/**
+ *
+ * Columnar export of a pandalog, for bulk analysis that only needs a few
+ * fields. See plog-columnar.cpp for the file format.
+ *
+ * Entries are split into tables by which LogEntry fields they set, e.g.
+ * every entry that sets only "tainted_branch" lands in table
+ * "tainted_branch". Each table stores one zlib-compressed column per
+ * protobuf field, written in row groups that record the range of
+ * instruction counts they cover. The schema is taken from the protobuf
+ * descriptors, so the file describes itself and new plugin messages need
+ * no extra code.
+ *
+ */
+
+#ifndef __PANDALOG_COLUMNAR_H_
+#define __PANDALOG_COLUMNAR_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "plog.pb.h"
+
+#define PLC_MAGIC "PANDACOL"
+#define PLC_VERSION 1
+// rows per table buffered before a row group is compressed and written
+#define PLC_ROWGROUP_ROWS (64 * 1024)
+
+// column value types
+enum PlcType : uint8_t {
+    PLC_I32 = 1,
+    PLC_I64,
+    PLC_U32,
+    PLC_U64,
+    PLC_F32,
+    PLC_F64,
+    PLC_BOOL,       // one byte per value
+    PLC_STRING,     // u32 index into the row group's dictionary
+    PLC_BYTES,      // u32 length, then the bytes
+};
+
+// a compressed run of bytes in the file
+struct PlcStream {
+    uint64_t offset;
+    uint32_t zsize;
+    uint32_t size;
+};
+
+// one column of one row group
+struct PlcColumnChunk {
+    uint64_t num_values;
+    PlcStream values;
+    PlcStream nulls;    // bitmap of absent values, zsize 0 if none are
+    PlcStream dict;     // PLC_STRING: u32 length, then the bytes, per entry
+    uint32_t dict_size; // number of dictionary entries
+};
+
+struct PlcColumn {
+    std::string name;
+    PlcType type;
+
+    // row group being filled
+    std::string values;
+    std::vector<uint8_t> nulls;
+    bool any_null;
+    uint64_t num_values;
+    std::unordered_map<std::string, uint32_t> dict_index;
+    std::string dict;
+
+    std::vector<PlcColumnChunk> chunks;
+
+    void put(const void *v, size_t n);
+    void put_null(size_t n);
+    void put_string(const std::string &s);
+    void put_bytes(const std::string &s);
+    void reset();
+};
+
+struct PlcRowGroup {
+    uint64_t num_rows;
+    uint64_t min_instr;
+    uint64_t max_instr;
+};
+
+struct PlcTable {
+    std::string name;
+    std::vector<const google::protobuf::FieldDescriptor *> fields;
+    std::vector<PlcColumn> columns;
+    std::vector<PlcRowGroup> row_groups;
+    PlcRowGroup cur;
+};
+
+class PandaLogColumnar {
+    FILE *file;
+    std::string filename;
+    uint64_t rowgroup_rows;
+    std::vector<std::unique_ptr<PlcTable>> tables;
+    std::map<std::string, PlcTable *> tables_by_name;
+    // number of columns a message type expands to
+    std::unordered_map<const google::protobuf::Descriptor *, size_t> widths;
+
+public:
+    PandaLogColumnar(): file(NULL), rowgroup_rows(PLC_ROWGROUP_ROWS) {}
+
+    bool open(const char *path, uint64_t rowgroup_rows = PLC_ROWGROUP_ROWS);
+
+    void write_entry(const panda::LogEntry &entry);
+
+    // flushes the row groups and writes the catalog
+    int close(void);
+
+private:
+    PlcTable *get_table(const panda::LogEntry &entry,
+            std::vector<const google::protobuf::FieldDescriptor *> &set);
+
+    size_t width(const google::protobuf::FieldDescriptor *f);
+    size_t width(const google::protobuf::Descriptor *d);
+
+    void add_columns(PlcTable *t, const google::protobuf::FieldDescriptor *f,
+            const std::string &prefix, std::vector<const google::protobuf::Descriptor *> &path);
+
+    size_t put_field(PlcTable *t, const google::protobuf::Message *m,
+            const google::protobuf::FieldDescriptor *f, size_t col);
+    void put_message(PlcTable *t, const google::protobuf::Message *m,
+            const google::protobuf::Descriptor *d, size_t col);
+    void put_scalar(PlcColumn &c, const google::protobuf::Message &m,
+            const google::protobuf::FieldDescriptor *f, int index);
+
+    PlcStream write_stream(const void *buf, size_t size);
+    void flush_row_group(PlcTable *t);
+    void write_catalog(void);
+};
+
+#endif
@@ -671,7 +671,9 @@ typedef union panda_cb {
     void (* cbaddr)(void);
 } panda_cb;
 
-// Doubly linked list that stores a callback, along with its owner
+// Doubly linked list that stores a callback, along with its owner.
+// Readers walk the list without locks (see panda_cb_serialize_begin);
+// writers hold panda_cbs_lock and publish links with atomic_rcu_set.
 typedef struct _panda_cb_list panda_cb_list;
 struct _panda_cb_list {
     panda_cb entry;
@@ -679,6 +681,8 @@ struct _panda_cb_list {
     panda_cb_list *next;
     panda_cb_list *prev;
     bool enabled;
+    bool mt_safe;           // owner declared itself MT-safe
+    struct rcu_head rcu;
 };
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist);
 void panda_enable_plugin(void *plugin);
@@ -688,8 +692,19 @@ void panda_disable_plugin(void *plugin);
 typedef struct panda_plugin {
     char name[256];     // Currently basename(filename)
     void *plugin;       // Handle to the plugin (for use with dlsym())
+    bool mt_safe;       // Callbacks may run concurrently on several vCPUs
+    int ctx_slot;       // Index into CPUState.panda_plugin_ctx
 } panda_plugin;
 
+// Multi-threaded TCG support. Outside of record/replay, PANDA can run
+// with -accel tcg,thread=multi. Callbacks of plugins that did not call
+// panda_declare_mt_safe() are then serialized by a global lock.
+void   panda_declare_mt_safe(void *plugin);
+bool   panda_cb_serialize_begin(panda_cb_type type);
+void   panda_cb_serialize_end(bool serialized);
+void * panda_get_cpu_ctx(CPUState *cpu, void *plugin);
+void   panda_set_cpu_ctx(CPUState *cpu, void *plugin, void *ctx);
+
 void   panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb);
 void   panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb);
 void   panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb);
@@ -712,11 +727,18 @@ void panda_enable_memcb(void);
 void panda_disable_memcb(void);
 void panda_enable_llvm(void);
 void panda_disable_llvm(void);
+void panda_enable_tiered_llvm(uint32_t threshold);
+void panda_disable_tiered_llvm(void);
 void panda_enable_llvm_helpers(void);
 void panda_disable_llvm_helpers(void);
 void panda_enable_tb_chaining(void);
 void panda_disable_tb_chaining(void);
+void panda_enable_superblocks(uint32_t threshold);
+void panda_disable_superblocks(void);
 void panda_memsavep(FILE *f);
+void panda_enable_dirty_tracking(void);
+void panda_disable_dirty_tracking(void);
+uint64_t panda_sync_dirty_pages(unsigned long *bitmap);
 
 extern bool panda_update_pc;
 extern bool panda_use_memcb;
@@ -81,6 +81,31 @@ void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
   ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
 }									
 
+/*
+  Same as PPP_CB_BOILERPLATE, but calls notify() whenever a callback is
+  added.  Plugin A can use this to keep state derived from the set of
+  registered callbacks (e.g. which events anybody listens to) up to date
+  instead of checking every callback list on its hot path.
+*/
+
+#define PPP_CB_BOILERPLATE_NOTIFY(cb_name, notify)	\
+cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB];	\
+int ppp_##cb_name##_num_cb = 0;				\
+							\
+void ppp_add_cb_##cb_name(cb_name##_t fptr) {			\
+  assert (ppp_##cb_name##_num_cb < PPP_MAX_CB);				\
+  ppp_##cb_name##_cb[ppp_##cb_name##_num_cb] = fptr;			\
+  ppp_##cb_name##_num_cb += 1;						\
+  notify();								\
+}									\
+									\
+void ppp_add_cb_##cb_name##_slot(cb_name##_t fptr, int slot_num) {	\
+  assert (slot_num < PPP_MAX_CB);					\
+  ppp_##cb_name##_cb[slot_num] = fptr;					\
+  ppp_##cb_name##_num_cb = MAX(slot_num, ppp_##cb_name##_num_cb);	\
+  notify();								\
+}
+
 #define PPP_CB_EXTERN(cb_name) \
 extern cb_name##_t ppp_##cb_name##_cb[PPP_MAX_CB]; \
 extern int ppp_##cb_name##_num_cb;
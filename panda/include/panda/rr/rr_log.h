@@ -51,13 +51,9 @@ typedef struct {
     int len;
 } RR_cpu_reg_write_args;
 
-typedef struct RR_MapList {
-    void *ptr;
-    hwaddr addr;
-    hwaddr len;
-    uint32_t crc;
-    QLIST_ENTRY(RR_MapList) link;
-} RR_MapList;
+// DMA mappings that devices write into, tracked while recording
+void rr_tracked_mem_region_add(hwaddr addr, void* ptr, hwaddr len);
+void rr_tracked_mem_region_remove(void* ptr, hwaddr len);
 
 void rr_cpu_physical_memory_unmap_record(hwaddr addr, uint8_t* buf,
                                          hwaddr len, int is_write);
@@ -145,6 +141,7 @@ typedef struct RR_log_t {
     unsigned long long
         size; // for a log being opened for read, this will be the size in bytes
     uint64_t bytes_read;
+    const uint8_t* map; // replay log mapped read-only (-replay-shared), or NULL
 } RR_log;
 
 RR_log_entry* rr_get_queue_head(void);
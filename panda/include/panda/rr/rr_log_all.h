@@ -60,6 +60,7 @@ extern volatile int rr_end_record_requested;
 extern volatile int rr_end_replay_requested;
 extern char* rr_requested_name;
 extern char* rr_snapshot_name;
+extern int rr_replay_shared;
 
 // used from monitor.c
 int rr_do_begin_record(const char* name, CPUState* cpu_state);
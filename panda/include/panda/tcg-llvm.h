@@ -69,6 +69,14 @@ extern struct TCGLLVMRuntime tcg_llvm_runtime;
 void tcg_llvm_initialize(void);
 void tcg_llvm_destroy(void);
 
+void tcg_llvm_initialize_tiered(void);
+void tcg_llvm_tier_stop(void);
+int tcg_llvm_tier_trylock(void);
+void tcg_llvm_tier_unlock(void);
+void tcg_llvm_tier_gen_code(struct TCGLLVMContext *l, struct TCGContext *s,
+                            struct TranslationBlock *tb);
+void tcg_llvm_tier_flush(void);
+
 void tcg_llvm_tb_alloc(struct TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
 
@@ -105,7 +113,7 @@ private:
     TCGLLVMContextPrivate* m_private;
 
 public:
-    TCGLLVMContext();
+    TCGLLVMContext(bool tiered = false);
     ~TCGLLVMContext();
 
     llvm::LLVMContext& getLLVMContext();
@@ -120,6 +128,7 @@ public:
 
     void generateCode(struct TCGContext *s,
                       struct TranslationBlock *tb);
+    uint8_t *compileTieredFunction(llvm::Function *f, uint8_t **tc_end);
 
     void writeModule(const char *path);
 };
@@ -58,6 +58,11 @@
 #include <iostream>
 #include <sstream>
 #include <map>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "panda/cheaders.h"
 #include "panda/tcg-llvm.h"
@@ -100,6 +105,10 @@ struct TCGLLVMContextPrivate {
     /* Function pass manager (used for optimizing the code) */
     FunctionPassManager *m_functionPassManager;
 
+    /* Tiered mode: JIT at -O2 and run the O2 function passes on hot TBs */
+    bool m_tiered;
+    FunctionPassManager *m_tierPassManager;
+
     /* Count of generated translation blocks */
     int m_tbCount;
 
@@ -130,7 +139,7 @@ struct TCGLLVMContextPrivate {
     std::string m_CPUArchStateName;
 
 public:
-    TCGLLVMContextPrivate();
+    TCGLLVMContextPrivate(bool tiered);
     ~TCGLLVMContextPrivate();
 
     void deleteExecutionEngine() {
@@ -144,6 +153,8 @@ public:
         return m_functionPassManager;
     }
 
+    uint8_t *compileTieredFunction(Function *f, uint8_t **tc_end);
+
     /* Shortcuts */
     llvm::Type* intType(int w) { return IntegerType::get(m_context, w); }
     llvm::Type* intPtrType(int w) { return PointerType::get(intType(w), 0); }
@@ -298,8 +309,9 @@ public:
     unsigned GetNumStubSlabs() { return m_base->GetNumStubSlabs(); }
 };
 
-TCGLLVMContextPrivate::TCGLLVMContextPrivate()
-    : m_context(getGlobalContext()), m_builder(m_context), m_tbCount(0),
+TCGLLVMContextPrivate::TCGLLVMContextPrivate(bool tiered)
+    : m_context(getGlobalContext()), m_builder(m_context),
+      m_tiered(tiered), m_tierPassManager(NULL), m_tbCount(0),
       m_tcgContext(NULL), m_tbFunction(NULL)
 {
     std::memset(m_values, 0, sizeof(m_values));
@@ -319,10 +331,12 @@ TCGLLVMContextPrivate::TCGLLVMContextPrivate()
 
     /* Create JIT with optimization level set to none because some optimizations
      * (I think specifically, one dealing with simplifying CFGs) was messing up
-     * our log processing.
+     * our log processing. Tiered mode never feeds the taint system, so it
+     * can afford the full code generator.
      */
     m_executionEngine = ExecutionEngine::createJIT(
-            m_module, &error, m_jitMemoryManager, CodeGenOpt::None);
+            m_module, &error, m_jitMemoryManager,
+            m_tiered ? CodeGenOpt::Default : CodeGenOpt::None);
     if(m_executionEngine == NULL) {
         std::cerr << "Unable to create LLVM JIT: " << error << std::endl;
         exit(1);
@@ -334,6 +348,16 @@ TCGLLVMContextPrivate::TCGLLVMContextPrivate()
 
     m_functionPassManager->doInitialization();
 
+    if (m_tiered) {
+        PassManagerBuilder builder;
+        builder.OptLevel = 2;
+        m_tierPassManager = new FunctionPassManager(m_module);
+        m_tierPassManager->add(
+                new DataLayout(*m_executionEngine->getDataLayout()));
+        builder.populateFunctionPassManager(*m_tierPassManager);
+        m_tierPassManager->doInitialization();
+    }
+
 #define XSTR(x) STR(x)
 #define STR(x) #x
     m_CPUArchStateName = XSTR(CPUArchState);
@@ -354,6 +378,11 @@ TCGLLVMContextPrivate::~TCGLLVMContextPrivate()
         m_functionPassManager = NULL;
     }
 
+    if (m_tierPassManager) {
+        delete m_tierPassManager;
+        m_tierPassManager = NULL;
+    }
+
     // the following line will also delete
     // m_moduleProvider, m_module and all its functions
     if (m_executionEngine) {
@@ -1579,11 +1608,25 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
     }
 }
 
+/* Optimize and JIT the LLVM function of a hot TB.  Returns its entry point
+ * and sets *tc_end; publishing them to the TB is up to the caller.
+ */
+uint8_t *TCGLLVMContextPrivate::compileTieredFunction(Function *f,
+                                                      uint8_t **tc_end)
+{
+    m_tierPassManager->run(*f);
+
+    uint8_t *tc_ptr = (uint8_t*) m_executionEngine->getPointerToFunction(f);
+    assert(tc_ptr);
+    *tc_end = tc_ptr + m_jitMemoryManager->getFunctionSize(f);
+    return tc_ptr;
+}
+
 /***********************************/
 /* External interface for C++ code */
 
-TCGLLVMContext::TCGLLVMContext()
-        : m_private(new TCGLLVMContextPrivate)
+TCGLLVMContext::TCGLLVMContext(bool tiered)
+        : m_private(new TCGLLVMContextPrivate(tiered))
 {
 }
 
@@ -1626,6 +1669,11 @@ void TCGLLVMContext::generateCode(TCGContext *s, TranslationBlock *tb)
     m_private->generateCode(s, tb);
 }
 
+uint8_t *TCGLLVMContext::compileTieredFunction(Function *f, uint8_t **tc_end)
+{
+    return m_private->compileTieredFunction(f, tc_end);
+}
+
 void TCGLLVMContext::writeModule(const char *path)
 {
     std::string Error;
@@ -1651,10 +1699,167 @@ void tcg_llvm_initialize()
 void tcg_llvm_destroy()
 {
     assert(tcg_llvm_ctx != NULL);
+    tcg_llvm_tier_stop();
     delete tcg_llvm_ctx;
     tcg_llvm_ctx = NULL;
 }
 
+/*****************************/
+/* Tiered compilation        */
+
+/* Hot TBs are lifted to LLVM IR on the vCPU thread, which is cheap, and
+ * handed to a single background thread that runs the O2 passes and the
+ * JIT, which is not.  The module is not thread-safe, so every use of it is
+ * serialized by tier_llvm_lock; the vCPU only try-locks it, and leaves a
+ * TB to be promoted later rather than wait for a compile in flight.
+ *
+ * A flush bumps tier_generation and must not wait for the compile either,
+ * so it doesn't touch the module: the functions of the flushed TBs go on
+ * tier_dead_functions and the worker erases them the next time it holds
+ * tier_llvm_lock.  Jobs queued before the flush refer to freed TBs and are
+ * dropped, and a compile that was in flight is not published.  Once a TB's
+ * LLVM code is published, the jumps chained to its TCG code are reset.
+ */
+struct TierJob {
+    TranslationBlock *tb;
+    Function *function;
+    unsigned generation;
+};
+
+static std::mutex tier_llvm_lock;
+static std::mutex tier_queue_lock;
+static std::condition_variable tier_queue_cond;
+static std::deque<TierJob> tier_queue;
+static std::vector<Function *> tier_dead_functions;
+static unsigned tier_generation;
+static bool tier_stop;
+static std::thread tier_thread;
+
+/* Called with tier_llvm_lock held.  */
+static void tier_erase_dead_functions(void)
+{
+    std::vector<Function *> dead;
+    {
+        std::lock_guard<std::mutex> ql(tier_queue_lock);
+        dead.swap(tier_dead_functions);
+    }
+    for (Function *f : dead) {
+        f->eraseFromParent();
+    }
+}
+
+static void tier_worker(void)
+{
+    for (;;) {
+        TierJob job;
+        {
+            std::unique_lock<std::mutex> ql(tier_queue_lock);
+            tier_queue_cond.wait(ql, [] {
+                return tier_stop || !tier_queue.empty();
+            });
+            if (tier_stop) {
+                return;
+            }
+            job = tier_queue.front();
+            tier_queue.pop_front();
+        }
+
+        uint8_t *tc_ptr, *tc_end;
+        {
+            std::lock_guard<std::mutex> ll(tier_llvm_lock);
+            tier_erase_dead_functions();
+            {
+                /* A flush since the job was queued put its function on the
+                   dead list, and it is gone now. */
+                std::lock_guard<std::mutex> ql(tier_queue_lock);
+                if (job.generation != tier_generation) {
+                    continue;
+                }
+            }
+            tc_ptr = tcg_llvm_ctx->compileTieredFunction(job.function, &tc_end);
+        }
+
+        /* tb_flush bumps tier_generation with tb_lock held, so the TB is
+           still live if the generation matches under tb_lock.  Taking
+           tb_lock only after tier_llvm_lock is released keeps the lock
+           order of the vCPU threads, which lift TBs with tb_lock held.
+           The vCPU thread picks up llvm_tc_ptr the next time it dispatches
+           the TB, and keeps running the TCG code until then. */
+        tb_lock();
+        if (job.generation == tier_generation) {
+            job.tb->llvm_tc_end = tc_end;
+            __atomic_store_n(&job.tb->llvm_tc_ptr, tc_ptr, __ATOMIC_RELEASE);
+            tb_tier_unchain(job.tb);
+        }
+        tb_unlock();
+    }
+}
+
+void tcg_llvm_initialize_tiered()
+{
+    assert(tcg_llvm_ctx == NULL);
+    assert(llvm_start_multithreaded());
+    tcg_llvm_ctx = new TCGLLVMContext(true);
+
+    tier_stop = false;
+    tier_thread = std::thread(tier_worker);
+}
+
+void tcg_llvm_tier_stop()
+{
+    if (!tier_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> ql(tier_queue_lock);
+        tier_stop = true;
+        tier_queue.clear();
+    }
+    tier_queue_cond.notify_one();
+    tier_thread.join();
+    /* The module, and the functions in it, go with the context. */
+    tier_dead_functions.clear();
+}
+
+/* Returns nonzero, with the module locked for tcg_llvm_tier_gen_code, if
+ * no compile is in flight.
+ */
+int tcg_llvm_tier_trylock()
+{
+    return tier_llvm_lock.try_lock();
+}
+
+void tcg_llvm_tier_unlock()
+{
+    tier_llvm_lock.unlock();
+}
+
+/* Called with the module locked by tcg_llvm_tier_trylock(); unlocks it.  */
+void tcg_llvm_tier_gen_code(TCGLLVMContext *l, TCGContext *s,
+                            TranslationBlock *tb)
+{
+    tier_erase_dead_functions();
+    l->generateCode(s, tb);
+    tier_llvm_lock.unlock();
+    if (tb->llvm_tc_ptr) {
+        /* Already JITed unoptimized, e.g. for CPU_LOG_LLVM_ASM. */
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> ql(tier_queue_lock);
+        tier_queue.push_back(TierJob { tb, tb->llvm_function, tier_generation });
+    }
+    tier_queue_cond.notify_one();
+}
+
+/* Called with tb_lock held, before the TBs are freed.  */
+void tcg_llvm_tier_flush()
+{
+    std::lock_guard<std::mutex> ql(tier_queue_lock);
+    tier_queue.clear();
+    tier_generation++;
+}
+
 void tcg_llvm_gen_code(TCGLLVMContext *l, TCGContext *s, TranslationBlock *tb)
 {
     l->generateCode(s, tb);
@@ -1664,12 +1869,21 @@ void tcg_llvm_tb_alloc(TranslationBlock *tb)
 {
     tb->tcg_llvm_context = NULL;
     tb->llvm_function = NULL;
+    tb->llvm_tc_ptr = NULL;
+    tb->llvm_tc_end = NULL;
+    tb->llvm_exec_count = 0;
 }
 
 void tcg_llvm_tb_free(TranslationBlock *tb)
 {
     if(tb->llvm_function) {
-        tb->llvm_function->eraseFromParent();
+        if (tier_thread.joinable()) {
+            /* The worker may be compiling it; see tier_erase_dead_functions. */
+            std::lock_guard<std::mutex> ql(tier_queue_lock);
+            tier_dead_functions.push_back(tb->llvm_function);
+        } else {
+            tb->llvm_function->eraseFromParent();
+        }
         tb->llvm_function = NULL;
         tb->llvm_tc_ptr = NULL;
         tb->llvm_tc_end = NULL;
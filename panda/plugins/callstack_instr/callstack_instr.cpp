@@ -489,7 +489,6 @@ bool init_plugin(void *self) {
     panda_cb pcb;
 
     panda_enable_memcb();
-    panda_enable_precise_pc();
 
     pcb.after_block_translate = after_block_translate;
     panda_register_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, pcb);
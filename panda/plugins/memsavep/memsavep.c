@@ -17,8 +17,13 @@ PANDAENDCOMMENT */
 
 #include "panda/plugin.h"
 #include "panda/rr/rr_log.h"
+#include "qemu/bitmap.h"
+#include "qemu/cutils.h"
+#include "qemu/thread.h"
 
 #include <stdio.h>
+#include <zlib.h>
+#include <glib.h>
 
 bool dump_done = false;
 
@@ -27,15 +32,183 @@ static double percent = -1;
 static uint64_t instr_count = 0;
 static const char *filename = NULL;
 
+// Incremental dumps (incremental=1).
+//
+// The first dump is a full image, every later one (every=N instructions)
+// holds only the pages written since the dump before it. Page data goes to
+// <file>, and <file>.idx gets one record per dump: a MemsavepIndexHeader
+// followed by npages MemsavepIndexEntry. Dump n is rebuilt by starting from
+// zeroed RAM and applying the entries of dumps 0..n in order (see
+// scripts/memsavep_restore.py). An entry of length 0 is a page of zeroes (or
+// MMIO), one of length page_size is stored as is, anything else is a
+// zlib-compressed page. Integers are little-endian.
+#define MEMSAVEP_IDX_MAGIC 0x564d5350 // "PSMV"
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t page_size;
+    uint64_t dump;          // 0 is the full image
+    uint64_t instr_count;
+    uint64_t ram_pages;
+    uint64_t npages;        // entries that follow
+} MemsavepIndexHeader;
+
+typedef struct __attribute__((packed)) {
+    uint64_t page;          // guest physical page number
+    uint64_t offset;        // of the page data in <file>
+    uint32_t length;
+} MemsavepIndexEntry;
+
+// Pages are compressed on worker threads in chunks of this many.
+#define PAGES_PER_CHUNK 256
+
+typedef struct {
+    uint32_t npages;
+    uint64_t pages[PAGES_PER_CHUNK];
+    uint8_t *host[PAGES_PER_CHUNK];     // NULL for MMIO
+    uint32_t lengths[PAGES_PER_CHUNK];
+    uint8_t *out;
+} DumpChunk;
+
+static bool incremental = false;
+static uint64_t every = 0;
+static uint64_t next_dump = 0;
+static uint64_t ndumps = 0;
+static FILE *data_file = NULL;
+static FILE *idx_file = NULL;
+static uint64_t data_off = 0;
+static unsigned long *dirty = NULL;
+static GThreadPool *pool = NULL;
+static QemuMutex chunks_lock;
+static QemuCond chunks_done;
+static uint32_t chunks_pending;
+
 bool init_plugin(void *);
 void uninit_plugin(void *);
 int before_block_exec(CPUState *env, TranslationBlock *tb);
 void dump_memory(void);
 
+static void compress_chunk(gpointer data, gpointer unused) {
+    DumpChunk *c = (DumpChunk *)data;
+    uint8_t *out = c->out;
+    uint32_t i;
+
+    for (i = 0; i < c->npages; i++) {
+        uint8_t *src = c->host[i];
+        uLongf len = compressBound(TARGET_PAGE_SIZE);
+        if (!src || buffer_is_zero(src, TARGET_PAGE_SIZE)) {
+            len = 0;
+        } else if (compress2(out, &len, src, TARGET_PAGE_SIZE, Z_BEST_SPEED) != Z_OK ||
+                   len >= TARGET_PAGE_SIZE) {
+            memcpy(out, src, TARGET_PAGE_SIZE);
+            len = TARGET_PAGE_SIZE;
+        }
+        c->lengths[i] = len;
+        out += len;
+    }
+
+    qemu_mutex_lock(&chunks_lock);
+    if (--chunks_pending == 0) qemu_cond_signal(&chunks_done);
+    qemu_mutex_unlock(&chunks_lock);
+}
+
+static uint8_t *page_host_ptr(uint64_t page) {
+    hwaddr xlat, l = TARGET_PAGE_SIZE;
+    MemoryRegion *mr = address_space_translate(&address_space_memory,
+            page << TARGET_PAGE_BITS, &xlat, &l, false);
+    if (!memory_access_is_direct(mr, false)) return NULL;
+    return (uint8_t *)qemu_map_ram_ptr(mr->ram_block, xlat);
+}
+
+static void dump_memory_incremental(void) {
+    uint64_t ram_pages = ram_size >> TARGET_PAGE_BITS;
+    uint64_t page, npages, nchunks, i;
+    DumpChunk *chunks;
+
+    bitmap_zero(dirty, ram_pages);
+    npages = panda_sync_dirty_pages(dirty);
+    if (ndumps == 0) {
+        bitmap_set(dirty, 0, ram_pages);
+        npages = ram_pages;
+    }
+
+    // Guest RAM doesn't change while we're in here, so workers can
+    // compress straight from it.
+    nchunks = (npages + PAGES_PER_CHUNK - 1) / PAGES_PER_CHUNK;
+    chunks = g_new0(DumpChunk, nchunks);
+    page = find_first_bit(dirty, ram_pages);
+    rcu_read_lock();
+    for (i = 0; i < nchunks; i++) {
+        DumpChunk *c = &chunks[i];
+        while (c->npages < PAGES_PER_CHUNK && page < ram_pages) {
+            c->pages[c->npages] = page;
+            c->host[c->npages] = page_host_ptr(page);
+            c->npages++;
+            page = find_next_bit(dirty, ram_pages, page + 1);
+        }
+        c->out = g_malloc(c->npages * compressBound(TARGET_PAGE_SIZE));
+    }
+
+    chunks_pending = nchunks;
+    for (i = 0; i < nchunks; i++) {
+        g_thread_pool_push(pool, &chunks[i], NULL);
+    }
+    qemu_mutex_lock(&chunks_lock);
+    while (chunks_pending) qemu_cond_wait(&chunks_done, &chunks_lock);
+    qemu_mutex_unlock(&chunks_lock);
+    rcu_read_unlock();
+
+    MemsavepIndexHeader hdr = {
+        .magic = MEMSAVEP_IDX_MAGIC,
+        .page_size = TARGET_PAGE_SIZE,
+        .dump = ndumps,
+        .instr_count = rr_get_guest_instr_count(),
+        .ram_pages = ram_pages,
+        .npages = npages,
+    };
+    fwrite(&hdr, sizeof(hdr), 1, idx_file);
+
+    uint64_t stored = 0;
+    for (i = 0; i < nchunks; i++) {
+        DumpChunk *c = &chunks[i];
+        uint8_t *out = c->out;
+        uint32_t j;
+        for (j = 0; j < c->npages; j++) {
+            MemsavepIndexEntry e = {
+                .page = c->pages[j],
+                .offset = data_off,
+                .length = c->lengths[j],
+            };
+            fwrite(&e, sizeof(e), 1, idx_file);
+            fwrite(out, c->lengths[j], 1, data_file);
+            out += c->lengths[j];
+            data_off += c->lengths[j];
+            stored += c->lengths[j];
+        }
+        g_free(c->out);
+    }
+    g_free(chunks);
+    fflush(idx_file);
+    fflush(data_file);
+
+    printf("memsavep: dump %" PRIu64 ": %" PRIu64 " pages, %" PRIu64 " bytes stored.\n",
+           ndumps, npages, stored);
+    ndumps++;
+}
+
 void dump_memory(void){
-    FILE* out = fopen(filename, "wb");
-    panda_memsavep(out);
-    fclose(out);
+    if (incremental) {
+        dump_memory_incremental();
+    } else {
+        FILE* out = fopen(filename, "wb");
+        panda_memsavep(out);
+        fclose(out);
+    }
+
+    if (every) {
+        next_dump = rr_get_guest_instr_count() + every;
+        return;
+    }
     dump_done = true;
 
     if(should_close_after_dump)
@@ -45,7 +218,12 @@ void dump_memory(void){
 int before_block_exec(CPUState *env, TranslationBlock *tb) {
     if (dump_done) return 0;
 
-    if (instr_count && rr_get_guest_instr_count() > instr_count) {
+    if (next_dump) {
+        if (rr_get_guest_instr_count() >= next_dump) {
+            printf("memsavep: %" PRIu64 " more instructions executed, saving memory to %s.\n", every, filename);
+            dump_memory();
+        }
+    } else if (instr_count && rr_get_guest_instr_count() > instr_count) {
         printf("memsavep: Instruction count reached, saving memory to %s.\n", filename);
         dump_memory();
     } else if (rr_get_percentage() > percent) {
@@ -64,15 +242,45 @@ bool init_plugin(void *self) {
     percent = panda_parse_double_opt(args, "percent", 200, "dump memory after a given percentage of the replay is reached");
     instr_count = panda_parse_uint64_opt(args, "instrcount", 0, "dump memory after a given instruction count is reached");
     filename = panda_parse_string_opt(args, "file", "memsavep.raw", "filename of the memory dump to create");
+    incremental = panda_parse_bool_opt(args, "incremental", "write compressed dumps holding only the pages changed since the previous one");
+    every = panda_parse_uint64_opt(args, "every", 0, "after the first dump, dump again every this many instructions (0 = dump once)");
+    uint32_t threads = panda_parse_uint32_opt(args, "threads", sysconf(_SC_NPROCESSORS_ONLN), "threads compressing incremental dumps");
 
     if(!instr_count && percent > 100.0){
         printf("memsavep: You should specify either one of percent or instrcount");
         return false;
     }
 
+    if (every && !incremental) {
+        printf("memsavep: every needs incremental, full dumps would overwrite each other.\n");
+        return false;
+    }
+
+    if (incremental) {
+        gchar *idx_name = g_strdup_printf("%s.idx", filename);
+        data_file = fopen(filename, "wb");
+        idx_file = fopen(idx_name, "wb");
+        g_free(idx_name);
+        if (!data_file || !idx_file) {
+            perror("memsavep");
+            return false;
+        }
+        dirty = bitmap_new(ram_size >> TARGET_PAGE_BITS);
+        qemu_mutex_init(&chunks_lock);
+        qemu_cond_init(&chunks_done);
+        pool = g_thread_pool_new(compress_chunk, NULL, MAX(threads, 1), TRUE, NULL);
+        panda_enable_dirty_tracking();
+    }
+
     return true;
 }
 
 void uninit_plugin(void *self) {
-
+    if (incremental) {
+        panda_disable_dirty_tracking();
+        g_thread_pool_free(pool, FALSE, TRUE);
+        g_free(dirty);
+        if (data_file) fclose(data_file);
+        if (idx_file) fclose(idx_file);
+    }
 }
\ No newline at end of file
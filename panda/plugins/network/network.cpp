@@ -17,8 +17,16 @@
 
 #define COMMENT_BUF_LEN 1024
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "panda/plugin.h"
+#include "panda/common.h"
 
+#include <pcap/pcap.h>
 #include <wireshark/config.h>
 #include <wiretap/wtap.h>
 
@@ -38,26 +46,77 @@ extern "C" {
 panda_arg_list *args;
 wtap_dumper *plugin_log;
 
+// Packets that passed the filter wait here for the writer thread, so the
+// replay never blocks on the capture file unless the writer falls more than
+// queue_limit bytes behind.
+struct Packet {
+    struct timeval ts;
+    uint64_t instr_count;
+    target_ulong asid;
+    std::vector<uint8_t> data;
+};
+
+static std::deque<Packet> queue;
+static size_t queue_bytes = 0;
+static size_t queue_limit;
+static std::mutex queue_lock;
+static std::condition_variable queue_nonempty;
+static std::condition_variable queue_drained;
+static bool writer_stop = false;
+static std::thread writer;
+
+static bool have_filter = false;
+static struct bpf_program filter;
+
+static void write_packet(const Packet &pkt);
+
+static void writer_loop() {
+    std::unique_lock<std::mutex> lock(queue_lock);
+    while (true) {
+        queue_nonempty.wait(lock, [] { return writer_stop || !queue.empty(); });
+        if (queue.empty()) break;
+
+        Packet pkt = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+        write_packet(pkt);
+        lock.lock();
+        queue_bytes -= pkt.data.size();
+        queue_drained.notify_one();
+    }
+}
+
 bool init_plugin(void *self) {
     panda_cb pcb;
 
-    int i;
-    char *tblog_filename = NULL;
+    const char *tblog_filename = NULL;
+    const char *filter_expr = NULL;
     args = panda_get_args("network");
-    if (args != NULL) {
-        for (i = 0; i < args->nargs; i++) {
-            // Format is sample:file=<file>
-            if (0 == strncmp(args->list[i].key, "file", 4)) {
-                tblog_filename = args->list[i].value;
-            }
-        }
-    }
+    tblog_filename = panda_parse_string_opt(args, "file", NULL, "pcapng file to write the traffic to");
+    filter_expr = panda_parse_string_opt(args, "filter", NULL, "only capture packets matching this pcap filter expression");
+    queue_limit = (size_t)MAX(panda_parse_uint32_opt(args, "buffer", 64, "MB of packets to queue for the writer thread"), 1) << 20;
 
     if (!tblog_filename) {
         fprintf(stderr, "Plugin 'network' needs argument: -panda-arg network:file=<file>\n");
         return false;
     }
 
+    if (filter_expr) {
+        pcap_t *dead = pcap_open_dead(DLT_EN10MB, 65535);
+        if (!dead) {
+            fprintf(stderr, "Plugin 'network': can't open pcap handle for filter\n");
+            return false;
+        }
+        if (pcap_compile(dead, &filter, filter_expr, 1, PCAP_NETMASK_UNKNOWN) == -1) {
+            fprintf(stderr, "Plugin 'network': can't compile filter '%s': %s\n",
+                    filter_expr, pcap_geterr(dead));
+            pcap_close(dead);
+            return false;
+        }
+        pcap_close(dead);
+        have_filter = true;
+    }
+
 #if VERSION_MAJOR >= 2 && VERSION_MINOR >= 6 && VERSION_MICRO >= 0
     wtap_init(false);
 #elif VERSION_MAJOR == 2 && VERSION_MINOR == 2 && VERSION_MICRO >= 4
@@ -82,6 +141,8 @@ bool init_plugin(void *self) {
         return false;
     }
 
+    writer = std::thread(writer_loop);
+
     pcb.replay_handle_packet = handle_packet;
     panda_register_callback(self, PANDA_CB_REPLAY_HANDLE_PACKET, pcb);
 
@@ -90,6 +151,13 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     printf("Unloading network plugin.\n");
+    {
+        std::lock_guard<std::mutex> lock(queue_lock);
+        writer_stop = true;
+    }
+    queue_nonempty.notify_one();
+    writer.join();
+    if (have_filter) pcap_freecode(&filter);
     panda_free_args(args);
     int err;
     wtap_dump_flush(plugin_log);
@@ -101,13 +169,36 @@ void uninit_plugin(void *self) {
 
 int handle_packet(CPUState *env, uint8_t *buf, int size, uint8_t direction,
                 uint64_t old_buf_addr) {
+    if (have_filter &&
+            !bpf_filter(filter.bf_insns, buf, size, size)) {
+        return 0;
+    }
+
+    Packet pkt;
+    gettimeofday(&pkt.ts, NULL);
+    pkt.instr_count = rr_get_guest_instr_count();
+    pkt.asid = panda_current_asid(env);
+    pkt.data.assign(buf, buf + size);
+
+    std::unique_lock<std::mutex> lock(queue_lock);
+    queue_drained.wait(lock, [] { return queue_bytes < queue_limit; });
+    queue_bytes += size;
+    queue.push_back(std::move(pkt));
+    lock.unlock();
+    queue_nonempty.notify_one();
+    return 0;
+}
+
+static void write_packet(const Packet &pkt) {
     int err;
     char *err_info;
-    struct timeval now_tv;
-    gettimeofday(&now_tv, NULL);
+    int size = pkt.data.size();
+    uint8_t *buf = const_cast<uint8_t *>(pkt.data.data());
+    struct timeval now_tv = pkt.ts;
     char comment_buf[COMMENT_BUF_LEN];
-    snprintf(comment_buf, COMMENT_BUF_LEN, "Guest instruction count: %" PRIu64,
-             rr_get_guest_instr_count());
+    snprintf(comment_buf, COMMENT_BUF_LEN,
+             "Guest instruction count: %" PRIu64 ", ASID: 0x" TARGET_FMT_lx,
+             pkt.instr_count, pkt.asid);
     gboolean ret = false;
 #if VERSION_MAJOR >= 2 && VERSION_MINOR >= 6 && VERSION_MICRO >= 3
     wtap_rec rec;
@@ -161,5 +252,4 @@ int handle_packet(CPUState *env, uint8_t *buf, int size, uint8_t direction,
 #endif
       fprintf(stderr, "\n");
     }
-    return 0;
 }
@@ -0,0 +1,249 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+// This needs to be defined before anything is included in order to get
+// the PRIx64 macro
+#define __STDC_FORMAT_MACROS
+
+#include "panda/plugin.h"
+#include "panda/rr/rr_log.h"
+#include "qemu/cutils.h"
+
+#include "osi/osi_types.h"
+#include "osi/osi_ext.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <zlib.h>
+
+// Dumps the mapped memory of one process at given instruction counts.
+//
+// File format (integers little-endian), one file per dump:
+//   header:  char magic[8] "PANDAPMD", uint32 version, uint32 page_size,
+//            uint64 instr_count, uint64 asid, uint64 pid,
+//            char name[16], uint32 nregions
+//   nregions times: uint64 base, uint64 size, uint32 name_len, name
+//   page records until one with vaddr ~0:
+//            uint64 vaddr, uint32 length, data
+// Pages that aren't mapped are left out. A record of length 0 is a page of
+// zeroes, one of length page_size is stored as is, anything else is a
+// zlib-compressed page.
+
+#define PMD_MAGIC "PANDAPMD"
+#define PMD_VERSION 1
+
+typedef struct __attribute__((packed)) {
+    char magic[8];
+    uint32_t version;
+    uint32_t page_size;
+    uint64_t instr_count;
+    uint64_t asid;
+    uint64_t pid;
+    char name[16];
+    uint32_t nregions;
+} PmdHeader;
+
+typedef struct __attribute__((packed)) {
+    uint64_t vaddr;
+    uint32_t length;
+} PmdPage;
+
+bool init_plugin(void *);
+void uninit_plugin(void *);
+int before_block_exec(CPUState *cpu, TranslationBlock *tb);
+
+static const char *proc_name = NULL;
+static uint64_t proc_pid = 0;
+static char *prefix = NULL;
+
+// Sorted instruction counts to dump at; dumps[next] is the next one.
+static uint64_t *dumps = NULL;
+static int ndumps = 0;
+static int next = 0;
+
+// Address space last seen not to belong to the process.
+static target_ulong other_asid = 0;
+
+static bool proc_matches(OsiProc *p) {
+    if (proc_pid) return p->pid == proc_pid;
+    return p->name && 0 == strncmp(p->name, proc_name, 15);
+}
+
+static int cmp_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// Streams the pages of [base, base + size) that are mapped.
+static uint64_t dump_region(CPUState *cpu, FILE *out, target_ulong base,
+                            target_ulong size, uint8_t *page, uint8_t *zbuf) {
+    uint64_t npages = 0;
+    target_ulong va = base & TARGET_PAGE_MASK;
+    target_ulong end = base + size;
+
+    for (; va < end && va >= (base & TARGET_PAGE_MASK); va += TARGET_PAGE_SIZE) {
+        if (-1 == panda_virtual_memory_rw(cpu, va, page, TARGET_PAGE_SIZE, false)) {
+            continue;
+        }
+
+        PmdPage rec = { .vaddr = va, .length = 0 };
+        const uint8_t *data = page;
+        if (!buffer_is_zero(page, TARGET_PAGE_SIZE)) {
+            uLongf len = compressBound(TARGET_PAGE_SIZE);
+            if (compress2(zbuf, &len, page, TARGET_PAGE_SIZE, Z_BEST_SPEED) == Z_OK &&
+                    len < TARGET_PAGE_SIZE) {
+                data = zbuf;
+                rec.length = len;
+            } else {
+                rec.length = TARGET_PAGE_SIZE;
+            }
+        }
+        fwrite(&rec, sizeof(rec), 1, out);
+        fwrite(data, rec.length, 1, out);
+        npages++;
+    }
+    return npages;
+}
+
+static void dump_process(CPUState *cpu, OsiProc *p) {
+    uint64_t icount = rr_get_guest_instr_count();
+    gchar *fname = g_strdup_printf("%s_%" PRIu64 "_%" PRIu64 ".pmd",
+                                   prefix, (uint64_t)p->pid, icount);
+    FILE *out = fopen(fname, "wb");
+    if (!out) {
+        perror(fname);
+        g_free(fname);
+        return;
+    }
+
+    GArray *ms = get_libraries(cpu, p);
+    uint32_t nregions = ms ? ms->len : 0;
+    uint32_t i;
+
+    PmdHeader hdr = {
+        .magic = PMD_MAGIC,
+        .version = PMD_VERSION,
+        .page_size = TARGET_PAGE_SIZE,
+        .instr_count = icount,
+        .asid = p->asid,
+        .pid = p->pid,
+        .nregions = nregions,
+    };
+    strncpy(hdr.name, p->name ? p->name : "", sizeof(hdr.name));
+    fwrite(&hdr, sizeof(hdr), 1, out);
+
+    for (i = 0; i < nregions; i++) {
+        OsiModule *m = &g_array_index(ms, OsiModule, i);
+        const char *name = m->file ? m->file : (m->name ? m->name : "");
+        uint64_t base = m->base, size = m->size;
+        uint32_t len = strlen(name);
+        fwrite(&base, sizeof(base), 1, out);
+        fwrite(&size, sizeof(size), 1, out);
+        fwrite(&len, sizeof(len), 1, out);
+        fwrite(name, len, 1, out);
+    }
+
+    uint8_t *page = g_malloc(TARGET_PAGE_SIZE);
+    uint8_t *zbuf = g_malloc(compressBound(TARGET_PAGE_SIZE));
+    uint64_t npages = 0;
+    for (i = 0; i < nregions; i++) {
+        OsiModule *m = &g_array_index(ms, OsiModule, i);
+        npages += dump_region(cpu, out, m->base, m->size, page, zbuf);
+    }
+    PmdPage end = { .vaddr = ~0ULL, .length = 0 };
+    fwrite(&end, sizeof(end), 1, out);
+
+    printf("procmemdump: wrote %s (%u regions, %" PRIu64 " pages) at instruction %" PRIu64 ".\n",
+           fname, nregions, npages, icount);
+    // The Windows OSI providers only report loaded modules; heap, stacks
+    // and other private allocations live in the VAD tree, which nothing
+    // walks yet.
+    if (panda_os_familyno == OS_WINDOWS) {
+        printf("procmemdump: warning: on Windows only the loaded modules of %s are dumped, "
+               "not its heaps, stacks or other allocations.\n", fname);
+    }
+
+    g_free(page);
+    g_free(zbuf);
+    if (ms) g_array_free(ms, true);
+    fclose(out);
+    g_free(fname);
+}
+
+int before_block_exec(CPUState *cpu, TranslationBlock *tb) {
+    if (next >= ndumps || rr_get_guest_instr_count() < dumps[next]) return 0;
+
+    // Due, but the page tables we need are only loaded while the process
+    // runs. Don't ask OSI again until the address space changes.
+    target_ulong asid = panda_current_asid(cpu);
+    if (other_asid && asid == other_asid) return 0;
+
+    OsiProc *p = get_current_process(cpu);
+    if (!p || !proc_matches(p)) {
+        other_asid = asid;
+        free_osiproc(p);
+        return 0;
+    }
+    other_asid = 0;
+
+    dump_process(cpu, p);
+    free_osiproc(p);
+
+    // Instruction counts passed while we were waiting count as done.
+    uint64_t icount = rr_get_guest_instr_count();
+    while (next < ndumps && dumps[next] <= icount) next++;
+    return 0;
+}
+
+bool init_plugin(void *self) {
+    panda_arg_list *args = panda_get_args("procmemdump");
+    proc_name = panda_parse_string_opt(args, "name", NULL, "name of the process to dump");
+    proc_pid = panda_parse_uint64_opt(args, "pid", 0, "pid of the process to dump (instead of name)");
+    prefix = g_strdup(panda_parse_string_opt(args, "prefix", "procmemdump", "prefix of the dump files"));
+    const char *at = panda_parse_string_opt(args, "instrcounts", NULL, "colon-separated instruction counts to dump at");
+
+    if (!proc_name && !proc_pid) {
+        printf("procmemdump: You should specify either one of name or pid\n");
+        return false;
+    }
+    if (!at) {
+        printf("procmemdump: You should specify instrcounts\n");
+        return false;
+    }
+
+    gchar **counts = g_strsplit(at, ":", -1);
+    ndumps = g_strv_length(counts);
+    dumps = g_new(uint64_t, ndumps);
+    for (int i = 0; i < ndumps; i++) {
+        dumps[i] = strtoull(counts[i], NULL, 0);
+    }
+    g_strfreev(counts);
+    qsort(dumps, ndumps, sizeof(uint64_t), cmp_u64);
+
+    panda_require("osi");
+    if (!init_osi_api()) return false;
+
+    panda_cb pcb = { .before_block_exec = before_block_exec };
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+
+    return true;
+}
+
+void uninit_plugin(void *self) {
+    if (next < ndumps) {
+        printf("procmemdump: %d dumps not taken, the process didn't run after instruction %" PRIu64 ".\n",
+               ndumps - next, dumps[next]);
+    }
+    g_free(dumps);
+    g_free(prefix);
+}
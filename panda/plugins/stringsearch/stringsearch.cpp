@@ -220,8 +220,6 @@ bool init_plugin(void *self) {
 
     if(!init_callstack_instr_api()) return false;
 
-    // Need this to get EIP with our callbacks
-    panda_enable_precise_pc();
     // Enable memory logging
     panda_enable_memcb();
 
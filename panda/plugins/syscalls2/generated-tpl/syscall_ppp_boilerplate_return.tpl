@@ -1,12 +1,12 @@
 {%- for arch, syscalls in syscalls_arch|dictsort -%}
 #ifdef {{architectures[arch].qemu_target}}
 {%- for syscall_name, syscall in syscalls|dictsort %}
-PPP_CB_BOILERPLATE(on_{{syscall.name}}_return)
+PPP_CB_BOILERPLATE_NOTIFY(on_{{syscall.name}}_return, syscall_subscriptions_changed)
 {%- endfor %}
 #endif
 {% endfor %}
-PPP_CB_BOILERPLATE(on_unknown_sys_return)
-PPP_CB_BOILERPLATE(on_all_sys_return)
-PPP_CB_BOILERPLATE(on_all_sys_return2)
+PPP_CB_BOILERPLATE_NOTIFY(on_unknown_sys_return, syscall_subscriptions_changed)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_return, syscall_subscriptions_changed)
+PPP_CB_BOILERPLATE_NOTIFY(on_all_sys_return2, syscall_subscriptions_changed)
 
 /* vim: set tabstop=4 softtabstop=4 noexpandtab ft=cpp: */
@@ -13,21 +13,50 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_{{os}}_{{arch}}(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef {{arch_conf.qemu_target}}
+	subs.assign({{max_syscall_no}} + 1, unknown);
+	{%- for syscall in syscalls %}
+	{%- if syscall.panda_noreturn %}
+	subs[{{syscall.no}}] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_{{syscall.name}}_enter) ? SYSCALL_SUB_ENTER : 0);
+	{%- else %}
+	subs[{{syscall.no}}] = all |
+		(PPP_CHECK_CB(on_{{syscall.name}}_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_{{syscall.name}}_return) ? SYSCALL_SUB_RETURN : 0);
+	{%- endif %}
+	{%- endfor %}
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 #ifdef {{arch_conf.qemu_target}}
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = {{arch_conf.rt_callno_reg}};
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -38,12 +67,15 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 		panda_noreturn = {{ 'true' if syscall.panda_noreturn else 'false' }};
 		{%- if syscall.args|length > 0 %}
 		{%- for arg in syscall.args %}
-		{{arg.emit_temp_assignment()}}
+		{{arg.emit_temp_declaration(init=True)}}
 		{%- endfor %}
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		if (PPP_CHECK_CB(on_{{syscall.name}}_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_{{syscall.name}}_return)))) {
 			{%- for arg in syscall.args %}
+			{{arg.emit_temp_assignment(declare=False)}}
+			{%- endfor %}
+			{%- for arg in syscall.args %}
 			{{arg.emit_memcpy_temp_to_ref()}}
 			{%- endfor %}
 		}
@@ -58,7 +90,7 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
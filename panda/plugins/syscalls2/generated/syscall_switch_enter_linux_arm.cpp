@@ -13,21 +13,1103 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_linux_arm(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef TARGET_ARM
+	subs.assign(983045 + 1, unknown);
+	subs[0] = all |
+		(PPP_CHECK_CB(on_sys_restart_syscall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_restart_syscall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[1] = all |
+		(PPP_CHECK_CB(on_sys_exit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_exit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[2] = all |
+		(PPP_CHECK_CB(on_sys_fork_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fork_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[3] = all |
+		(PPP_CHECK_CB(on_sys_read_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_read_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[4] = all |
+		(PPP_CHECK_CB(on_sys_write_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_write_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[5] = all |
+		(PPP_CHECK_CB(on_sys_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[6] = all |
+		(PPP_CHECK_CB(on_sys_close_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_close_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[8] = all |
+		(PPP_CHECK_CB(on_sys_creat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_creat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[9] = all |
+		(PPP_CHECK_CB(on_sys_link_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_link_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[10] = all |
+		(PPP_CHECK_CB(on_sys_unlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[11] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_sys_execve_enter) ? SYSCALL_SUB_ENTER : 0);
+	subs[12] = all |
+		(PPP_CHECK_CB(on_sys_chdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[13] = all |
+		(PPP_CHECK_CB(on_sys_time_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_time_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[14] = all |
+		(PPP_CHECK_CB(on_sys_mknod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mknod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[15] = all |
+		(PPP_CHECK_CB(on_sys_chmod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chmod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[16] = all |
+		(PPP_CHECK_CB(on_sys_lchown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lchown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[19] = all |
+		(PPP_CHECK_CB(on_sys_lseek_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lseek_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[20] = all |
+		(PPP_CHECK_CB(on_sys_getpid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[21] = all |
+		(PPP_CHECK_CB(on_sys_mount_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mount_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[23] = all |
+		(PPP_CHECK_CB(on_sys_setuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[24] = all |
+		(PPP_CHECK_CB(on_sys_getuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[25] = all |
+		(PPP_CHECK_CB(on_sys_stime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_stime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[26] = all |
+		(PPP_CHECK_CB(on_sys_ptrace_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ptrace_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[27] = all |
+		(PPP_CHECK_CB(on_sys_alarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_alarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[29] = all |
+		(PPP_CHECK_CB(on_sys_pause_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pause_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[30] = all |
+		(PPP_CHECK_CB(on_sys_utime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[33] = all |
+		(PPP_CHECK_CB(on_sys_access_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_access_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[34] = all |
+		(PPP_CHECK_CB(on_sys_nice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_nice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[36] = all |
+		(PPP_CHECK_CB(on_sys_sync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[37] = all |
+		(PPP_CHECK_CB(on_sys_kill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[38] = all |
+		(PPP_CHECK_CB(on_sys_rename_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rename_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[39] = all |
+		(PPP_CHECK_CB(on_sys_mkdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mkdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[40] = all |
+		(PPP_CHECK_CB(on_sys_rmdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rmdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[41] = all |
+		(PPP_CHECK_CB(on_sys_dup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[42] = all |
+		(PPP_CHECK_CB(on_sys_pipe_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pipe_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[43] = all |
+		(PPP_CHECK_CB(on_sys_times_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_times_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[45] = all |
+		(PPP_CHECK_CB(on_sys_brk_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_brk_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[46] = all |
+		(PPP_CHECK_CB(on_sys_setgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[47] = all |
+		(PPP_CHECK_CB(on_sys_getgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[49] = all |
+		(PPP_CHECK_CB(on_sys_geteuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_geteuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[50] = all |
+		(PPP_CHECK_CB(on_sys_getegid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getegid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[51] = all |
+		(PPP_CHECK_CB(on_sys_acct_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_acct_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[52] = all |
+		(PPP_CHECK_CB(on_sys_umount_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_umount_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[54] = all |
+		(PPP_CHECK_CB(on_sys_ioctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[55] = all |
+		(PPP_CHECK_CB(on_sys_fcntl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fcntl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[57] = all |
+		(PPP_CHECK_CB(on_sys_setpgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setpgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[60] = all |
+		(PPP_CHECK_CB(on_sys_umask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_umask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[61] = all |
+		(PPP_CHECK_CB(on_sys_chroot_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chroot_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[62] = all |
+		(PPP_CHECK_CB(on_sys_ustat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ustat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[63] = all |
+		(PPP_CHECK_CB(on_sys_dup2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[64] = all |
+		(PPP_CHECK_CB(on_sys_getppid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getppid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[65] = all |
+		(PPP_CHECK_CB(on_sys_getpgrp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpgrp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[66] = all |
+		(PPP_CHECK_CB(on_sys_setsid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setsid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[67] = all |
+		(PPP_CHECK_CB(on_sys_sigaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[70] = all |
+		(PPP_CHECK_CB(on_sys_setreuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setreuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[71] = all |
+		(PPP_CHECK_CB(on_sys_setregid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setregid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[72] = all |
+		(PPP_CHECK_CB(on_sys_sigsuspend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigsuspend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[73] = all |
+		(PPP_CHECK_CB(on_sys_sigpending_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigpending_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[74] = all |
+		(PPP_CHECK_CB(on_sys_sethostname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sethostname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[75] = all |
+		(PPP_CHECK_CB(on_sys_setrlimit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setrlimit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[77] = all |
+		(PPP_CHECK_CB(on_sys_getrusage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrusage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[78] = all |
+		(PPP_CHECK_CB(on_sys_gettimeofday_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_gettimeofday_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[79] = all |
+		(PPP_CHECK_CB(on_sys_settimeofday_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_settimeofday_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[80] = all |
+		(PPP_CHECK_CB(on_sys_getgroups16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgroups16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[81] = all |
+		(PPP_CHECK_CB(on_sys_setgroups16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgroups16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[83] = all |
+		(PPP_CHECK_CB(on_sys_symlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_symlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[85] = all |
+		(PPP_CHECK_CB(on_sys_readlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[86] = all |
+		(PPP_CHECK_CB(on_sys_uselib_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_uselib_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[87] = all |
+		(PPP_CHECK_CB(on_sys_swapon_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_swapon_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[88] = all |
+		(PPP_CHECK_CB(on_sys_reboot_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_reboot_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[91] = all |
+		(PPP_CHECK_CB(on_sys_munmap_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munmap_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[92] = all |
+		(PPP_CHECK_CB(on_sys_truncate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_truncate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[93] = all |
+		(PPP_CHECK_CB(on_sys_ftruncate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ftruncate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[94] = all |
+		(PPP_CHECK_CB(on_sys_fchmod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchmod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[95] = all |
+		(PPP_CHECK_CB(on_sys_fchown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[96] = all |
+		(PPP_CHECK_CB(on_sys_getpriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[97] = all |
+		(PPP_CHECK_CB(on_sys_setpriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setpriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[99] = all |
+		(PPP_CHECK_CB(on_sys_statfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_statfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[100] = all |
+		(PPP_CHECK_CB(on_sys_fstatfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[102] = all |
+		(PPP_CHECK_CB(on_sys_socketcall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socketcall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[103] = all |
+		(PPP_CHECK_CB(on_sys_syslog_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_syslog_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[104] = all |
+		(PPP_CHECK_CB(on_sys_setitimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setitimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[105] = all |
+		(PPP_CHECK_CB(on_sys_getitimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getitimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[106] = all |
+		(PPP_CHECK_CB(on_sys_newstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[107] = all |
+		(PPP_CHECK_CB(on_sys_newlstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newlstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[108] = all |
+		(PPP_CHECK_CB(on_sys_newfstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newfstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[111] = all |
+		(PPP_CHECK_CB(on_sys_vhangup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vhangup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[114] = all |
+		(PPP_CHECK_CB(on_sys_wait4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_wait4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[115] = all |
+		(PPP_CHECK_CB(on_sys_swapoff_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_swapoff_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[116] = all |
+		(PPP_CHECK_CB(on_sys_sysinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[117] = all |
+		(PPP_CHECK_CB(on_sys_ipc_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ipc_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[118] = all |
+		(PPP_CHECK_CB(on_sys_fsync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fsync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[119] = all |
+		(PPP_CHECK_CB(on_sigreturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sigreturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[120] = all |
+		(PPP_CHECK_CB(on_sys_clone_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clone_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[121] = all |
+		(PPP_CHECK_CB(on_sys_setdomainname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setdomainname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[122] = all |
+		(PPP_CHECK_CB(on_sys_newuname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newuname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[124] = all |
+		(PPP_CHECK_CB(on_sys_adjtimex_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_adjtimex_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[125] = all |
+		(PPP_CHECK_CB(on_sys_mprotect_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mprotect_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[126] = all |
+		(PPP_CHECK_CB(on_sys_sigprocmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigprocmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[128] = all |
+		(PPP_CHECK_CB(on_sys_init_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_init_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[129] = all |
+		(PPP_CHECK_CB(on_sys_delete_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_delete_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[131] = all |
+		(PPP_CHECK_CB(on_sys_quotactl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_quotactl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[132] = all |
+		(PPP_CHECK_CB(on_sys_getpgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[133] = all |
+		(PPP_CHECK_CB(on_sys_fchdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[134] = all |
+		(PPP_CHECK_CB(on_sys_bdflush_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bdflush_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[135] = all |
+		(PPP_CHECK_CB(on_sys_sysfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[136] = all |
+		(PPP_CHECK_CB(on_sys_personality_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_personality_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[138] = all |
+		(PPP_CHECK_CB(on_sys_setfsuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[139] = all |
+		(PPP_CHECK_CB(on_sys_setfsgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[140] = all |
+		(PPP_CHECK_CB(on_sys_llseek_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_llseek_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[141] = all |
+		(PPP_CHECK_CB(on_sys_getdents_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getdents_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[142] = all |
+		(PPP_CHECK_CB(on_sys_select_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_select_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[143] = all |
+		(PPP_CHECK_CB(on_sys_flock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_flock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[144] = all |
+		(PPP_CHECK_CB(on_sys_msync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[145] = all |
+		(PPP_CHECK_CB(on_sys_readv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[146] = all |
+		(PPP_CHECK_CB(on_sys_writev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_writev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[147] = all |
+		(PPP_CHECK_CB(on_sys_getsid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[148] = all |
+		(PPP_CHECK_CB(on_sys_fdatasync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fdatasync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[149] = all |
+		(PPP_CHECK_CB(on_sys_sysctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[150] = all |
+		(PPP_CHECK_CB(on_sys_mlock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[151] = all |
+		(PPP_CHECK_CB(on_sys_munlock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munlock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[152] = all |
+		(PPP_CHECK_CB(on_sys_mlockall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlockall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[153] = all |
+		(PPP_CHECK_CB(on_sys_munlockall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munlockall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[154] = all |
+		(PPP_CHECK_CB(on_sys_sched_setparam_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setparam_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[155] = all |
+		(PPP_CHECK_CB(on_sys_sched_getparam_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getparam_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[156] = all |
+		(PPP_CHECK_CB(on_sys_sched_setscheduler_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setscheduler_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[157] = all |
+		(PPP_CHECK_CB(on_sys_sched_getscheduler_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getscheduler_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[158] = all |
+		(PPP_CHECK_CB(on_sys_sched_yield_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_yield_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[159] = all |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_max_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[160] = all |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_min_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[161] = all |
+		(PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_rr_get_interval_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[162] = all |
+		(PPP_CHECK_CB(on_sys_nanosleep_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_nanosleep_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[163] = all |
+		(PPP_CHECK_CB(on_sys_mremap_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mremap_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[164] = all |
+		(PPP_CHECK_CB(on_sys_setresuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[165] = all |
+		(PPP_CHECK_CB(on_sys_getresuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[168] = all |
+		(PPP_CHECK_CB(on_sys_poll_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_poll_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[170] = all |
+		(PPP_CHECK_CB(on_sys_setresgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[171] = all |
+		(PPP_CHECK_CB(on_sys_getresgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[172] = all |
+		(PPP_CHECK_CB(on_sys_prctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_prctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[173] = all |
+		(PPP_CHECK_CB(on_sigreturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sigreturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[174] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[175] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigprocmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[176] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigpending_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigpending_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[177] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigtimedwait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[178] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[179] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigsuspend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[180] = all |
+		(PPP_CHECK_CB(on_sys_pread64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pread64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[181] = all |
+		(PPP_CHECK_CB(on_sys_pwrite64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pwrite64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[182] = all |
+		(PPP_CHECK_CB(on_sys_chown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[183] = all |
+		(PPP_CHECK_CB(on_sys_getcwd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getcwd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[184] = all |
+		(PPP_CHECK_CB(on_sys_capget_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_capget_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[185] = all |
+		(PPP_CHECK_CB(on_sys_capset_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_capset_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[186] = all |
+		(PPP_CHECK_CB(on_sys_sigaltstack_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigaltstack_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[187] = all |
+		(PPP_CHECK_CB(on_sys_sendfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[190] = all |
+		(PPP_CHECK_CB(on_sys_vfork_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vfork_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[191] = all |
+		(PPP_CHECK_CB(on_sys_getrlimit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrlimit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[192] = all |
+		(PPP_CHECK_CB(on_do_mmap2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_do_mmap2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[193] = all |
+		(PPP_CHECK_CB(on_sys_truncate64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_truncate64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[194] = all |
+		(PPP_CHECK_CB(on_sys_ftruncate64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ftruncate64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[195] = all |
+		(PPP_CHECK_CB(on_sys_stat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_stat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[196] = all |
+		(PPP_CHECK_CB(on_sys_lstat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lstat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[197] = all |
+		(PPP_CHECK_CB(on_sys_fstat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[198] = all |
+		(PPP_CHECK_CB(on_sys_lchown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lchown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[199] = all |
+		(PPP_CHECK_CB(on_sys_getuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[200] = all |
+		(PPP_CHECK_CB(on_sys_getgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[201] = all |
+		(PPP_CHECK_CB(on_sys_geteuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_geteuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[202] = all |
+		(PPP_CHECK_CB(on_sys_getegid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getegid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[203] = all |
+		(PPP_CHECK_CB(on_sys_setreuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setreuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[204] = all |
+		(PPP_CHECK_CB(on_sys_setregid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setregid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[205] = all |
+		(PPP_CHECK_CB(on_sys_getgroups_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgroups_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[206] = all |
+		(PPP_CHECK_CB(on_sys_setgroups_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgroups_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[207] = all |
+		(PPP_CHECK_CB(on_sys_fchown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[208] = all |
+		(PPP_CHECK_CB(on_sys_setresuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[209] = all |
+		(PPP_CHECK_CB(on_sys_getresuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[210] = all |
+		(PPP_CHECK_CB(on_sys_setresgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[211] = all |
+		(PPP_CHECK_CB(on_sys_getresgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[212] = all |
+		(PPP_CHECK_CB(on_sys_chown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[213] = all |
+		(PPP_CHECK_CB(on_sys_setuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[214] = all |
+		(PPP_CHECK_CB(on_sys_setgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[215] = all |
+		(PPP_CHECK_CB(on_sys_setfsuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[216] = all |
+		(PPP_CHECK_CB(on_sys_setfsgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[217] = all |
+		(PPP_CHECK_CB(on_sys_getdents64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getdents64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[218] = all |
+		(PPP_CHECK_CB(on_sys_pivot_root_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pivot_root_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[219] = all |
+		(PPP_CHECK_CB(on_sys_mincore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mincore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[220] = all |
+		(PPP_CHECK_CB(on_sys_madvise_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_madvise_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[221] = all |
+		(PPP_CHECK_CB(on_sys_fcntl64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fcntl64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[224] = all |
+		(PPP_CHECK_CB(on_sys_gettid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_gettid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[225] = all |
+		(PPP_CHECK_CB(on_sys_readahead_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readahead_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[226] = all |
+		(PPP_CHECK_CB(on_sys_setxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[227] = all |
+		(PPP_CHECK_CB(on_sys_lsetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lsetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[228] = all |
+		(PPP_CHECK_CB(on_sys_fsetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fsetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[229] = all |
+		(PPP_CHECK_CB(on_sys_getxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[230] = all |
+		(PPP_CHECK_CB(on_sys_lgetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lgetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[231] = all |
+		(PPP_CHECK_CB(on_sys_fgetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fgetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[232] = all |
+		(PPP_CHECK_CB(on_sys_listxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_listxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[233] = all |
+		(PPP_CHECK_CB(on_sys_llistxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_llistxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[234] = all |
+		(PPP_CHECK_CB(on_sys_flistxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_flistxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[235] = all |
+		(PPP_CHECK_CB(on_sys_removexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_removexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[236] = all |
+		(PPP_CHECK_CB(on_sys_lremovexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lremovexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[237] = all |
+		(PPP_CHECK_CB(on_sys_fremovexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fremovexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[238] = all |
+		(PPP_CHECK_CB(on_sys_tkill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tkill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[239] = all |
+		(PPP_CHECK_CB(on_sys_sendfile64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendfile64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[240] = all |
+		(PPP_CHECK_CB(on_sys_futex_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_futex_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[241] = all |
+		(PPP_CHECK_CB(on_sys_sched_setaffinity_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setaffinity_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[242] = all |
+		(PPP_CHECK_CB(on_sys_sched_getaffinity_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getaffinity_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[243] = all |
+		(PPP_CHECK_CB(on_sys_io_setup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_setup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[244] = all |
+		(PPP_CHECK_CB(on_sys_io_destroy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_destroy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[245] = all |
+		(PPP_CHECK_CB(on_sys_io_getevents_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_getevents_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[246] = all |
+		(PPP_CHECK_CB(on_sys_io_submit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_submit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[247] = all |
+		(PPP_CHECK_CB(on_sys_io_cancel_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_cancel_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[248] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_sys_exit_group_enter) ? SYSCALL_SUB_ENTER : 0);
+	subs[249] = all |
+		(PPP_CHECK_CB(on_sys_lookup_dcookie_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lookup_dcookie_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[250] = all |
+		(PPP_CHECK_CB(on_sys_epoll_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[251] = all |
+		(PPP_CHECK_CB(on_sys_epoll_ctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_ctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[252] = all |
+		(PPP_CHECK_CB(on_sys_epoll_wait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_wait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[253] = all |
+		(PPP_CHECK_CB(on_sys_remap_file_pages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_remap_file_pages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[256] = all |
+		(PPP_CHECK_CB(on_sys_set_tid_address_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_tid_address_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[257] = all |
+		(PPP_CHECK_CB(on_sys_timer_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[258] = all |
+		(PPP_CHECK_CB(on_sys_timer_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[259] = all |
+		(PPP_CHECK_CB(on_sys_timer_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[260] = all |
+		(PPP_CHECK_CB(on_sys_timer_getoverrun_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_getoverrun_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[261] = all |
+		(PPP_CHECK_CB(on_sys_timer_delete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_delete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[262] = all |
+		(PPP_CHECK_CB(on_sys_clock_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[263] = all |
+		(PPP_CHECK_CB(on_sys_clock_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[264] = all |
+		(PPP_CHECK_CB(on_sys_clock_getres_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_getres_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[265] = all |
+		(PPP_CHECK_CB(on_sys_clock_nanosleep_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_nanosleep_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[266] = all |
+		(PPP_CHECK_CB(on_sys_statfs64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_statfs64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[267] = all |
+		(PPP_CHECK_CB(on_sys_fstatfs64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatfs64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[268] = all |
+		(PPP_CHECK_CB(on_sys_tgkill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tgkill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[269] = all |
+		(PPP_CHECK_CB(on_sys_utimes_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utimes_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[270] = all |
+		(PPP_CHECK_CB(on_sys_arm_fadvise64_64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_arm_fadvise64_64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[271] = all |
+		(PPP_CHECK_CB(on_sys_pciconfig_iobase_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pciconfig_iobase_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[272] = all |
+		(PPP_CHECK_CB(on_sys_pciconfig_read_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pciconfig_read_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[273] = all |
+		(PPP_CHECK_CB(on_sys_pciconfig_write_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pciconfig_write_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[274] = all |
+		(PPP_CHECK_CB(on_sys_mq_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[275] = all |
+		(PPP_CHECK_CB(on_sys_mq_unlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_unlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[276] = all |
+		(PPP_CHECK_CB(on_sys_mq_timedsend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_timedsend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[277] = all |
+		(PPP_CHECK_CB(on_sys_mq_timedreceive_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_timedreceive_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[278] = all |
+		(PPP_CHECK_CB(on_sys_mq_notify_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_notify_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[279] = all |
+		(PPP_CHECK_CB(on_sys_mq_getsetattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_getsetattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[280] = all |
+		(PPP_CHECK_CB(on_sys_waitid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_waitid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[281] = all |
+		(PPP_CHECK_CB(on_sys_socket_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socket_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[282] = all |
+		(PPP_CHECK_CB(on_sys_bind_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bind_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[283] = all |
+		(PPP_CHECK_CB(on_sys_connect_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_connect_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[284] = all |
+		(PPP_CHECK_CB(on_sys_listen_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_listen_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[285] = all |
+		(PPP_CHECK_CB(on_sys_accept_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_accept_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[286] = all |
+		(PPP_CHECK_CB(on_sys_getsockname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsockname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[287] = all |
+		(PPP_CHECK_CB(on_sys_getpeername_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpeername_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[288] = all |
+		(PPP_CHECK_CB(on_sys_socketpair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socketpair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[289] = all |
+		(PPP_CHECK_CB(on_sys_send_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_send_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[290] = all |
+		(PPP_CHECK_CB(on_sys_sendto_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendto_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[291] = all |
+		(PPP_CHECK_CB(on_sys_recv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[292] = all |
+		(PPP_CHECK_CB(on_sys_recvfrom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvfrom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[293] = all |
+		(PPP_CHECK_CB(on_sys_shutdown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shutdown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[294] = all |
+		(PPP_CHECK_CB(on_sys_setsockopt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setsockopt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[295] = all |
+		(PPP_CHECK_CB(on_sys_getsockopt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsockopt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[296] = all |
+		(PPP_CHECK_CB(on_sys_sendmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[297] = all |
+		(PPP_CHECK_CB(on_sys_recvmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[298] = all |
+		(PPP_CHECK_CB(on_sys_semop_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_semop_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[299] = all |
+		(PPP_CHECK_CB(on_sys_semget_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_semget_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[300] = all |
+		(PPP_CHECK_CB(on_sys_semctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_semctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[301] = all |
+		(PPP_CHECK_CB(on_sys_msgsnd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msgsnd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[302] = all |
+		(PPP_CHECK_CB(on_sys_msgrcv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msgrcv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[303] = all |
+		(PPP_CHECK_CB(on_sys_msgget_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msgget_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[304] = all |
+		(PPP_CHECK_CB(on_sys_msgctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msgctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[305] = all |
+		(PPP_CHECK_CB(on_sys_shmat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shmat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[306] = all |
+		(PPP_CHECK_CB(on_sys_shmdt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shmdt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[307] = all |
+		(PPP_CHECK_CB(on_sys_shmget_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shmget_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[308] = all |
+		(PPP_CHECK_CB(on_sys_shmctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shmctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[309] = all |
+		(PPP_CHECK_CB(on_sys_add_key_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_add_key_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[310] = all |
+		(PPP_CHECK_CB(on_sys_request_key_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_request_key_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[311] = all |
+		(PPP_CHECK_CB(on_sys_keyctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_keyctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[312] = all |
+		(PPP_CHECK_CB(on_sys_semtimedop_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_semtimedop_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[314] = all |
+		(PPP_CHECK_CB(on_sys_ioprio_set_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioprio_set_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[315] = all |
+		(PPP_CHECK_CB(on_sys_ioprio_get_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioprio_get_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[316] = all |
+		(PPP_CHECK_CB(on_sys_inotify_init_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_init_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[317] = all |
+		(PPP_CHECK_CB(on_sys_inotify_add_watch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_add_watch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[318] = all |
+		(PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_rm_watch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[319] = all |
+		(PPP_CHECK_CB(on_sys_mbind_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mbind_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[320] = all |
+		(PPP_CHECK_CB(on_sys_get_mempolicy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_get_mempolicy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[321] = all |
+		(PPP_CHECK_CB(on_sys_set_mempolicy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_mempolicy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[322] = all |
+		(PPP_CHECK_CB(on_sys_openat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_openat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[323] = all |
+		(PPP_CHECK_CB(on_sys_mkdirat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mkdirat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[324] = all |
+		(PPP_CHECK_CB(on_sys_mknodat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mknodat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[325] = all |
+		(PPP_CHECK_CB(on_sys_fchownat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchownat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[326] = all |
+		(PPP_CHECK_CB(on_sys_futimesat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_futimesat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[327] = all |
+		(PPP_CHECK_CB(on_sys_fstatat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[328] = all |
+		(PPP_CHECK_CB(on_sys_unlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[329] = all |
+		(PPP_CHECK_CB(on_sys_renameat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_renameat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[330] = all |
+		(PPP_CHECK_CB(on_sys_linkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_linkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[331] = all |
+		(PPP_CHECK_CB(on_sys_symlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_symlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[332] = all |
+		(PPP_CHECK_CB(on_sys_readlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[333] = all |
+		(PPP_CHECK_CB(on_sys_fchmodat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchmodat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[334] = all |
+		(PPP_CHECK_CB(on_sys_faccessat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_faccessat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[335] = all |
+		(PPP_CHECK_CB(on_sys_pselect6_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pselect6_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[336] = all |
+		(PPP_CHECK_CB(on_sys_ppoll_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ppoll_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[337] = all |
+		(PPP_CHECK_CB(on_sys_unshare_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unshare_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[338] = all |
+		(PPP_CHECK_CB(on_sys_set_robust_list_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_robust_list_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[339] = all |
+		(PPP_CHECK_CB(on_sys_get_robust_list_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_get_robust_list_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[340] = all |
+		(PPP_CHECK_CB(on_sys_splice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_splice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[341] = all |
+		(PPP_CHECK_CB(on_sys_sync_file_range2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sync_file_range2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[342] = all |
+		(PPP_CHECK_CB(on_sys_tee_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tee_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[343] = all |
+		(PPP_CHECK_CB(on_sys_vmsplice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vmsplice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[344] = all |
+		(PPP_CHECK_CB(on_sys_move_pages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_move_pages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[345] = all |
+		(PPP_CHECK_CB(on_sys_getcpu_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getcpu_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[346] = all |
+		(PPP_CHECK_CB(on_sys_epoll_pwait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_pwait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[347] = all |
+		(PPP_CHECK_CB(on_sys_kexec_load_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kexec_load_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[348] = all |
+		(PPP_CHECK_CB(on_sys_utimensat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utimensat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[349] = all |
+		(PPP_CHECK_CB(on_sys_signalfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_signalfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[350] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[351] = all |
+		(PPP_CHECK_CB(on_sys_eventfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_eventfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[352] = all |
+		(PPP_CHECK_CB(on_sys_fallocate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fallocate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[353] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[354] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[355] = all |
+		(PPP_CHECK_CB(on_sys_signalfd4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_signalfd4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[356] = all |
+		(PPP_CHECK_CB(on_sys_eventfd2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_eventfd2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[357] = all |
+		(PPP_CHECK_CB(on_sys_epoll_create1_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_create1_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[358] = all |
+		(PPP_CHECK_CB(on_sys_dup3_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup3_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[359] = all |
+		(PPP_CHECK_CB(on_sys_pipe2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pipe2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[360] = all |
+		(PPP_CHECK_CB(on_sys_inotify_init1_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_init1_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[361] = all |
+		(PPP_CHECK_CB(on_sys_preadv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_preadv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[362] = all |
+		(PPP_CHECK_CB(on_sys_pwritev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pwritev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[363] = all |
+		(PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[364] = all |
+		(PPP_CHECK_CB(on_sys_perf_event_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_perf_event_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[365] = all |
+		(PPP_CHECK_CB(on_sys_recvmmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvmmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[366] = all |
+		(PPP_CHECK_CB(on_sys_accept4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_accept4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[367] = all |
+		(PPP_CHECK_CB(on_sys_fanotify_init_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fanotify_init_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[368] = all |
+		(PPP_CHECK_CB(on_sys_fanotify_mark_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fanotify_mark_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[369] = all |
+		(PPP_CHECK_CB(on_sys_prlimit64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_prlimit64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[370] = all |
+		(PPP_CHECK_CB(on_sys_name_to_handle_at_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_name_to_handle_at_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[371] = all |
+		(PPP_CHECK_CB(on_sys_open_by_handle_at_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_open_by_handle_at_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[372] = all |
+		(PPP_CHECK_CB(on_sys_clock_adjtime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_adjtime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[373] = all |
+		(PPP_CHECK_CB(on_sys_syncfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_syncfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[374] = all |
+		(PPP_CHECK_CB(on_sys_sendmmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendmmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[375] = all |
+		(PPP_CHECK_CB(on_sys_setns_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setns_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[376] = all |
+		(PPP_CHECK_CB(on_sys_process_vm_readv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_process_vm_readv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[377] = all |
+		(PPP_CHECK_CB(on_sys_process_vm_writev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_process_vm_writev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[378] = all |
+		(PPP_CHECK_CB(on_sys_kcmp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kcmp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[379] = all |
+		(PPP_CHECK_CB(on_sys_finit_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_finit_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[380] = all |
+		(PPP_CHECK_CB(on_sys_sched_setattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[381] = all |
+		(PPP_CHECK_CB(on_sys_sched_getattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[382] = all |
+		(PPP_CHECK_CB(on_sys_renameat2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_renameat2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[383] = all |
+		(PPP_CHECK_CB(on_sys_seccomp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_seccomp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[384] = all |
+		(PPP_CHECK_CB(on_sys_getrandom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrandom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[385] = all |
+		(PPP_CHECK_CB(on_sys_memfd_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_memfd_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[386] = all |
+		(PPP_CHECK_CB(on_sys_bpf_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bpf_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[387] = all |
+		(PPP_CHECK_CB(on_sys_execveat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_execveat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[388] = all |
+		(PPP_CHECK_CB(on_sys_userfaultfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_userfaultfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[389] = all |
+		(PPP_CHECK_CB(on_sys_membarrier_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_membarrier_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[390] = all |
+		(PPP_CHECK_CB(on_sys_mlock2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlock2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[983041] = all |
+		(PPP_CHECK_CB(on_ARM_breakpoint_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_ARM_breakpoint_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[983042] = all |
+		(PPP_CHECK_CB(on_ARM_cacheflush_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_ARM_cacheflush_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[983043] = all |
+		(PPP_CHECK_CB(on_ARM_user26_mode_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_ARM_user26_mode_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[983044] = all |
+		(PPP_CHECK_CB(on_ARM_usr32_mode_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_ARM_usr32_mode_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[983045] = all |
+		(PPP_CHECK_CB(on_ARM_set_tls_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_ARM_set_tls_return) ? SYSCALL_SUB_RETURN : 0);
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 #ifdef TARGET_ARM
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[7];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -40,10 +1122,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 1 long sys_exit ['int error_code']
 	case 1: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
@@ -56,12 +1139,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 3 long sys_read ['unsigned int fd', 'char __user *buf', 'size_t count']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_read_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -71,12 +1157,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 4 long sys_write ['unsigned int fd', 'const char __user *buf', 'size_t count']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_write_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -86,12 +1175,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 5 long sys_open ['const char __user *filename', 'int flags', 'umode_t mode']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -101,10 +1193,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 6 long sys_close ['unsigned int fd']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_close_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
@@ -112,11 +1205,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 8 long sys_creat ['const char __user *pathname', 'umode_t mode']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_creat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -125,11 +1220,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 9 long sys_link ['const char __user *oldname', 'const char __user *newname']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_link_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -138,10 +1235,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 10 long sys_unlink ['const char __user *pathname']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlink_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
@@ -149,12 +1247,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 11 long sys_execve ['const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp']
 	case 11: {
 		panda_noreturn = true;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_execve_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execve_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -164,10 +1265,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 12 long sys_chdir ['const char __user *filename']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
@@ -175,10 +1277,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 13 long sys_time ['time_t __user *tloc']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_time_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_time_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_time_enter, cpu, pc, arg0);
@@ -186,12 +1289,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 14 long sys_mknod ['const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -201,11 +1307,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 15 long sys_chmod ['const char __user *filename', 'umode_t mode']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chmod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -214,12 +1322,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 16 long sys_lchown16 ['const char __user *filename', 'old_uid_t user', 'old_gid_t group']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lchown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -229,12 +1340,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 19 long sys_lseek ['unsigned int fd', 'off_t offset', 'unsigned int whence']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lseek_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -249,14 +1363,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 21 long sys_mount ['char __user *dev_name', 'char __user *dir_name', 'char __user *type', 'unsigned long flags', 'void __user *data']
 	case 21: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mount_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -268,10 +1387,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 23 long sys_setuid16 ['old_uid_t uid']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setuid16_enter, cpu, pc, arg0);
@@ -284,10 +1404,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 25 long sys_stime ['time_t __user *tptr']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_stime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stime_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_stime_enter, cpu, pc, arg0);
@@ -295,13 +1416,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 26 long sys_ptrace ['long request', 'long pid', 'unsigned long addr', 'unsigned long data']
 	case 26: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ptrace_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -312,10 +1437,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 27 long sys_alarm ['unsigned int seconds']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_alarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_alarm_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_alarm_enter, cpu, pc, arg0);
@@ -328,11 +1454,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 30 long sys_utime ['char __user *filename', 'struct utimbuf __user *times']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_utime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -341,11 +1469,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 33 long sys_access ['const char __user *filename', 'int mode']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_access_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -354,10 +1484,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 34 long sys_nice ['int increment']
 	case 34: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_nice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nice_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
@@ -370,11 +1501,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 37 long sys_kill ['int pid', 'int sig']
 	case 37: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -383,11 +1516,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 38 long sys_rename ['const char __user *oldname', 'const char __user *newname']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rename_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -396,11 +1531,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 39 long sys_mkdir ['const char __user *pathname', 'umode_t mode']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdir_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -409,10 +1546,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 40 long sys_rmdir ['const char __user *pathname']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rmdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
@@ -420,10 +1558,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 41 long sys_dup ['unsigned int fildes']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
@@ -431,10 +1570,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 42 long sys_pipe ['int __user *fildes']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
@@ -442,10 +1582,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 43 long sys_times ['struct tms __user *tbuf']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_times_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
@@ -453,10 +1594,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 45 long sys_brk ['unsigned long brk']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_brk_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
@@ -464,10 +1606,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 46 long sys_setgid16 ['old_gid_t gid']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setgid16_enter, cpu, pc, arg0);
@@ -490,10 +1633,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 51 long sys_acct ['const char __user *name']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_acct_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
@@ -501,11 +1645,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 52 long sys_umount ['char __user *name', 'int flags']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umount_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -514,12 +1660,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 54 long sys_ioctl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioctl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -529,12 +1678,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 55 long sys_fcntl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -544,11 +1696,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 57 long sys_setpgid ['pid_t pid', 'pid_t pgid']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -557,10 +1711,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 60 long sys_umask ['int mask']
 	case 60: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umask_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
@@ -568,10 +1723,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 61 long sys_chroot ['const char __user *filename']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chroot_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
@@ -579,11 +1735,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 62 long sys_ustat ['unsigned dev', 'struct ustat __user *ubuf']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ustat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -592,11 +1750,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 63 long sys_dup2 ['unsigned int oldfd', 'unsigned int newfd']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -620,12 +1780,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 67 long sys_sigaction ['int', 'const struct old_sigaction __user *', 'struct old_sigaction __user *']
 	case 67: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaction_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -635,11 +1798,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 70 long sys_setreuid16 ['old_uid_t ruid', 'old_uid_t euid']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setreuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -648,11 +1813,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 71 long sys_setregid16 ['old_gid_t rgid', 'old_gid_t egid']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setregid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -661,12 +1828,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 72 long sys_sigsuspend ['int unused1', 'int unused2', 'old_sigset_t mask']
 	case 72: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigsuspend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -676,10 +1846,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 73 long sys_sigpending ['old_sigset_t __user *set']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sigpending_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigpending_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
@@ -687,11 +1858,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 74 long sys_sethostname ['char __user *name', 'int len']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sethostname_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -700,11 +1873,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 75 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -713,11 +1888,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 77 long sys_getrusage ['int who', 'struct rusage __user *ru']
 	case 77: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrusage_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -726,11 +1903,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 78 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -739,11 +1918,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 79 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -752,11 +1933,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 80 long sys_getgroups16 ['int gidsetsize', 'old_gid_t __user *grouplist']
 	case 80: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getgroups16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups16_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -765,11 +1948,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 81 long sys_setgroups16 ['int gidsetsize', 'old_gid_t __user *grouplist']
 	case 81: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setgroups16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups16_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -778,11 +1963,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 83 long sys_symlink ['const char __user *old', 'const char __user *new']
 	case 83: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlink_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -791,12 +1978,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 85 long sys_readlink ['const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlink_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -806,10 +1996,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 86 long sys_uselib ['const char __user *library']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uselib_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
@@ -817,11 +2008,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 87 long sys_swapon ['const char __user *specialfile', 'int swap_flags']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapon_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -830,13 +2023,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 88 long sys_reboot ['int magic1', 'int magic2', 'unsigned int cmd', 'void __user *arg']
 	case 88: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_reboot_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -847,11 +2044,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 91 long sys_munmap ['unsigned long addr', 'size_t len']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munmap_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -860,11 +2059,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 92 long sys_truncate ['const char __user *path', 'long length']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -873,11 +2074,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 93 long sys_ftruncate ['unsigned int fd', 'unsigned long length']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -886,11 +2089,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 94 long sys_fchmod ['unsigned int fd', 'umode_t mode']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -899,12 +2104,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 95 long sys_fchown16 ['unsigned int fd', 'old_uid_t user', 'old_gid_t group']
 	case 95: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -914,11 +2122,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 96 long sys_getpriority ['int which', 'int who']
 	case 96: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpriority_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -927,12 +2137,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 97 long sys_setpriority ['int which', 'int who', 'int niceval']
 	case 97: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpriority_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -942,11 +2155,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 99 long sys_statfs ['const char __user *path', 'struct statfs __user *buf']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -955,11 +2170,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 100 long sys_fstatfs ['unsigned int fd', 'struct statfs __user *buf']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -968,11 +2185,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 102 long sys_socketcall ['int call', 'unsigned long __user *args']
 	case 102: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_socketcall_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketcall_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -981,12 +2200,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 103 long sys_syslog ['int type', 'char __user *buf', 'int len']
 	case 103: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syslog_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -996,12 +2218,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 104 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
 	case 104: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setitimer_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1011,11 +2236,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 105 long sys_getitimer ['int which', 'struct itimerval __user *value']
 	case 105: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getitimer_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1024,11 +2251,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 106 long sys_newstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1037,11 +2266,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 107 long sys_newlstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newlstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1050,11 +2281,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 108 long sys_newfstat ['unsigned int fd', 'struct stat __user *statbuf']
 	case 108: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1068,13 +2301,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 114 long sys_wait4 ['pid_t pid', 'int __user *stat_addr', 'int options', 'struct rusage __user *ru']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_wait4_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1085,10 +2322,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 115 long sys_swapoff ['const char __user *specialfile']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapoff_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
@@ -1096,10 +2334,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 116 long sys_sysinfo ['struct sysinfo __user *info']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
@@ -1107,15 +2346,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 117 long sys_ipc ['unsigned int call', 'int first', 'unsigned long second', 'unsigned long third', 'void __user *ptr', 'long fifth']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_ipc_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ipc_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1128,10 +2373,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 118 long sys_fsync ['unsigned int fd']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsync_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
@@ -1144,14 +2390,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 120 long sys_clone ['unsigned long', 'unsigned long', 'int __user *', 'int __user *', 'unsigned long']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_clone_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clone_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1163,11 +2414,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 121 long sys_setdomainname ['char __user *name', 'int len']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1176,10 +2429,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 122 long sys_newuname ['struct new_utsname __user *name']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newuname_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
@@ -1187,10 +2441,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 124 long sys_adjtimex ['struct timex __user *txc_p']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
@@ -1198,12 +2453,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 125 long sys_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mprotect_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1213,12 +2471,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 126 long sys_sigprocmask ['int how', 'old_sigset_t __user *set', 'old_sigset_t __user *oset']
 	case 126: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigprocmask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1228,12 +2489,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 128 long sys_init_module ['void __user *umod', 'unsigned long len', 'const char __user *uargs']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_init_module_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1243,11 +2507,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 129 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
 	case 129: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_delete_module_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1256,13 +2522,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 131 long sys_quotactl ['unsigned int cmd', 'const char __user *special', 'qid_t id', 'void __user *addr']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_quotactl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1273,10 +2543,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 132 long sys_getpgid ['pid_t pid']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
@@ -1284,10 +2555,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 133 long sys_fchdir ['unsigned int fd']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
@@ -1295,11 +2567,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 134 long sys_bdflush ['int func', 'long data']
 	case 134: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_bdflush_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bdflush_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1308,12 +2582,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 135 long sys_sysfs ['int option', 'unsigned long arg1', 'unsigned long arg2']
 	case 135: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysfs_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1323,10 +2600,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 136 long sys_personality ['unsigned int personality']
 	case 136: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_personality_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
@@ -1334,10 +2612,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 138 long sys_setfsuid16 ['old_uid_t uid']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsuid16_enter, cpu, pc, arg0);
@@ -1345,10 +2624,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 139 long sys_setfsgid16 ['old_gid_t gid']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsgid16_enter, cpu, pc, arg0);
@@ -1356,14 +2636,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 140 long sys_llseek ['unsigned int fd', 'unsigned long offset_high', 'unsigned long offset_low', 'loff_t __user *result', 'unsigned int whence']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_llseek_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llseek_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1375,12 +2660,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 141 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1390,14 +2678,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 142 long sys_select ['int n', 'fd_set __user *inp', 'fd_set __user *outp', 'fd_set __user *exp', 'struct timeval __user *tvp']
 	case 142: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_select_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1409,11 +2702,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 143 long sys_flock ['unsigned int fd', 'unsigned int cmd']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1422,12 +2717,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 144 long sys_msync ['unsigned long start', 'size_t len', 'int flags']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msync_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1437,12 +2735,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 145 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1452,12 +2753,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 146 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_writev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1467,10 +2771,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 147 long sys_getsid ['pid_t pid']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
@@ -1478,10 +2783,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 148 long sys_fdatasync ['unsigned int fd']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
@@ -1489,10 +2795,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 149 long sys_sysctl ['struct __sysctl_args __user *args']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysctl_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
@@ -1500,11 +2807,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 150 long sys_mlock ['unsigned long start', 'size_t len']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1513,11 +2822,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 151 long sys_munlock ['unsigned long start', 'size_t len']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munlock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1526,10 +2837,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 152 long sys_mlockall ['int flags']
 	case 152: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlockall_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
@@ -1542,11 +2854,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 154 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1555,11 +2869,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 155 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1568,12 +2884,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 156 long sys_sched_setscheduler ['pid_t pid', 'int policy', 'struct sched_param __user *param']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1583,10 +2902,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 157 long sys_sched_getscheduler ['pid_t pid']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
@@ -1599,10 +2919,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 159 long sys_sched_get_priority_max ['int policy']
 	case 159: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
@@ -1610,10 +2931,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 160 long sys_sched_get_priority_min ['int policy']
 	case 160: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
@@ -1621,11 +2943,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 161 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1634,11 +2958,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 162 long sys_nanosleep ['struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1647,14 +2973,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 163 long sys_mremap ['unsigned long addr', 'unsigned long old_len', 'unsigned long new_len', 'unsigned long flags', 'unsigned long new_addr']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mremap_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mremap_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1666,12 +2997,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 164 long sys_setresuid16 ['old_uid_t ruid', 'old_uid_t euid', 'old_uid_t suid']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1681,12 +3015,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 165 long sys_getresuid16 ['old_uid_t __user *ruid', 'old_uid_t __user *euid', 'old_uid_t __user *suid']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1696,12 +3033,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 168 long sys_poll ['struct pollfd __user *ufds', 'unsigned int nfds', 'int timeout']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_poll_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1711,12 +3051,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 170 long sys_setresgid16 ['old_gid_t rgid', 'old_gid_t egid', 'old_gid_t sgid']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1726,12 +3069,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 171 long sys_getresgid16 ['old_gid_t __user *rgid', 'old_gid_t __user *egid', 'old_gid_t __user *sgid']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1741,14 +3087,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 172 long sys_prctl ['int option', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 172: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1765,13 +3116,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 174 long sys_rt_sigaction ['int', 'const struct sigaction __user *', 'struct sigaction __user *', 'size_t']
 	case 174: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1782,13 +3137,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 175 long sys_rt_sigprocmask ['int how', 'sigset_t __user *set', 'sigset_t __user *oset', 'size_t sigsetsize']
 	case 175: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1799,11 +3158,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 176 long sys_rt_sigpending ['sigset_t __user *set', 'size_t sigsetsize']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1812,13 +3173,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 177 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
 	case 177: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1829,12 +3194,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 178 long sys_rt_sigqueueinfo ['int pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 178: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1844,11 +3212,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 179 long sys_rt_sigsuspend ['sigset_t __user *unewset', 'size_t sigsetsize']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1857,13 +3227,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 180 long sys_pread64 ['unsigned int fd', 'char __user *buf', 'size_t count', 'loff_t pos']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pread64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1874,13 +3248,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 181 long sys_pwrite64 ['unsigned int fd', 'const char __user *buf', 'size_t count', 'loff_t pos']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1891,12 +3269,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 182 long sys_chown16 ['const char __user *filename', 'old_uid_t user', 'old_gid_t group']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_chown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1906,11 +3287,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 183 long sys_getcwd ['char __user *buf', 'unsigned long size']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcwd_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1919,11 +3302,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 184 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capget_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1932,11 +3317,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 185 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capset_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1945,11 +3332,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 186 long sys_sigaltstack ['const struct sigaltstack __user *uss', 'struct sigaltstack __user *uoss']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sigaltstack_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1958,13 +3347,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 187 long sys_sendfile ['int out_fd', 'int in_fd', 'off_t __user *offset', 'size_t count']
 	case 187: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1980,11 +3373,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 191 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1993,15 +3388,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 192 long do_mmap2 ['unsigned long addr', 'unsigned long len', 'unsigned long prot', 'unsigned long flags', 'unsigned long fd', 'unsigned long pgoff']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_do_mmap2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_do_mmap2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2014,11 +3415,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 193 long sys_truncate64 ['const char __user *path', 'loff_t length']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_truncate64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_64(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 		}
@@ -2027,11 +3430,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 194 long sys_ftruncate64 ['unsigned int fd', 'loff_t length']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ftruncate64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_64(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 		}
@@ -2040,11 +3445,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 195 long sys_stat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_stat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2053,11 +3460,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 196 long sys_lstat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_lstat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2066,11 +3475,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 197 long sys_fstat64 ['unsigned long fd', 'struct stat64 __user *statbuf']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fstat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2079,12 +3490,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 198 long sys_lchown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 198: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2114,11 +3528,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 203 long sys_setreuid ['uid_t ruid', 'uid_t euid']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2127,11 +3543,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 204 long sys_setregid ['gid_t rgid', 'gid_t egid']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2140,11 +3558,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 205 long sys_getgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 205: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2153,11 +3573,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 206 long sys_setgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 206: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2166,12 +3588,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 207 long sys_fchown ['unsigned int fd', 'uid_t user', 'gid_t group']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2181,12 +3606,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 208 long sys_setresuid ['uid_t ruid', 'uid_t euid', 'uid_t suid']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2196,12 +3624,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 209 long sys_getresuid ['uid_t __user *ruid', 'uid_t __user *euid', 'uid_t __user *suid']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2211,12 +3642,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 210 long sys_setresgid ['gid_t rgid', 'gid_t egid', 'gid_t sgid']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2226,12 +3660,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 211 long sys_getresgid ['gid_t __user *rgid', 'gid_t __user *egid', 'gid_t __user *sgid']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2241,12 +3678,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 212 long sys_chown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2256,10 +3696,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 213 long sys_setuid ['uid_t uid']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
@@ -2267,10 +3708,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 214 long sys_setgid ['gid_t gid']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
@@ -2278,10 +3720,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 215 long sys_setfsuid ['uid_t uid']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
@@ -2289,10 +3732,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 216 long sys_setfsgid ['gid_t gid']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
@@ -2300,12 +3744,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 217 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2315,11 +3762,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 218 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2328,12 +3777,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 219 long sys_mincore ['unsigned long start', 'size_t len', 'unsigned char __user *vec']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mincore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2343,12 +3795,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 220 long sys_madvise ['unsigned long start', 'size_t len', 'int behavior']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_madvise_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2358,12 +3813,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 221 long sys_fcntl64 ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fcntl64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2378,12 +3836,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 225 long sys_readahead ['int fd', 'loff_t offset', 'size_t count']
 	case 225: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readahead_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_64(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2393,14 +3854,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 226 long sys_setxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 226: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2412,14 +3878,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 227 long sys_lsetxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2431,14 +3902,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 228 long sys_fsetxattr ['int fd', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 228: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2450,13 +3926,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 229 long sys_getxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2467,13 +3947,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 230 long sys_lgetxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2484,13 +3968,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 231 long sys_fgetxattr ['int fd', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 231: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2501,12 +3989,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 232 long sys_listxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2516,12 +4007,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 233 long sys_llistxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2531,12 +4025,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 234 long sys_flistxattr ['int fd', 'char __user *list', 'size_t size']
 	case 234: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2546,11 +4043,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 235 long sys_removexattr ['const char __user *path', 'const char __user *name']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_removexattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2559,11 +4058,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 236 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2572,11 +4073,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 237 long sys_fremovexattr ['int fd', 'const char __user *name']
 	case 237: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2585,11 +4088,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 238 long sys_tkill ['int pid', 'int sig']
 	case 238: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tkill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -2598,13 +4103,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 239 long sys_sendfile64 ['int out_fd', 'int in_fd', 'loff_t __user *offset', 'size_t count']
 	case 239: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2615,15 +4124,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 240 long sys_futex ['u32 __user *uaddr', 'int op', 'u32 val', 'struct timespec __user *utime', 'u32 __user *uaddr2', 'u32 val3']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futex_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2636,12 +4151,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 241 long sys_sched_setaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 241: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2651,12 +4169,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 242 long sys_sched_getaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 242: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2666,11 +4187,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 243 long sys_io_setup ['unsigned nr_reqs', 'aio_context_t __user *ctx']
 	case 243: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_setup_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2679,10 +4202,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 244 long sys_io_destroy ['aio_context_t ctx']
 	case 244: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
@@ -2690,14 +4214,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 245 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
 	case 245: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2709,12 +4238,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 246 long sys_io_submit ['aio_context_t', 'long', 'struct iocb __user * __user *']
 	case 246: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_submit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2724,12 +4256,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 247 long sys_io_cancel ['aio_context_t ctx_id', 'struct iocb __user *iocb', 'struct io_event __user *result']
 	case 247: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2739,10 +4274,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 248 long sys_exit_group ['int error_code']
 	case 248: {
 		panda_noreturn = true;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_group_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
@@ -2750,12 +4286,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 249 long sys_lookup_dcookie ['u64 cookie64', 'char __user *buf', 'size_t len']
 	case 249: {
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint64_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
+			arg0 = get_64(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2765,10 +4304,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 250 long sys_epoll_create ['int size']
 	case 250: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
@@ -2776,13 +4316,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 251 long sys_epoll_ctl ['int epfd', 'int op', 'int fd', 'struct epoll_event __user *event']
 	case 251: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2793,13 +4337,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 252 long sys_epoll_wait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout']
 	case 252: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2810,14 +4358,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 253 long sys_remap_file_pages ['unsigned long start', 'unsigned long size', 'unsigned long prot', 'unsigned long pgoff', 'unsigned long flags']
 	case 253: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2829,10 +4382,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 256 long sys_set_tid_address ['int __user *tidptr']
 	case 256: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
@@ -2840,12 +4394,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 257 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user *created_timer_id']
 	case 257: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_create_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2855,13 +4412,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 258 long sys_timer_settime ['timer_t timer_id', 'int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
 	case 258: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2872,11 +4433,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 259 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
 	case 259: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2885,10 +4448,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 260 long sys_timer_getoverrun ['timer_t timer_id']
 	case 260: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
@@ -2896,10 +4460,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 261 long sys_timer_delete ['timer_t timer_id']
 	case 261: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
@@ -2907,11 +4472,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 262 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
 	case 262: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2920,11 +4487,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 263 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 263: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2933,11 +4502,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 264 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 264: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2946,13 +4517,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 265 long sys_clock_nanosleep ['clockid_t which_clock', 'int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 265: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2963,12 +4538,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 266 long sys_statfs64 ['const char __user *path', 'size_t sz', 'struct statfs64 __user *buf']
 	case 266: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_statfs64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2978,12 +4556,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 267 long sys_fstatfs64 ['unsigned int fd', 'size_t sz', 'struct statfs64 __user *buf']
 	case 267: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatfs64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2993,12 +4574,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 268 long sys_tgkill ['int tgid', 'int pid', 'int sig']
 	case 268: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tgkill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3008,11 +4592,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 269 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
 	case 269: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimes_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3021,13 +4607,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 270 long sys_arm_fadvise64_64 ['int fd', 'int advice', 'loff_t offset', 'loff_t len']
 	case 270: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_arm_fadvise64_64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_arm_fadvise64_64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -3038,12 +4628,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 271 long sys_pciconfig_iobase ['long which', 'unsigned long bus', 'unsigned long devfn']
 	case 271: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_pciconfig_iobase_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_iobase_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3053,14 +4646,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 272 long sys_pciconfig_read ['unsigned long bus', 'unsigned long dfn', 'unsigned long off', 'unsigned long len', 'void __user *buf']
 	case 272: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_pciconfig_read_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_read_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3072,14 +4670,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 273 long sys_pciconfig_write ['unsigned long bus', 'unsigned long dfn', 'unsigned long off', 'unsigned long len', 'void __user *buf']
 	case 273: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_pciconfig_write_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pciconfig_write_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3091,13 +4694,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 274 long sys_mq_open ['const char __user *name', 'int oflag', 'umode_t mode', 'struct mq_attr __user *attr']
 	case 274: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3108,10 +4715,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 275 long sys_mq_unlink ['const char __user *name']
 	case 275: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
@@ -3119,14 +4727,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 276 long sys_mq_timedsend ['mqd_t mqdes', 'const char __user *msg_ptr', 'size_t msg_len', 'unsigned int msg_prio', 'const struct timespec __user *abs_timeout']
 	case 276: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3138,14 +4751,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 277 long sys_mq_timedreceive ['mqd_t mqdes', 'char __user *msg_ptr', 'size_t msg_len', 'unsigned int __user *msg_prio', 'const struct timespec __user *abs_timeout']
 	case 277: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3157,11 +4775,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 278 long sys_mq_notify ['mqd_t mqdes', 'const struct sigevent __user *notification']
 	case 278: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3170,12 +4790,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 279 long sys_mq_getsetattr ['mqd_t mqdes', 'const struct mq_attr __user *mqstat', 'struct mq_attr __user *omqstat']
 	case 279: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3185,14 +4808,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 280 long sys_waitid ['int which', 'pid_t pid', 'struct siginfo __user *infop', 'int options', 'struct rusage __user *ru']
 	case 280: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitid_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3204,12 +4832,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 281 long sys_socket ['int', 'int', 'int']
 	case 281: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_socket_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socket_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3219,12 +4850,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 282 long sys_bind ['int', 'struct sockaddr __user *', 'int']
 	case 282: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_bind_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bind_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3234,12 +4868,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 283 long sys_connect ['int', 'struct sockaddr __user *', 'int']
 	case 283: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_connect_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_connect_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3249,11 +4886,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 284 long sys_listen ['int', 'int']
 	case 284: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_listen_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listen_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3262,12 +4901,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 285 long sys_accept ['int', 'struct sockaddr __user *', 'int __user *']
 	case 285: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_accept_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3277,12 +4919,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 286 long sys_getsockname ['int', 'struct sockaddr __user *', 'int __user *']
 	case 286: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getsockname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockname_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3292,12 +4937,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 287 long sys_getpeername ['int', 'struct sockaddr __user *', 'int __user *']
 	case 287: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getpeername_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpeername_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3307,13 +4955,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 288 long sys_socketpair ['int', 'int', 'int', 'int __user *']
 	case 288: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_socketpair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketpair_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3324,13 +4976,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 289 long sys_send ['int', 'void __user *', 'size_t', 'unsigned']
 	case 289: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_send_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_send_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3341,15 +4997,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 290 long sys_sendto ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int']
 	case 290: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_sendto_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendto_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3362,13 +5024,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 291 long sys_recv ['int', 'void __user *', 'size_t', 'unsigned']
 	case 291: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_recv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recv_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3379,15 +5045,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 292 long sys_recvfrom ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int __user *']
 	case 292: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_recvfrom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3400,11 +5072,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 293 long sys_shutdown ['int', 'int']
 	case 293: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_shutdown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shutdown_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3413,14 +5087,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 294 long sys_setsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int optlen']
 	case 294: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_setsockopt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3432,14 +5111,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 295 long sys_getsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int __user *optlen']
 	case 295: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_getsockopt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3451,12 +5135,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 296 long sys_sendmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 296: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sendmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3466,12 +5153,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 297 long sys_recvmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 297: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_recvmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3481,12 +5171,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 298 long sys_semop ['int semid', 'struct sembuf __user *sops', 'unsigned nsops']
 	case 298: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_semop_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semop_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3496,12 +5189,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 299 long sys_semget ['key_t key', 'int nsems', 'int semflg']
 	case 299: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_semget_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semget_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3511,13 +5207,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 300 long sys_semctl ['int semid', 'int semnum', 'int cmd', 'unsigned long arg']
 	case 300: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_semctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3528,13 +5228,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 301 long sys_msgsnd ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'int msgflg']
 	case 301: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_msgsnd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgsnd_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3545,14 +5249,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 302 long sys_msgrcv ['int msqid', 'struct msgbuf __user *msgp', 'size_t msgsz', 'long msgtyp', 'int msgflg']
 	case 302: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_msgrcv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgrcv_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3564,11 +5273,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 303 long sys_msgget ['key_t key', 'int msgflg']
 	case 303: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_msgget_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgget_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3577,12 +5288,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 304 long sys_msgctl ['int msqid', 'int cmd', 'struct msqid_ds __user *buf']
 	case 304: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_msgctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msgctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3592,12 +5306,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 305 long sys_shmat ['int shmid', 'char __user *shmaddr', 'int shmflg']
 	case 305: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_shmat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3607,10 +5324,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 306 long sys_shmdt ['char __user *shmaddr']
 	case 306: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_shmdt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmdt_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_shmdt_enter, cpu, pc, arg0);
@@ -3618,12 +5336,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 307 long sys_shmget ['key_t key', 'size_t size', 'int flag']
 	case 307: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_shmget_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmget_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3633,12 +5354,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 308 long sys_shmctl ['int shmid', 'int cmd', 'struct shmid_ds __user *buf']
 	case 308: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_shmctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shmctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3648,14 +5372,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 309 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
 	case 309: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_add_key_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3667,13 +5396,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 310 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
 	case 310: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_request_key_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3684,14 +5417,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 311 long sys_keyctl ['int cmd', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 311: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_keyctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3703,13 +5441,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 312 long sys_semtimedop ['int semid', 'struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
 	case 312: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_semtimedop_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_semtimedop_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3720,12 +5462,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 314 long sys_ioprio_set ['int which', 'int who', 'int ioprio']
 	case 314: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3735,11 +5480,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 315 long sys_ioprio_get ['int which', 'int who']
 	case 315: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3753,12 +5500,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 317 long sys_inotify_add_watch ['int fd', 'const char __user *path', 'u32 mask']
 	case 317: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3768,11 +5518,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 318 long sys_inotify_rm_watch ['int fd', '__s32 wd']
 	case 318: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3781,15 +5533,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 319 long sys_mbind ['unsigned long start', 'unsigned long len', 'unsigned long mode', 'const unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
 	case 319: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mbind_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3802,14 +5560,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 320 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', 'unsigned long flags']
 	case 320: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3821,12 +5584,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 321 long sys_set_mempolicy ['int mode', 'const unsigned long __user *nmask', 'unsigned long maxnode']
 	case 321: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3836,13 +5602,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 322 long sys_openat ['int dfd', 'const char __user *filename', 'int flags', 'umode_t mode']
 	case 322: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_openat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3853,12 +5623,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 323 long sys_mkdirat ['int dfd', 'const char __user *pathname', 'umode_t mode']
 	case 323: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3868,13 +5641,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 324 long sys_mknodat ['int dfd', 'const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 324: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknodat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3885,14 +5662,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 325 long sys_fchownat ['int dfd', 'const char __user *filename', 'uid_t user', 'gid_t group', 'int flag']
 	case 325: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchownat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3904,12 +5686,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 326 long sys_futimesat ['int dfd', 'const char __user *filename', 'struct timeval __user *utimes']
 	case 326: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futimesat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3919,13 +5704,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 327 long sys_fstatat64 ['int dfd', 'const char __user *filename', 'struct stat64 __user *statbuf', 'int flag']
 	case 327: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatat64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3936,12 +5725,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 328 long sys_unlinkat ['int dfd', 'const char __user *pathname', 'int flag']
 	case 328: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3951,13 +5743,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 329 long sys_renameat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 329: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3968,14 +5764,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 330 long sys_linkat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'int flags']
 	case 330: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_linkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3987,12 +5788,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 331 long sys_symlinkat ['const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 331: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4002,13 +5806,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 332 long sys_readlinkat ['int dfd', 'const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 332: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4019,12 +5827,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 333 long sys_fchmodat ['int dfd', 'const char __user *filename', 'umode_t mode']
 	case 333: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4034,12 +5845,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 334 long sys_faccessat ['int dfd', 'const char __user *filename', 'int mode']
 	case 334: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_faccessat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4049,15 +5863,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 335 long sys_pselect6 ['int', 'fd_set __user *', 'fd_set __user *', 'fd_set __user *', 'struct timespec __user *', 'void __user *']
 	case 335: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_pselect6_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pselect6_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4070,14 +5890,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 336 long sys_ppoll ['struct pollfd __user *', 'unsigned int', 'struct timespec __user *', 'const sigset_t __user *', 'size_t']
 	case 336: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_ppoll_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ppoll_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4089,10 +5914,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 337 long sys_unshare ['unsigned long unshare_flags']
 	case 337: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unshare_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
@@ -4100,11 +5926,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 338 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
 	case 338: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4113,12 +5941,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 339 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
 	case 339: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4128,15 +5959,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 340 long sys_splice ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 340: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_splice_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4149,13 +5986,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 341 long sys_sync_file_range2 ['int fd', 'unsigned int flags', 'loff_t offset', 'loff_t nbytes']
 	case 341: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sync_file_range2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sync_file_range2_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -4166,13 +6007,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 342 long sys_tee ['int fdin', 'int fdout', 'size_t len', 'unsigned int flags']
 	case 342: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tee_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4183,13 +6028,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 343 long sys_vmsplice ['int fd', 'const struct iovec __user *iov', 'unsigned long nr_segs', 'unsigned int flags']
 	case 343: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4200,15 +6049,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 344 long sys_move_pages ['pid_t pid', 'unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
 	case 344: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_move_pages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4221,12 +6076,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 345 long sys_getcpu ['unsigned __user *cpu', 'unsigned __user *node', 'struct getcpu_cache __user *cache']
 	case 345: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcpu_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4236,15 +6094,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 346 long sys_epoll_pwait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
 	case 346: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_pwait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4257,13 +6121,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 347 long sys_kexec_load ['unsigned long entry', 'unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
 	case 347: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4274,13 +6142,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 348 long sys_utimensat ['int dfd', 'const char __user *filename', 'struct timespec __user *utimes', 'int flags']
 	case 348: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimensat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4291,12 +6163,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 349 long sys_signalfd ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask']
 	case 349: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4306,11 +6181,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 350 long sys_timerfd_create ['int clockid', 'int flags']
 	case 350: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4319,10 +6196,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 351 long sys_eventfd ['unsigned int count']
 	case 351: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
@@ -4330,13 +6208,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 352 long sys_fallocate ['int fd', 'int mode', 'loff_t offset', 'loff_t len']
 	case 352: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fallocate_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -4347,13 +6229,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 353 long sys_timerfd_settime ['int ufd', 'int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
 	case 353: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4364,11 +6250,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 354 long sys_timerfd_gettime ['int ufd', 'struct itimerspec __user *otmr']
 	case 354: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4377,13 +6265,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 355 long sys_signalfd4 ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask', 'int flags']
 	case 355: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4394,11 +6286,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 356 long sys_eventfd2 ['unsigned int count', 'int flags']
 	case 356: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4407,10 +6301,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 357 long sys_epoll_create1 ['int flags']
 	case 357: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
@@ -4418,12 +6313,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 358 long sys_dup3 ['unsigned int oldfd', 'unsigned int newfd', 'int flags']
 	case 358: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup3_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4433,11 +6331,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 359 long sys_pipe2 ['int __user *fildes', 'int flags']
 	case 359: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4446,10 +6346,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 360 long sys_inotify_init1 ['int flags']
 	case 360: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
@@ -4457,14 +6358,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 361 long sys_preadv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 361: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_preadv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4476,14 +6382,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 362 long sys_pwritev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 362: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_pwritev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4495,13 +6406,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 363 long sys_rt_tgsigqueueinfo ['pid_t tgid', 'pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 363: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4512,14 +6427,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 364 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', 'int cpu', 'int group_fd', 'unsigned long flags']
 	case 364: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_perf_event_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4531,14 +6451,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 365 long sys_recvmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags', 'struct timespec __user *timeout']
 	case 365: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_recvmmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4550,13 +6475,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 366 long sys_accept4 ['int', 'struct sockaddr __user *', 'int __user *', 'int']
 	case 366: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_accept4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept4_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4567,11 +6496,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 367 long sys_fanotify_init ['unsigned int flags', 'unsigned int event_f_flags']
 	case 367: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fanotify_init_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4580,14 +6511,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 368 long sys_fanotify_mark ['int fanotify_fd', 'unsigned int flags', 'u64 mask', 'int fd', 'const char __user *pathname']
 	case 368: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fanotify_mark_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -4599,13 +6535,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 369 long sys_prlimit64 ['pid_t pid', 'unsigned int resource', 'const struct rlimit64 __user *new_rlim', 'struct rlimit64 __user *old_rlim']
 	case 369: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_prlimit64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4616,14 +6556,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 370 long sys_name_to_handle_at ['int dfd', 'const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', 'int flag']
 	case 370: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_name_to_handle_at_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4635,12 +6580,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 371 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
 	case 371: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_open_by_handle_at_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4650,11 +6598,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 372 long sys_clock_adjtime ['clockid_t which_clock', 'struct timex __user *tx']
 	case 372: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_adjtime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4663,10 +6613,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 373 long sys_syncfs ['int fd']
 	case 373: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_syncfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syncfs_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
@@ -4674,13 +6625,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 374 long sys_sendmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags']
 	case 374: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendmmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4691,11 +6646,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 375 long sys_setns ['int fd', 'int nstype']
 	case 375: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setns_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setns_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4704,15 +6661,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 376 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 376: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_process_vm_readv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4725,15 +6688,21 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 377 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 377: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_process_vm_writev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4746,14 +6715,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 378 long sys_kcmp ['pid_t pid1', 'pid_t pid2', 'int type', 'unsigned long idx1', 'unsigned long idx2']
 	case 378: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_kcmp_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kcmp_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4765,12 +6739,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 379 long sys_finit_module ['int fd', 'const char __user *uargs', 'int flags']
 	case 379: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_finit_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_finit_module_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4780,12 +6757,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 380 long sys_sched_setattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int flags']
 	case 380: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4795,13 +6775,17 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 381 long sys_sched_getattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int size', 'unsigned int flags']
 	case 381: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4812,14 +6796,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 382 long sys_renameat2 ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'unsigned int flags']
 	case 382: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_renameat2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat2_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4831,12 +6820,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 383 long sys_seccomp ['unsigned int op', 'unsigned int flags', 'const char __user *uargs']
 	case 383: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_seccomp_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_seccomp_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4846,12 +6838,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 384 long sys_getrandom ['char __user *buf', 'size_t count', 'unsigned int flags']
 	case 384: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getrandom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrandom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4861,11 +6856,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 385 long sys_memfd_create ['const char __user *uname_ptr', 'unsigned int flags']
 	case 385: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_memfd_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4874,12 +6871,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 386 long sys_bpf ['int cmd', 'union bpf_attr *attr', 'unsigned int size']
 	case 386: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_bpf_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bpf_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4889,14 +6889,19 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 387 long sys_execveat ['int dfd', 'const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp', 'int flags']
 	case 387: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_execveat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execveat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4908,10 +6913,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 388 long sys_userfaultfd ['int flags']
 	case 388: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_userfaultfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
@@ -4919,11 +6925,13 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 389 long sys_membarrier ['int cmd', 'int flags']
 	case 389: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_membarrier_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_membarrier_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4932,12 +6940,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 390 long sys_mlock2 ['unsigned long start', 'size_t len', 'int flags']
 	case 390: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mlock2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4952,12 +6963,15 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 983042 long ARM_cacheflush ['unsigned long start', 'unsigned long end', 'unsigned long flags']
 	case 983042: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_ARM_cacheflush_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_ARM_cacheflush_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4977,10 +6991,11 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 	// 983045 long ARM_set_tls ['unsigned long arg']
 	case 983045: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_ARM_set_tls_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_ARM_set_tls_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_ARM_set_tls_enter, cpu, pc, arg0);
@@ -4992,7 +7007,7 @@ void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
@@ -13,21 +13,1102 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_linux_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef TARGET_I386
+	subs.assign(376 + 1, unknown);
+	subs[0] = all |
+		(PPP_CHECK_CB(on_sys_restart_syscall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_restart_syscall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[1] = all |
+		(PPP_CHECK_CB(on_sys_exit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_exit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[2] = all |
+		(PPP_CHECK_CB(on_sys_fork_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fork_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[3] = all |
+		(PPP_CHECK_CB(on_sys_read_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_read_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[4] = all |
+		(PPP_CHECK_CB(on_sys_write_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_write_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[5] = all |
+		(PPP_CHECK_CB(on_sys_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[6] = all |
+		(PPP_CHECK_CB(on_sys_close_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_close_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[7] = all |
+		(PPP_CHECK_CB(on_sys_waitpid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_waitpid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[8] = all |
+		(PPP_CHECK_CB(on_sys_creat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_creat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[9] = all |
+		(PPP_CHECK_CB(on_sys_link_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_link_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[10] = all |
+		(PPP_CHECK_CB(on_sys_unlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[11] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_sys_execve_enter) ? SYSCALL_SUB_ENTER : 0);
+	subs[12] = all |
+		(PPP_CHECK_CB(on_sys_chdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[13] = all |
+		(PPP_CHECK_CB(on_sys_time_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_time_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[14] = all |
+		(PPP_CHECK_CB(on_sys_mknod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mknod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[15] = all |
+		(PPP_CHECK_CB(on_sys_chmod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chmod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[16] = all |
+		(PPP_CHECK_CB(on_sys_lchown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lchown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[18] = all |
+		(PPP_CHECK_CB(on_sys_stat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_stat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[19] = all |
+		(PPP_CHECK_CB(on_sys_lseek_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lseek_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[20] = all |
+		(PPP_CHECK_CB(on_sys_getpid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[21] = all |
+		(PPP_CHECK_CB(on_sys_mount_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mount_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[22] = all |
+		(PPP_CHECK_CB(on_sys_oldumount_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_oldumount_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[23] = all |
+		(PPP_CHECK_CB(on_sys_setuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[24] = all |
+		(PPP_CHECK_CB(on_sys_getuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[25] = all |
+		(PPP_CHECK_CB(on_sys_stime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_stime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[26] = all |
+		(PPP_CHECK_CB(on_sys_ptrace_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ptrace_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[27] = all |
+		(PPP_CHECK_CB(on_sys_alarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_alarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[28] = all |
+		(PPP_CHECK_CB(on_sys_fstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[29] = all |
+		(PPP_CHECK_CB(on_sys_pause_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pause_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[30] = all |
+		(PPP_CHECK_CB(on_sys_utime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[33] = all |
+		(PPP_CHECK_CB(on_sys_access_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_access_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[34] = all |
+		(PPP_CHECK_CB(on_sys_nice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_nice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[36] = all |
+		(PPP_CHECK_CB(on_sys_sync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[37] = all |
+		(PPP_CHECK_CB(on_sys_kill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[38] = all |
+		(PPP_CHECK_CB(on_sys_rename_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rename_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[39] = all |
+		(PPP_CHECK_CB(on_sys_mkdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mkdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[40] = all |
+		(PPP_CHECK_CB(on_sys_rmdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rmdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[41] = all |
+		(PPP_CHECK_CB(on_sys_dup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[42] = all |
+		(PPP_CHECK_CB(on_sys_pipe_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pipe_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[43] = all |
+		(PPP_CHECK_CB(on_sys_times_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_times_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[45] = all |
+		(PPP_CHECK_CB(on_sys_brk_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_brk_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[46] = all |
+		(PPP_CHECK_CB(on_sys_setgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[47] = all |
+		(PPP_CHECK_CB(on_sys_getgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[48] = all |
+		(PPP_CHECK_CB(on_sys_signal_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_signal_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[49] = all |
+		(PPP_CHECK_CB(on_sys_geteuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_geteuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[50] = all |
+		(PPP_CHECK_CB(on_sys_getegid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getegid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[51] = all |
+		(PPP_CHECK_CB(on_sys_acct_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_acct_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[52] = all |
+		(PPP_CHECK_CB(on_sys_umount_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_umount_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[54] = all |
+		(PPP_CHECK_CB(on_sys_ioctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[55] = all |
+		(PPP_CHECK_CB(on_sys_fcntl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fcntl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[57] = all |
+		(PPP_CHECK_CB(on_sys_setpgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setpgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[59] = all |
+		(PPP_CHECK_CB(on_sys_olduname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_olduname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[60] = all |
+		(PPP_CHECK_CB(on_sys_umask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_umask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[61] = all |
+		(PPP_CHECK_CB(on_sys_chroot_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chroot_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[62] = all |
+		(PPP_CHECK_CB(on_sys_ustat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ustat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[63] = all |
+		(PPP_CHECK_CB(on_sys_dup2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[64] = all |
+		(PPP_CHECK_CB(on_sys_getppid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getppid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[65] = all |
+		(PPP_CHECK_CB(on_sys_getpgrp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpgrp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[66] = all |
+		(PPP_CHECK_CB(on_sys_setsid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setsid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[67] = all |
+		(PPP_CHECK_CB(on_sys_sigaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[68] = all |
+		(PPP_CHECK_CB(on_sys_sgetmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sgetmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[69] = all |
+		(PPP_CHECK_CB(on_sys_ssetmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ssetmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[70] = all |
+		(PPP_CHECK_CB(on_sys_setreuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setreuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[71] = all |
+		(PPP_CHECK_CB(on_sys_setregid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setregid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[72] = all |
+		(PPP_CHECK_CB(on_sys_sigsuspend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigsuspend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[73] = all |
+		(PPP_CHECK_CB(on_sys_sigpending_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigpending_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[74] = all |
+		(PPP_CHECK_CB(on_sys_sethostname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sethostname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[75] = all |
+		(PPP_CHECK_CB(on_sys_setrlimit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setrlimit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[76] = all |
+		(PPP_CHECK_CB(on_sys_old_getrlimit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_old_getrlimit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[77] = all |
+		(PPP_CHECK_CB(on_sys_getrusage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrusage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[78] = all |
+		(PPP_CHECK_CB(on_sys_gettimeofday_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_gettimeofday_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[79] = all |
+		(PPP_CHECK_CB(on_sys_settimeofday_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_settimeofday_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[80] = all |
+		(PPP_CHECK_CB(on_sys_getgroups16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgroups16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[81] = all |
+		(PPP_CHECK_CB(on_sys_setgroups16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgroups16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[82] = all |
+		(PPP_CHECK_CB(on_sys_old_select_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_old_select_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[83] = all |
+		(PPP_CHECK_CB(on_sys_symlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_symlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[84] = all |
+		(PPP_CHECK_CB(on_sys_lstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[85] = all |
+		(PPP_CHECK_CB(on_sys_readlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[86] = all |
+		(PPP_CHECK_CB(on_sys_uselib_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_uselib_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[87] = all |
+		(PPP_CHECK_CB(on_sys_swapon_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_swapon_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[88] = all |
+		(PPP_CHECK_CB(on_sys_reboot_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_reboot_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[89] = all |
+		(PPP_CHECK_CB(on_sys_old_readdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_old_readdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[90] = all |
+		(PPP_CHECK_CB(on_sys_old_mmap_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_old_mmap_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[91] = all |
+		(PPP_CHECK_CB(on_sys_munmap_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munmap_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[92] = all |
+		(PPP_CHECK_CB(on_sys_truncate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_truncate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[93] = all |
+		(PPP_CHECK_CB(on_sys_ftruncate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ftruncate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[94] = all |
+		(PPP_CHECK_CB(on_sys_fchmod_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchmod_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[95] = all |
+		(PPP_CHECK_CB(on_sys_fchown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[96] = all |
+		(PPP_CHECK_CB(on_sys_getpriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[97] = all |
+		(PPP_CHECK_CB(on_sys_setpriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setpriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[99] = all |
+		(PPP_CHECK_CB(on_sys_statfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_statfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[100] = all |
+		(PPP_CHECK_CB(on_sys_fstatfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[101] = all |
+		(PPP_CHECK_CB(on_sys_ioperm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioperm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[102] = all |
+		(PPP_CHECK_CB(on_sys_socketcall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socketcall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[103] = all |
+		(PPP_CHECK_CB(on_sys_syslog_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_syslog_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[104] = all |
+		(PPP_CHECK_CB(on_sys_setitimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setitimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[105] = all |
+		(PPP_CHECK_CB(on_sys_getitimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getitimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[106] = all |
+		(PPP_CHECK_CB(on_sys_newstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[107] = all |
+		(PPP_CHECK_CB(on_sys_newlstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newlstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[108] = all |
+		(PPP_CHECK_CB(on_sys_newfstat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newfstat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[109] = all |
+		(PPP_CHECK_CB(on_sys_uname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_uname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[110] = all |
+		(PPP_CHECK_CB(on_sys_iopl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_iopl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[111] = all |
+		(PPP_CHECK_CB(on_sys_vhangup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vhangup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[113] = all |
+		(PPP_CHECK_CB(on_sys_vm86old_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vm86old_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[114] = all |
+		(PPP_CHECK_CB(on_sys_wait4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_wait4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[115] = all |
+		(PPP_CHECK_CB(on_sys_swapoff_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_swapoff_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[116] = all |
+		(PPP_CHECK_CB(on_sys_sysinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[117] = all |
+		(PPP_CHECK_CB(on_sys_ipc_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ipc_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[118] = all |
+		(PPP_CHECK_CB(on_sys_fsync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fsync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[119] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_sys_sigreturn_enter) ? SYSCALL_SUB_ENTER : 0);
+	subs[120] = all |
+		(PPP_CHECK_CB(on_sys_clone_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clone_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[121] = all |
+		(PPP_CHECK_CB(on_sys_setdomainname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setdomainname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[122] = all |
+		(PPP_CHECK_CB(on_sys_newuname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_newuname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[123] = all |
+		(PPP_CHECK_CB(on_sys_modify_ldt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_modify_ldt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[124] = all |
+		(PPP_CHECK_CB(on_sys_adjtimex_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_adjtimex_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[125] = all |
+		(PPP_CHECK_CB(on_sys_mprotect_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mprotect_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[126] = all |
+		(PPP_CHECK_CB(on_sys_sigprocmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigprocmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[128] = all |
+		(PPP_CHECK_CB(on_sys_init_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_init_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[129] = all |
+		(PPP_CHECK_CB(on_sys_delete_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_delete_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[131] = all |
+		(PPP_CHECK_CB(on_sys_quotactl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_quotactl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[132] = all |
+		(PPP_CHECK_CB(on_sys_getpgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[133] = all |
+		(PPP_CHECK_CB(on_sys_fchdir_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchdir_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[134] = all |
+		(PPP_CHECK_CB(on_sys_bdflush_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bdflush_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[135] = all |
+		(PPP_CHECK_CB(on_sys_sysfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[136] = all |
+		(PPP_CHECK_CB(on_sys_personality_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_personality_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[138] = all |
+		(PPP_CHECK_CB(on_sys_setfsuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[139] = all |
+		(PPP_CHECK_CB(on_sys_setfsgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[140] = all |
+		(PPP_CHECK_CB(on_sys_llseek_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_llseek_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[141] = all |
+		(PPP_CHECK_CB(on_sys_getdents_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getdents_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[142] = all |
+		(PPP_CHECK_CB(on_sys_select_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_select_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[143] = all |
+		(PPP_CHECK_CB(on_sys_flock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_flock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[144] = all |
+		(PPP_CHECK_CB(on_sys_msync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_msync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[145] = all |
+		(PPP_CHECK_CB(on_sys_readv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[146] = all |
+		(PPP_CHECK_CB(on_sys_writev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_writev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[147] = all |
+		(PPP_CHECK_CB(on_sys_getsid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[148] = all |
+		(PPP_CHECK_CB(on_sys_fdatasync_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fdatasync_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[149] = all |
+		(PPP_CHECK_CB(on_sys_sysctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sysctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[150] = all |
+		(PPP_CHECK_CB(on_sys_mlock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[151] = all |
+		(PPP_CHECK_CB(on_sys_munlock_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munlock_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[152] = all |
+		(PPP_CHECK_CB(on_sys_mlockall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlockall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[153] = all |
+		(PPP_CHECK_CB(on_sys_munlockall_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_munlockall_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[154] = all |
+		(PPP_CHECK_CB(on_sys_sched_setparam_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setparam_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[155] = all |
+		(PPP_CHECK_CB(on_sys_sched_getparam_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getparam_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[156] = all |
+		(PPP_CHECK_CB(on_sys_sched_setscheduler_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setscheduler_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[157] = all |
+		(PPP_CHECK_CB(on_sys_sched_getscheduler_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getscheduler_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[158] = all |
+		(PPP_CHECK_CB(on_sys_sched_yield_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_yield_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[159] = all |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_max_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[160] = all |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_get_priority_min_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[161] = all |
+		(PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_rr_get_interval_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[162] = all |
+		(PPP_CHECK_CB(on_sys_nanosleep_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_nanosleep_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[163] = all |
+		(PPP_CHECK_CB(on_sys_mremap_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mremap_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[164] = all |
+		(PPP_CHECK_CB(on_sys_setresuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[165] = all |
+		(PPP_CHECK_CB(on_sys_getresuid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresuid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[166] = all |
+		(PPP_CHECK_CB(on_sys_vm86_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vm86_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[168] = all |
+		(PPP_CHECK_CB(on_sys_poll_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_poll_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[170] = all |
+		(PPP_CHECK_CB(on_sys_setresgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[171] = all |
+		(PPP_CHECK_CB(on_sys_getresgid16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresgid16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[172] = all |
+		(PPP_CHECK_CB(on_sys_prctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_prctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[173] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigreturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigreturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[174] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[175] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigprocmask_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[176] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigpending_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigpending_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[177] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigtimedwait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[178] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[179] = all |
+		(PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_sigsuspend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[180] = all |
+		(PPP_CHECK_CB(on_sys_pread64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pread64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[181] = all |
+		(PPP_CHECK_CB(on_sys_pwrite64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pwrite64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[182] = all |
+		(PPP_CHECK_CB(on_sys_chown16_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chown16_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[183] = all |
+		(PPP_CHECK_CB(on_sys_getcwd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getcwd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[184] = all |
+		(PPP_CHECK_CB(on_sys_capget_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_capget_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[185] = all |
+		(PPP_CHECK_CB(on_sys_capset_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_capset_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[186] = all |
+		(PPP_CHECK_CB(on_sys_sigaltstack_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sigaltstack_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[187] = all |
+		(PPP_CHECK_CB(on_sys_sendfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[190] = all |
+		(PPP_CHECK_CB(on_sys_vfork_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vfork_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[191] = all |
+		(PPP_CHECK_CB(on_sys_getrlimit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrlimit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[192] = all |
+		(PPP_CHECK_CB(on_sys_mmap_pgoff_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mmap_pgoff_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[193] = all |
+		(PPP_CHECK_CB(on_sys_truncate64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_truncate64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[194] = all |
+		(PPP_CHECK_CB(on_sys_ftruncate64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ftruncate64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[195] = all |
+		(PPP_CHECK_CB(on_sys_stat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_stat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[196] = all |
+		(PPP_CHECK_CB(on_sys_lstat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lstat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[197] = all |
+		(PPP_CHECK_CB(on_sys_fstat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[198] = all |
+		(PPP_CHECK_CB(on_sys_lchown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lchown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[199] = all |
+		(PPP_CHECK_CB(on_sys_getuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[200] = all |
+		(PPP_CHECK_CB(on_sys_getgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[201] = all |
+		(PPP_CHECK_CB(on_sys_geteuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_geteuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[202] = all |
+		(PPP_CHECK_CB(on_sys_getegid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getegid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[203] = all |
+		(PPP_CHECK_CB(on_sys_setreuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setreuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[204] = all |
+		(PPP_CHECK_CB(on_sys_setregid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setregid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[205] = all |
+		(PPP_CHECK_CB(on_sys_getgroups_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getgroups_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[206] = all |
+		(PPP_CHECK_CB(on_sys_setgroups_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgroups_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[207] = all |
+		(PPP_CHECK_CB(on_sys_fchown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[208] = all |
+		(PPP_CHECK_CB(on_sys_setresuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[209] = all |
+		(PPP_CHECK_CB(on_sys_getresuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[210] = all |
+		(PPP_CHECK_CB(on_sys_setresgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setresgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[211] = all |
+		(PPP_CHECK_CB(on_sys_getresgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getresgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[212] = all |
+		(PPP_CHECK_CB(on_sys_chown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_chown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[213] = all |
+		(PPP_CHECK_CB(on_sys_setuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[214] = all |
+		(PPP_CHECK_CB(on_sys_setgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[215] = all |
+		(PPP_CHECK_CB(on_sys_setfsuid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsuid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[216] = all |
+		(PPP_CHECK_CB(on_sys_setfsgid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setfsgid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[217] = all |
+		(PPP_CHECK_CB(on_sys_pivot_root_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pivot_root_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[218] = all |
+		(PPP_CHECK_CB(on_sys_mincore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mincore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[219] = all |
+		(PPP_CHECK_CB(on_sys_madvise_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_madvise_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[220] = all |
+		(PPP_CHECK_CB(on_sys_getdents64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getdents64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[221] = all |
+		(PPP_CHECK_CB(on_sys_fcntl64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fcntl64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[224] = all |
+		(PPP_CHECK_CB(on_sys_gettid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_gettid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[225] = all |
+		(PPP_CHECK_CB(on_sys_readahead_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readahead_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[226] = all |
+		(PPP_CHECK_CB(on_sys_setxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[227] = all |
+		(PPP_CHECK_CB(on_sys_lsetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lsetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[228] = all |
+		(PPP_CHECK_CB(on_sys_fsetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fsetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[229] = all |
+		(PPP_CHECK_CB(on_sys_getxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[230] = all |
+		(PPP_CHECK_CB(on_sys_lgetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lgetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[231] = all |
+		(PPP_CHECK_CB(on_sys_fgetxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fgetxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[232] = all |
+		(PPP_CHECK_CB(on_sys_listxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_listxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[233] = all |
+		(PPP_CHECK_CB(on_sys_llistxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_llistxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[234] = all |
+		(PPP_CHECK_CB(on_sys_flistxattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_flistxattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[235] = all |
+		(PPP_CHECK_CB(on_sys_removexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_removexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[236] = all |
+		(PPP_CHECK_CB(on_sys_lremovexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lremovexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[237] = all |
+		(PPP_CHECK_CB(on_sys_fremovexattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fremovexattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[238] = all |
+		(PPP_CHECK_CB(on_sys_tkill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tkill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[239] = all |
+		(PPP_CHECK_CB(on_sys_sendfile64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendfile64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[240] = all |
+		(PPP_CHECK_CB(on_sys_futex_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_futex_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[241] = all |
+		(PPP_CHECK_CB(on_sys_sched_setaffinity_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setaffinity_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[242] = all |
+		(PPP_CHECK_CB(on_sys_sched_getaffinity_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getaffinity_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[243] = all |
+		(PPP_CHECK_CB(on_sys_set_thread_area_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_thread_area_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[244] = all |
+		(PPP_CHECK_CB(on_sys_get_thread_area_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_get_thread_area_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[245] = all |
+		(PPP_CHECK_CB(on_sys_io_setup_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_setup_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[246] = all |
+		(PPP_CHECK_CB(on_sys_io_destroy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_destroy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[247] = all |
+		(PPP_CHECK_CB(on_sys_io_getevents_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_getevents_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[248] = all |
+		(PPP_CHECK_CB(on_sys_io_submit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_submit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[249] = all |
+		(PPP_CHECK_CB(on_sys_io_cancel_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_io_cancel_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[250] = all |
+		(PPP_CHECK_CB(on_sys_fadvise64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fadvise64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[252] = (all & ~SYSCALL_SUB_RETURN) |
+		(PPP_CHECK_CB(on_sys_exit_group_enter) ? SYSCALL_SUB_ENTER : 0);
+	subs[253] = all |
+		(PPP_CHECK_CB(on_sys_lookup_dcookie_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_lookup_dcookie_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[254] = all |
+		(PPP_CHECK_CB(on_sys_epoll_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[255] = all |
+		(PPP_CHECK_CB(on_sys_epoll_ctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_ctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[256] = all |
+		(PPP_CHECK_CB(on_sys_epoll_wait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_wait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[257] = all |
+		(PPP_CHECK_CB(on_sys_remap_file_pages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_remap_file_pages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[258] = all |
+		(PPP_CHECK_CB(on_sys_set_tid_address_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_tid_address_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[259] = all |
+		(PPP_CHECK_CB(on_sys_timer_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[260] = all |
+		(PPP_CHECK_CB(on_sys_timer_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[261] = all |
+		(PPP_CHECK_CB(on_sys_timer_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[262] = all |
+		(PPP_CHECK_CB(on_sys_timer_getoverrun_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_getoverrun_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[263] = all |
+		(PPP_CHECK_CB(on_sys_timer_delete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timer_delete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[264] = all |
+		(PPP_CHECK_CB(on_sys_clock_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[265] = all |
+		(PPP_CHECK_CB(on_sys_clock_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[266] = all |
+		(PPP_CHECK_CB(on_sys_clock_getres_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_getres_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[267] = all |
+		(PPP_CHECK_CB(on_sys_clock_nanosleep_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_nanosleep_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[268] = all |
+		(PPP_CHECK_CB(on_sys_statfs64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_statfs64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[269] = all |
+		(PPP_CHECK_CB(on_sys_fstatfs64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatfs64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[270] = all |
+		(PPP_CHECK_CB(on_sys_tgkill_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tgkill_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[271] = all |
+		(PPP_CHECK_CB(on_sys_utimes_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utimes_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[272] = all |
+		(PPP_CHECK_CB(on_sys_fadvise64_64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fadvise64_64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[274] = all |
+		(PPP_CHECK_CB(on_sys_mbind_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mbind_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[275] = all |
+		(PPP_CHECK_CB(on_sys_get_mempolicy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_get_mempolicy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[276] = all |
+		(PPP_CHECK_CB(on_sys_set_mempolicy_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_mempolicy_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[277] = all |
+		(PPP_CHECK_CB(on_sys_mq_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[278] = all |
+		(PPP_CHECK_CB(on_sys_mq_unlink_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_unlink_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[279] = all |
+		(PPP_CHECK_CB(on_sys_mq_timedsend_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_timedsend_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[280] = all |
+		(PPP_CHECK_CB(on_sys_mq_timedreceive_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_timedreceive_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[281] = all |
+		(PPP_CHECK_CB(on_sys_mq_notify_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_notify_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[282] = all |
+		(PPP_CHECK_CB(on_sys_mq_getsetattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mq_getsetattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[283] = all |
+		(PPP_CHECK_CB(on_sys_kexec_load_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kexec_load_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[284] = all |
+		(PPP_CHECK_CB(on_sys_waitid_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_waitid_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[286] = all |
+		(PPP_CHECK_CB(on_sys_add_key_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_add_key_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[287] = all |
+		(PPP_CHECK_CB(on_sys_request_key_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_request_key_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[288] = all |
+		(PPP_CHECK_CB(on_sys_keyctl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_keyctl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[289] = all |
+		(PPP_CHECK_CB(on_sys_ioprio_set_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioprio_set_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[290] = all |
+		(PPP_CHECK_CB(on_sys_ioprio_get_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ioprio_get_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[291] = all |
+		(PPP_CHECK_CB(on_sys_inotify_init_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_init_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[292] = all |
+		(PPP_CHECK_CB(on_sys_inotify_add_watch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_add_watch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[293] = all |
+		(PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_rm_watch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[294] = all |
+		(PPP_CHECK_CB(on_sys_migrate_pages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_migrate_pages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[295] = all |
+		(PPP_CHECK_CB(on_sys_openat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_openat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[296] = all |
+		(PPP_CHECK_CB(on_sys_mkdirat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mkdirat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[297] = all |
+		(PPP_CHECK_CB(on_sys_mknodat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mknodat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[298] = all |
+		(PPP_CHECK_CB(on_sys_fchownat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchownat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[299] = all |
+		(PPP_CHECK_CB(on_sys_futimesat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_futimesat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[300] = all |
+		(PPP_CHECK_CB(on_sys_fstatat64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fstatat64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[301] = all |
+		(PPP_CHECK_CB(on_sys_unlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[302] = all |
+		(PPP_CHECK_CB(on_sys_renameat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_renameat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[303] = all |
+		(PPP_CHECK_CB(on_sys_linkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_linkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[304] = all |
+		(PPP_CHECK_CB(on_sys_symlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_symlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[305] = all |
+		(PPP_CHECK_CB(on_sys_readlinkat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_readlinkat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[306] = all |
+		(PPP_CHECK_CB(on_sys_fchmodat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fchmodat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[307] = all |
+		(PPP_CHECK_CB(on_sys_faccessat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_faccessat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[308] = all |
+		(PPP_CHECK_CB(on_sys_pselect6_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pselect6_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[309] = all |
+		(PPP_CHECK_CB(on_sys_ppoll_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_ppoll_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[310] = all |
+		(PPP_CHECK_CB(on_sys_unshare_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_unshare_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[311] = all |
+		(PPP_CHECK_CB(on_sys_set_robust_list_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_set_robust_list_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[312] = all |
+		(PPP_CHECK_CB(on_sys_get_robust_list_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_get_robust_list_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[313] = all |
+		(PPP_CHECK_CB(on_sys_splice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_splice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[314] = all |
+		(PPP_CHECK_CB(on_sys_sync_file_range_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sync_file_range_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[315] = all |
+		(PPP_CHECK_CB(on_sys_tee_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_tee_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[316] = all |
+		(PPP_CHECK_CB(on_sys_vmsplice_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_vmsplice_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[317] = all |
+		(PPP_CHECK_CB(on_sys_move_pages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_move_pages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[318] = all |
+		(PPP_CHECK_CB(on_sys_getcpu_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getcpu_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[319] = all |
+		(PPP_CHECK_CB(on_sys_epoll_pwait_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_pwait_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[320] = all |
+		(PPP_CHECK_CB(on_sys_utimensat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_utimensat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[321] = all |
+		(PPP_CHECK_CB(on_sys_signalfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_signalfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[322] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[323] = all |
+		(PPP_CHECK_CB(on_sys_eventfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_eventfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[324] = all |
+		(PPP_CHECK_CB(on_sys_fallocate_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fallocate_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[325] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_settime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_settime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[326] = all |
+		(PPP_CHECK_CB(on_sys_timerfd_gettime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_timerfd_gettime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[327] = all |
+		(PPP_CHECK_CB(on_sys_signalfd4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_signalfd4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[328] = all |
+		(PPP_CHECK_CB(on_sys_eventfd2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_eventfd2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[329] = all |
+		(PPP_CHECK_CB(on_sys_epoll_create1_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_epoll_create1_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[330] = all |
+		(PPP_CHECK_CB(on_sys_dup3_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_dup3_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[331] = all |
+		(PPP_CHECK_CB(on_sys_pipe2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pipe2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[332] = all |
+		(PPP_CHECK_CB(on_sys_inotify_init1_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_inotify_init1_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[333] = all |
+		(PPP_CHECK_CB(on_sys_preadv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_preadv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[334] = all |
+		(PPP_CHECK_CB(on_sys_pwritev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_pwritev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[335] = all |
+		(PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[336] = all |
+		(PPP_CHECK_CB(on_sys_perf_event_open_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_perf_event_open_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[337] = all |
+		(PPP_CHECK_CB(on_sys_recvmmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvmmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[338] = all |
+		(PPP_CHECK_CB(on_sys_fanotify_init_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fanotify_init_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[339] = all |
+		(PPP_CHECK_CB(on_sys_fanotify_mark_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_fanotify_mark_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[340] = all |
+		(PPP_CHECK_CB(on_sys_prlimit64_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_prlimit64_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[341] = all |
+		(PPP_CHECK_CB(on_sys_name_to_handle_at_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_name_to_handle_at_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[342] = all |
+		(PPP_CHECK_CB(on_sys_open_by_handle_at_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_open_by_handle_at_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[343] = all |
+		(PPP_CHECK_CB(on_sys_clock_adjtime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_clock_adjtime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[344] = all |
+		(PPP_CHECK_CB(on_sys_syncfs_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_syncfs_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[345] = all |
+		(PPP_CHECK_CB(on_sys_sendmmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendmmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[346] = all |
+		(PPP_CHECK_CB(on_sys_setns_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setns_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[347] = all |
+		(PPP_CHECK_CB(on_sys_process_vm_readv_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_process_vm_readv_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[348] = all |
+		(PPP_CHECK_CB(on_sys_process_vm_writev_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_process_vm_writev_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[349] = all |
+		(PPP_CHECK_CB(on_sys_kcmp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_kcmp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[350] = all |
+		(PPP_CHECK_CB(on_sys_finit_module_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_finit_module_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[351] = all |
+		(PPP_CHECK_CB(on_sys_sched_setattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_setattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[352] = all |
+		(PPP_CHECK_CB(on_sys_sched_getattr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sched_getattr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[353] = all |
+		(PPP_CHECK_CB(on_sys_renameat2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_renameat2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[354] = all |
+		(PPP_CHECK_CB(on_sys_seccomp_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_seccomp_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[355] = all |
+		(PPP_CHECK_CB(on_sys_getrandom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getrandom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[356] = all |
+		(PPP_CHECK_CB(on_sys_memfd_create_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_memfd_create_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[357] = all |
+		(PPP_CHECK_CB(on_sys_bpf_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bpf_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[358] = all |
+		(PPP_CHECK_CB(on_sys_execveat_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_execveat_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[359] = all |
+		(PPP_CHECK_CB(on_sys_socket_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socket_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[360] = all |
+		(PPP_CHECK_CB(on_sys_socketpair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_socketpair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[361] = all |
+		(PPP_CHECK_CB(on_sys_bind_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_bind_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[362] = all |
+		(PPP_CHECK_CB(on_sys_connect_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_connect_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[363] = all |
+		(PPP_CHECK_CB(on_sys_listen_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_listen_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[364] = all |
+		(PPP_CHECK_CB(on_sys_accept4_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_accept4_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[365] = all |
+		(PPP_CHECK_CB(on_sys_getsockopt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsockopt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[366] = all |
+		(PPP_CHECK_CB(on_sys_setsockopt_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_setsockopt_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[367] = all |
+		(PPP_CHECK_CB(on_sys_getsockname_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getsockname_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[368] = all |
+		(PPP_CHECK_CB(on_sys_getpeername_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_getpeername_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[369] = all |
+		(PPP_CHECK_CB(on_sys_sendto_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendto_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[370] = all |
+		(PPP_CHECK_CB(on_sys_sendmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_sendmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[371] = all |
+		(PPP_CHECK_CB(on_sys_recvfrom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvfrom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[372] = all |
+		(PPP_CHECK_CB(on_sys_recvmsg_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_recvmsg_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[373] = all |
+		(PPP_CHECK_CB(on_sys_shutdown_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_shutdown_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[374] = all |
+		(PPP_CHECK_CB(on_sys_userfaultfd_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_userfaultfd_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[375] = all |
+		(PPP_CHECK_CB(on_sys_membarrier_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_membarrier_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[376] = all |
+		(PPP_CHECK_CB(on_sys_mlock2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_sys_mlock2_return) ? SYSCALL_SUB_RETURN : 0);
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 #ifdef TARGET_I386
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[R_EAX];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -40,10 +1121,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 1 long sys_exit ['int error_code']
 	case 1: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_exit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_exit_enter, cpu, pc, arg0);
@@ -56,12 +1138,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 3 long sys_read ['unsigned int fd', 'char __user *buf', 'size_t count']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_read_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_read_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -71,12 +1156,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 4 long sys_write ['unsigned int fd', 'const char __user *buf', 'size_t count']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_write_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_write_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -86,12 +1174,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 5 long sys_open ['const char __user *filename', 'int flags', 'umode_t mode']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -101,10 +1192,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 6 long sys_close ['unsigned int fd']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_close_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_close_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_close_enter, cpu, pc, arg0);
@@ -112,12 +1204,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 7 long sys_waitpid ['pid_t pid', 'int __user *stat_addr', 'int options']
 	case 7: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_waitpid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitpid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -127,11 +1222,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 8 long sys_creat ['const char __user *pathname', 'umode_t mode']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_creat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_creat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -140,11 +1237,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 9 long sys_link ['const char __user *oldname', 'const char __user *newname']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_link_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_link_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -153,10 +1252,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 10 long sys_unlink ['const char __user *pathname']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_unlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlink_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_unlink_enter, cpu, pc, arg0);
@@ -164,12 +1264,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 11 long sys_execve ['const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp']
 	case 11: {
 		panda_noreturn = true;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_execve_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execve_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -179,10 +1282,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 12 long sys_chdir ['const char __user *filename']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_chdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_chdir_enter, cpu, pc, arg0);
@@ -190,10 +1294,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 13 long sys_time ['time_t __user *tloc']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_time_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_time_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_time_enter, cpu, pc, arg0);
@@ -201,12 +1306,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 14 long sys_mknod ['const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mknod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -216,11 +1324,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 15 long sys_chmod ['const char __user *filename', 'umode_t mode']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_chmod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chmod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -229,12 +1339,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 16 long sys_lchown16 ['const char __user *filename', 'old_uid_t user', 'old_gid_t group']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lchown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -244,11 +1357,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 18 long sys_stat ['const char __user *filename', 'struct __old_kernel_stat __user *statbuf']
 	case 18: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_stat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -257,12 +1372,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 19 long sys_lseek ['unsigned int fd', 'off_t offset', 'unsigned int whence']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lseek_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lseek_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -277,14 +1395,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 21 long sys_mount ['char __user *dev_name', 'char __user *dir_name', 'char __user *type', 'unsigned long flags', 'void __user *data']
 	case 21: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mount_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mount_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -296,10 +1419,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 22 long sys_oldumount ['char __user *name']
 	case 22: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_oldumount_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_oldumount_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_oldumount_enter, cpu, pc, arg0);
@@ -307,10 +1431,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 23 long sys_setuid16 ['old_uid_t uid']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setuid16_enter, cpu, pc, arg0);
@@ -323,10 +1448,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 25 long sys_stime ['time_t __user *tptr']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_stime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stime_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_stime_enter, cpu, pc, arg0);
@@ -334,13 +1460,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 26 long sys_ptrace ['long request', 'long pid', 'unsigned long addr', 'unsigned long data']
 	case 26: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_ptrace_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ptrace_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -351,10 +1481,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 27 long sys_alarm ['unsigned int seconds']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_alarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_alarm_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_alarm_enter, cpu, pc, arg0);
@@ -362,11 +1493,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 28 long sys_fstat ['unsigned int fd', 'struct __old_kernel_stat __user *statbuf']
 	case 28: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -380,11 +1513,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 30 long sys_utime ['char __user *filename', 'struct utimbuf __user *times']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_utime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -393,11 +1528,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 33 long sys_access ['const char __user *filename', 'int mode']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_access_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_access_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -406,10 +1543,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 34 long sys_nice ['int increment']
 	case 34: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_nice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nice_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_nice_enter, cpu, pc, arg0);
@@ -422,11 +1560,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 37 long sys_kill ['int pid', 'int sig']
 	case 37: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_kill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -435,11 +1575,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 38 long sys_rename ['const char __user *oldname', 'const char __user *newname']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rename_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rename_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -448,11 +1590,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 39 long sys_mkdir ['const char __user *pathname', 'umode_t mode']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mkdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdir_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -461,10 +1605,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 40 long sys_rmdir ['const char __user *pathname']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_rmdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rmdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_rmdir_enter, cpu, pc, arg0);
@@ -472,10 +1617,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 41 long sys_dup ['unsigned int fildes']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_dup_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_dup_enter, cpu, pc, arg0);
@@ -483,10 +1629,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 42 long sys_pipe ['int __user *fildes']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_pipe_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_pipe_enter, cpu, pc, arg0);
@@ -494,10 +1641,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 43 long sys_times ['struct tms __user *tbuf']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_times_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_times_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_times_enter, cpu, pc, arg0);
@@ -505,10 +1653,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 45 long sys_brk ['unsigned long brk']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_brk_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_brk_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_brk_enter, cpu, pc, arg0);
@@ -516,10 +1665,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 46 long sys_setgid16 ['old_gid_t gid']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setgid16_enter, cpu, pc, arg0);
@@ -532,11 +1682,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 48 long sys_signal ['int sig', '__sighandler_t handler']
 	case 48: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_signal_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signal_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -555,10 +1707,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 51 long sys_acct ['const char __user *name']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_acct_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_acct_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_acct_enter, cpu, pc, arg0);
@@ -566,11 +1719,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 52 long sys_umount ['char __user *name', 'int flags']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_umount_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umount_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -579,12 +1734,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 54 long sys_ioctl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_ioctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioctl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -594,12 +1752,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 55 long sys_fcntl ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fcntl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -609,11 +1770,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 57 long sys_setpgid ['pid_t pid', 'pid_t pgid']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setpgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -622,10 +1785,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 59 long sys_olduname ['struct oldold_utsname __user *']
 	case 59: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_olduname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_olduname_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_olduname_enter, cpu, pc, arg0);
@@ -633,10 +1797,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 60 long sys_umask ['int mask']
 	case 60: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_umask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_umask_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_umask_enter, cpu, pc, arg0);
@@ -644,10 +1809,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 61 long sys_chroot ['const char __user *filename']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_chroot_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chroot_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_chroot_enter, cpu, pc, arg0);
@@ -655,11 +1821,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 62 long sys_ustat ['unsigned dev', 'struct ustat __user *ubuf']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ustat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ustat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -668,11 +1836,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 63 long sys_dup2 ['unsigned int oldfd', 'unsigned int newfd']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_dup2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -696,12 +1866,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 67 long sys_sigaction ['int', 'const struct old_sigaction __user *', 'struct old_sigaction __user *']
 	case 67: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaction_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -716,10 +1889,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 69 long sys_ssetmask ['int newmask']
 	case 69: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_ssetmask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ssetmask_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_ssetmask_enter, cpu, pc, arg0);
@@ -727,11 +1901,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 70 long sys_setreuid16 ['old_uid_t ruid', 'old_uid_t euid']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setreuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -740,11 +1916,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 71 long sys_setregid16 ['old_gid_t rgid', 'old_gid_t egid']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setregid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -753,12 +1931,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 72 long sys_sigsuspend ['int unused1', 'int unused2', 'old_sigset_t mask']
 	case 72: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigsuspend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigsuspend_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -768,10 +1949,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 73 long sys_sigpending ['old_sigset_t __user *set']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sigpending_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigpending_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sigpending_enter, cpu, pc, arg0);
@@ -779,11 +1961,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 74 long sys_sethostname ['char __user *name', 'int len']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sethostname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sethostname_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -792,11 +1976,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 75 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setrlimit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setrlimit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -805,11 +1991,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 76 long sys_old_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 76: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_old_getrlimit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_getrlimit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -818,11 +2006,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 77 long sys_getrusage ['int who', 'struct rusage __user *ru']
 	case 77: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getrusage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrusage_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -831,11 +2021,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 78 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_gettimeofday_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_gettimeofday_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -844,11 +2036,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 79 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_settimeofday_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_settimeofday_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -857,11 +2051,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 80 long sys_getgroups16 ['int gidsetsize', 'old_gid_t __user *grouplist']
 	case 80: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getgroups16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups16_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -870,11 +2066,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 81 long sys_setgroups16 ['int gidsetsize', 'old_gid_t __user *grouplist']
 	case 81: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setgroups16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups16_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -883,10 +2081,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 82 long sys_old_select ['struct sel_arg_struct __user *arg']
 	case 82: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_old_select_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_select_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_old_select_enter, cpu, pc, arg0);
@@ -894,11 +2093,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 83 long sys_symlink ['const char __user *old', 'const char __user *new']
 	case 83: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_symlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlink_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -907,11 +2108,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 84 long sys_lstat ['const char __user *filename', 'struct __old_kernel_stat __user *statbuf']
 	case 84: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_lstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -920,12 +2123,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 85 long sys_readlink ['const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlink_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -935,10 +2141,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 86 long sys_uselib ['const char __user *library']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_uselib_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uselib_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_uselib_enter, cpu, pc, arg0);
@@ -946,11 +2153,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 87 long sys_swapon ['const char __user *specialfile', 'int swap_flags']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_swapon_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapon_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -959,13 +2168,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 88 long sys_reboot ['int magic1', 'int magic2', 'unsigned int cmd', 'void __user *arg']
 	case 88: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_reboot_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_reboot_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -976,12 +2189,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 89 long sys_old_readdir ['unsigned int', 'struct old_linux_dirent __user *', 'unsigned int']
 	case 89: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_old_readdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_readdir_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -991,10 +2207,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 90 long sys_old_mmap ['struct mmap_arg_struct __user *arg']
 	case 90: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_old_mmap_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_old_mmap_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_old_mmap_enter, cpu, pc, arg0);
@@ -1002,11 +2219,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 91 long sys_munmap ['unsigned long addr', 'size_t len']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_munmap_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munmap_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1015,11 +2234,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 92 long sys_truncate ['const char __user *path', 'long length']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_truncate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1028,11 +2249,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 93 long sys_ftruncate ['unsigned int fd', 'unsigned long length']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ftruncate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1041,11 +2264,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 94 long sys_fchmod ['unsigned int fd', 'umode_t mode']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fchmod_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmod_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1054,12 +2279,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 95 long sys_fchown16 ['unsigned int fd', 'old_uid_t user', 'old_gid_t group']
 	case 95: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1069,11 +2297,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 96 long sys_getpriority ['int which', 'int who']
 	case 96: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getpriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpriority_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1082,12 +2312,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 97 long sys_setpriority ['int which', 'int who', 'int niceval']
 	case 97: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setpriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setpriority_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1097,11 +2330,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 99 long sys_statfs ['const char __user *path', 'struct statfs __user *buf']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_statfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1110,11 +2345,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 100 long sys_fstatfs ['unsigned int fd', 'struct statfs __user *buf']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1123,12 +2360,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 101 long sys_ioperm ['unsigned long', 'unsigned long', 'int']
 	case 101: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_ioperm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioperm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1138,11 +2378,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 102 long sys_socketcall ['int call', 'unsigned long __user *args']
 	case 102: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_socketcall_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketcall_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1151,12 +2393,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 103 long sys_syslog ['int type', 'char __user *buf', 'int len']
 	case 103: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_syslog_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syslog_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1166,12 +2411,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 104 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
 	case 104: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setitimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setitimer_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1181,11 +2429,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 105 long sys_getitimer ['int which', 'struct itimerval __user *value']
 	case 105: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getitimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getitimer_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1194,11 +2444,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 106 long sys_newstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1207,11 +2459,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 107 long sys_newlstat ['const char __user *filename', 'struct stat __user *statbuf']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newlstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newlstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1220,11 +2474,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 108 long sys_newfstat ['unsigned int fd', 'struct stat __user *statbuf']
 	case 108: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_newfstat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newfstat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1233,10 +2489,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 109 long sys_uname ['struct old_utsname __user *']
 	case 109: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_uname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_uname_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_uname_enter, cpu, pc, arg0);
@@ -1244,10 +2501,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 110 long sys_iopl ['unsigned int']
 	case 110: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_iopl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_iopl_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_iopl_enter, cpu, pc, arg0);
@@ -1260,10 +2518,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 113 long sys_vm86old ['struct vm86_struct __user *']
 	case 113: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_vm86old_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vm86old_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_vm86old_enter, cpu, pc, arg0);
@@ -1271,13 +2530,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 114 long sys_wait4 ['pid_t pid', 'int __user *stat_addr', 'int options', 'struct rusage __user *ru']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_wait4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_wait4_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1288,10 +2551,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 115 long sys_swapoff ['const char __user *specialfile']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_swapoff_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_swapoff_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_swapoff_enter, cpu, pc, arg0);
@@ -1299,10 +2563,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 116 long sys_sysinfo ['struct sysinfo __user *info']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sysinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysinfo_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sysinfo_enter, cpu, pc, arg0);
@@ -1310,15 +2575,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 117 long sys_ipc ['unsigned int call', 'int first', 'unsigned long second', 'unsigned long third', 'void __user *ptr', 'long fifth']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_ipc_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ipc_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1331,10 +2602,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 118 long sys_fsync ['unsigned int fd']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fsync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsync_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fsync_enter, cpu, pc, arg0);
@@ -1347,14 +2619,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 120 long sys_clone ['unsigned long', 'unsigned long', 'int __user *', 'int __user *', 'unsigned long']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_clone_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clone_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1366,11 +2643,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 121 long sys_setdomainname ['char __user *name', 'int len']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setdomainname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setdomainname_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1379,10 +2658,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 122 long sys_newuname ['struct new_utsname __user *name']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_newuname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_newuname_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_newuname_enter, cpu, pc, arg0);
@@ -1390,12 +2670,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 123 long sys_modify_ldt ['int', 'void __user *', 'unsigned long']
 	case 123: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_modify_ldt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_modify_ldt_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1405,10 +2688,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 124 long sys_adjtimex ['struct timex __user *txc_p']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_adjtimex_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_adjtimex_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_adjtimex_enter, cpu, pc, arg0);
@@ -1416,12 +2700,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 125 long sys_mprotect ['unsigned long start', 'size_t len', 'unsigned long prot']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mprotect_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mprotect_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1431,12 +2718,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 126 long sys_sigprocmask ['int how', 'old_sigset_t __user *set', 'old_sigset_t __user *oset']
 	case 126: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sigprocmask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigprocmask_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1446,12 +2736,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 128 long sys_init_module ['void __user *umod', 'unsigned long len', 'const char __user *uargs']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_init_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_init_module_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1461,11 +2754,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 129 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
 	case 129: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_delete_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_delete_module_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1474,13 +2769,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 131 long sys_quotactl ['unsigned int cmd', 'const char __user *special', 'qid_t id', 'void __user *addr']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_quotactl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_quotactl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1491,10 +2790,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 132 long sys_getpgid ['pid_t pid']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_getpgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_getpgid_enter, cpu, pc, arg0);
@@ -1502,10 +2802,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 133 long sys_fchdir ['unsigned int fd']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fchdir_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchdir_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fchdir_enter, cpu, pc, arg0);
@@ -1513,11 +2814,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 134 long sys_bdflush ['int func', 'long data']
 	case 134: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_bdflush_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bdflush_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -1526,12 +2829,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 135 long sys_sysfs ['int option', 'unsigned long arg1', 'unsigned long arg2']
 	case 135: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sysfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysfs_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1541,10 +2847,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 136 long sys_personality ['unsigned int personality']
 	case 136: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_personality_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_personality_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_personality_enter, cpu, pc, arg0);
@@ -1552,10 +2859,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 138 long sys_setfsuid16 ['old_uid_t uid']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsuid16_enter, cpu, pc, arg0);
@@ -1563,10 +2871,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 139 long sys_setfsgid16 ['old_gid_t gid']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid16_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsgid16_enter, cpu, pc, arg0);
@@ -1574,14 +2883,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 140 long sys_llseek ['unsigned int fd', 'unsigned long offset_high', 'unsigned long offset_low', 'loff_t __user *result', 'unsigned int whence']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_llseek_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llseek_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1593,12 +2907,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 141 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getdents_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1608,14 +2925,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 142 long sys_select ['int n', 'fd_set __user *inp', 'fd_set __user *outp', 'fd_set __user *exp', 'struct timeval __user *tvp']
 	case 142: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_select_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_select_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1627,11 +2949,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 143 long sys_flock ['unsigned int fd', 'unsigned int cmd']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_flock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1640,12 +2964,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 144 long sys_msync ['unsigned long start', 'size_t len', 'int flags']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_msync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_msync_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1655,12 +2982,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 145 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1670,12 +3000,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 146 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_writev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_writev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1685,10 +3018,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 147 long sys_getsid ['pid_t pid']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_getsid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_getsid_enter, cpu, pc, arg0);
@@ -1696,10 +3030,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 148 long sys_fdatasync ['unsigned int fd']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_fdatasync_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fdatasync_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_fdatasync_enter, cpu, pc, arg0);
@@ -1707,10 +3042,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 149 long sys_sysctl ['struct __sysctl_args __user *args']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sysctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sysctl_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sysctl_enter, cpu, pc, arg0);
@@ -1718,11 +3054,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 150 long sys_mlock ['unsigned long start', 'size_t len']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mlock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1731,11 +3069,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 151 long sys_munlock ['unsigned long start', 'size_t len']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_munlock_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_munlock_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1744,10 +3084,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 152 long sys_mlockall ['int flags']
 	case 152: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_mlockall_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlockall_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_mlockall_enter, cpu, pc, arg0);
@@ -1760,11 +3101,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 154 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setparam_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setparam_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1773,11 +3116,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 155 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getparam_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getparam_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1786,12 +3131,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 156 long sys_sched_setscheduler ['pid_t pid', 'int policy', 'struct sched_param __user *param']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setscheduler_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setscheduler_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1801,10 +3149,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 157 long sys_sched_getscheduler ['pid_t pid']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getscheduler_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getscheduler_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_getscheduler_enter, cpu, pc, arg0);
@@ -1817,10 +3166,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 159 long sys_sched_get_priority_max ['int policy']
 	case 159: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_get_priority_max_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_max_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_get_priority_max_enter, cpu, pc, arg0);
@@ -1828,10 +3178,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 160 long sys_sched_get_priority_min ['int policy']
 	case 160: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_get_priority_min_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_get_priority_min_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_sched_get_priority_min_enter, cpu, pc, arg0);
@@ -1839,11 +3190,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 161 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_rr_get_interval_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_rr_get_interval_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1852,11 +3205,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 162 long sys_nanosleep ['struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_nanosleep_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_nanosleep_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1865,14 +3220,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 163 long sys_mremap ['unsigned long addr', 'unsigned long old_len', 'unsigned long new_len', 'unsigned long flags', 'unsigned long new_addr']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mremap_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mremap_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1884,12 +3244,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 164 long sys_setresuid16 ['old_uid_t ruid', 'old_uid_t euid', 'old_uid_t suid']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1899,12 +3262,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 165 long sys_getresuid16 ['old_uid_t __user *ruid', 'old_uid_t __user *euid', 'old_uid_t __user *suid']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresuid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1914,11 +3280,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 166 long sys_vm86 ['unsigned long', 'unsigned long']
 	case 166: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_vm86_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vm86_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1927,12 +3295,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 168 long sys_poll ['struct pollfd __user *ufds', 'unsigned int nfds', 'int timeout']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_poll_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_poll_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -1942,12 +3313,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 170 long sys_setresgid16 ['old_gid_t rgid', 'old_gid_t egid', 'old_gid_t sgid']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1957,12 +3331,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 171 long sys_getresgid16 ['old_gid_t __user *rgid', 'old_gid_t __user *egid', 'old_gid_t __user *sgid']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresgid16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1972,14 +3349,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 172 long sys_prctl ['int option', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 172: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_prctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1996,13 +3378,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 174 long sys_rt_sigaction ['int', 'const struct sigaction __user *', 'struct sigaction __user *', 'size_t']
 	case 174: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigaction_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2013,13 +3399,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 175 long sys_rt_sigprocmask ['int how', 'sigset_t __user *set', 'sigset_t __user *oset', 'size_t sigsetsize']
 	case 175: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigprocmask_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigprocmask_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2030,11 +3420,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 176 long sys_rt_sigpending ['sigset_t __user *set', 'size_t sigsetsize']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigpending_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigpending_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2043,13 +3435,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 177 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
 	case 177: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigtimedwait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigtimedwait_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2060,12 +3456,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 178 long sys_rt_sigqueueinfo ['int pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 178: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigqueueinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigqueueinfo_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2075,11 +3474,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 179 long sys_rt_sigsuspend ['sigset_t __user *unewset', 'size_t sigsetsize']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_sigsuspend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_sigsuspend_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2088,13 +3489,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 180 long sys_pread64 ['unsigned int fd', 'char __user *buf', 'size_t count', 'loff_t pos']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_pread64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pread64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2105,13 +3510,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 181 long sys_pwrite64 ['unsigned int fd', 'const char __user *buf', 'size_t count', 'loff_t pos']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_pwrite64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwrite64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2122,12 +3531,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 182 long sys_chown16 ['const char __user *filename', 'old_uid_t user', 'old_gid_t group']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_chown16_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown16_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2137,11 +3549,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 183 long sys_getcwd ['char __user *buf', 'unsigned long size']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getcwd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcwd_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2150,11 +3564,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 184 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_capget_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capget_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2163,11 +3579,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 185 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_capset_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_capset_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2176,11 +3594,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 186 long sys_sigaltstack ['const struct sigaltstack __user *uss', 'struct sigaltstack __user *uoss']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_sigaltstack_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sigaltstack_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2189,13 +3609,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 187 long sys_sendfile ['int out_fd', 'int in_fd', 'off_t __user *offset', 'size_t count']
 	case 187: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2211,11 +3635,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 191 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getrlimit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrlimit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2224,15 +3650,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 192 long sys_mmap_pgoff ['unsigned long addr', 'unsigned long len', 'unsigned long prot', 'unsigned long flags', 'unsigned long fd', 'unsigned long pgoff']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_mmap_pgoff_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mmap_pgoff_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2245,11 +3677,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 193 long sys_truncate64 ['const char __user *path', 'loff_t length']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_truncate64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_truncate64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_64(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 		}
@@ -2258,11 +3692,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 194 long sys_ftruncate64 ['unsigned int fd', 'loff_t length']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ftruncate64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ftruncate64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_64(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 		}
@@ -2271,11 +3707,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 195 long sys_stat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_stat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_stat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2284,11 +3722,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 196 long sys_lstat64 ['const char __user *filename', 'struct stat64 __user *statbuf']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_lstat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lstat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2297,11 +3737,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 197 long sys_fstat64 ['unsigned long fd', 'struct stat64 __user *statbuf']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fstat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstat64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2310,12 +3752,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 198 long sys_lchown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 198: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lchown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lchown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2345,11 +3790,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 203 long sys_setreuid ['uid_t ruid', 'uid_t euid']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setreuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setreuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2358,11 +3805,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 204 long sys_setregid ['gid_t rgid', 'gid_t egid']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setregid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setregid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2371,11 +3820,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 205 long sys_getgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 205: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_getgroups_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getgroups_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2384,11 +3835,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 206 long sys_setgroups ['int gidsetsize', 'gid_t __user *grouplist']
 	case 206: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setgroups_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgroups_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2397,12 +3850,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 207 long sys_fchown ['unsigned int fd', 'uid_t user', 'gid_t group']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2412,12 +3868,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 208 long sys_setresuid ['uid_t ruid', 'uid_t euid', 'uid_t suid']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2427,12 +3886,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 209 long sys_getresuid ['uid_t __user *ruid', 'uid_t __user *euid', 'uid_t __user *suid']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresuid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2442,12 +3904,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 210 long sys_setresgid ['gid_t rgid', 'gid_t egid', 'gid_t sgid']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_setresgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setresgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2457,12 +3922,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 211 long sys_getresgid ['gid_t __user *rgid', 'gid_t __user *egid', 'gid_t __user *sgid']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getresgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getresgid_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2472,12 +3940,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 212 long sys_chown ['const char __user *filename', 'uid_t user', 'gid_t group']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_chown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_chown_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2487,10 +3958,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 213 long sys_setuid ['uid_t uid']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setuid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setuid_enter, cpu, pc, arg0);
@@ -2498,10 +3970,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 214 long sys_setgid ['gid_t gid']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setgid_enter, cpu, pc, arg0);
@@ -2509,10 +3982,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 215 long sys_setfsuid ['uid_t uid']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsuid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsuid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsuid_enter, cpu, pc, arg0);
@@ -2520,10 +3994,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 216 long sys_setfsgid ['gid_t gid']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_setfsgid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setfsgid_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_setfsgid_enter, cpu, pc, arg0);
@@ -2531,11 +4006,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 217 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_pivot_root_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pivot_root_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2544,12 +4021,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 218 long sys_mincore ['unsigned long start', 'size_t len', 'unsigned char __user *vec']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mincore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mincore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2559,12 +4039,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 219 long sys_madvise ['unsigned long start', 'size_t len', 'int behavior']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_madvise_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_madvise_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2574,12 +4057,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 220 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getdents64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getdents64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2589,12 +4075,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 221 long sys_fcntl64 ['unsigned int fd', 'unsigned int cmd', 'unsigned long arg']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fcntl64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fcntl64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2609,12 +4098,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 225 long sys_readahead ['int fd', 'loff_t offset', 'size_t count']
 	case 225: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_readahead_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readahead_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_64(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2624,14 +4116,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 226 long sys_setxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 226: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_setxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2643,14 +4140,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 227 long sys_lsetxattr ['const char __user *path', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_lsetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lsetxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2662,14 +4164,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 228 long sys_fsetxattr ['int fd', 'const char __user *name', 'const void __user *value', 'size_t size', 'int flags']
 	case 228: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fsetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fsetxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2681,13 +4188,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 229 long sys_getxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_getxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2698,13 +4209,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 230 long sys_lgetxattr ['const char __user *path', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_lgetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lgetxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2715,13 +4230,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 231 long sys_fgetxattr ['int fd', 'const char __user *name', 'void __user *value', 'size_t size']
 	case 231: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fgetxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fgetxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2732,12 +4251,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 232 long sys_listxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_listxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2747,12 +4269,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 233 long sys_llistxattr ['const char __user *path', 'char __user *list', 'size_t size']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_llistxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_llistxattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2762,12 +4287,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 234 long sys_flistxattr ['int fd', 'char __user *list', 'size_t size']
 	case 234: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_flistxattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_flistxattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2777,11 +4305,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 235 long sys_removexattr ['const char __user *path', 'const char __user *name']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_removexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_removexattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2790,11 +4320,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 236 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_lremovexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lremovexattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2803,11 +4335,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 237 long sys_fremovexattr ['int fd', 'const char __user *name']
 	case 237: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fremovexattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fremovexattr_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2816,11 +4350,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 238 long sys_tkill ['int pid', 'int sig']
 	case 238: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_tkill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tkill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -2829,13 +4365,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 239 long sys_sendfile64 ['int out_fd', 'int in_fd', 'loff_t __user *offset', 'size_t count']
 	case 239: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendfile64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendfile64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2846,15 +4386,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 240 long sys_futex ['u32 __user *uaddr', 'int op', 'u32 val', 'struct timespec __user *utime', 'u32 __user *uaddr2', 'u32 val3']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_futex_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futex_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2867,12 +4413,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 241 long sys_sched_setaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 241: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setaffinity_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setaffinity_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2882,12 +4431,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 242 long sys_sched_getaffinity ['pid_t pid', 'unsigned int len', 'unsigned long __user *user_mask_ptr']
 	case 242: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getaffinity_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getaffinity_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2897,10 +4449,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 243 long sys_set_thread_area ['struct user_desc __user *']
 	case 243: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_set_thread_area_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_thread_area_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_set_thread_area_enter, cpu, pc, arg0);
@@ -2908,10 +4461,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 244 long sys_get_thread_area ['struct user_desc __user *']
 	case 244: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_get_thread_area_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_thread_area_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_get_thread_area_enter, cpu, pc, arg0);
@@ -2919,11 +4473,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 245 long sys_io_setup ['unsigned nr_reqs', 'aio_context_t __user *ctx']
 	case 245: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_io_setup_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_setup_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2932,10 +4488,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 246 long sys_io_destroy ['aio_context_t ctx']
 	case 246: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_io_destroy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_destroy_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_io_destroy_enter, cpu, pc, arg0);
@@ -2943,14 +4500,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 247 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
 	case 247: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_io_getevents_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_getevents_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -2962,12 +4524,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 248 long sys_io_submit ['aio_context_t', 'long', 'struct iocb __user * __user *']
 	case 248: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_io_submit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_submit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2977,12 +4542,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 249 long sys_io_cancel ['aio_context_t ctx_id', 'struct iocb __user *iocb', 'struct io_event __user *result']
 	case 249: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_io_cancel_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_io_cancel_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2992,13 +4560,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 250 long sys_fadvise64 ['int fd', 'loff_t offset', 'size_t len', 'int advice']
 	case 250: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fadvise64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fadvise64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_64(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3009,10 +4581,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 252 long sys_exit_group ['int error_code']
 	case 252: {
 		panda_noreturn = true;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_exit_group_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_exit_group_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_exit_group_enter, cpu, pc, arg0);
@@ -3020,12 +4593,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 253 long sys_lookup_dcookie ['u64 cookie64', 'char __user *buf', 'size_t len']
 	case 253: {
 		panda_noreturn = false;
-		uint64_t arg0 = get_64(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint64_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_lookup_dcookie_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_lookup_dcookie_return)))) {
+			arg0 = get_64(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint64_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3035,10 +4611,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 254 long sys_epoll_create ['int size']
 	case 254: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_epoll_create_enter, cpu, pc, arg0);
@@ -3046,13 +4623,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 255 long sys_epoll_ctl ['int epfd', 'int op', 'int fd', 'struct epoll_event __user *event']
 	case 255: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_ctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_ctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3063,13 +4644,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 256 long sys_epoll_wait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout']
 	case 256: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_wait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_wait_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3080,14 +4665,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 257 long sys_remap_file_pages ['unsigned long start', 'unsigned long size', 'unsigned long prot', 'unsigned long pgoff', 'unsigned long flags']
 	case 257: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_remap_file_pages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_remap_file_pages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3099,10 +4689,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 258 long sys_set_tid_address ['int __user *tidptr']
 	case 258: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_set_tid_address_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_tid_address_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_set_tid_address_enter, cpu, pc, arg0);
@@ -3110,12 +4701,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 259 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user *created_timer_id']
 	case 259: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_create_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3125,13 +4719,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 260 long sys_timer_settime ['timer_t timer_id', 'int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
 	case 260: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_settime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3142,11 +4740,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 261 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
 	case 261: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_gettime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3155,10 +4755,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 262 long sys_timer_getoverrun ['timer_t timer_id']
 	case 262: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_getoverrun_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_getoverrun_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_timer_getoverrun_enter, cpu, pc, arg0);
@@ -3166,10 +4767,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 263 long sys_timer_delete ['timer_t timer_id']
 	case 263: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_timer_delete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timer_delete_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_timer_delete_enter, cpu, pc, arg0);
@@ -3177,11 +4779,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 264 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
 	case 264: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_settime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3190,11 +4794,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 265 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 265: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_gettime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3203,11 +4809,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 266 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
 	case 266: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_getres_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_getres_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3216,13 +4824,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 267 long sys_clock_nanosleep ['clockid_t which_clock', 'int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
 	case 267: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_nanosleep_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_nanosleep_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3233,12 +4845,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 268 long sys_statfs64 ['const char __user *path', 'size_t sz', 'struct statfs64 __user *buf']
 	case 268: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_statfs64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_statfs64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3248,12 +4863,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 269 long sys_fstatfs64 ['unsigned int fd', 'size_t sz', 'struct statfs64 __user *buf']
 	case 269: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatfs64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatfs64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3263,12 +4881,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 270 long sys_tgkill ['int tgid', 'int pid', 'int sig']
 	case 270: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_tgkill_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tgkill_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3278,11 +4899,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 271 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
 	case 271: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_utimes_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimes_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3291,13 +4914,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 272 long sys_fadvise64_64 ['int fd', 'loff_t offset', 'loff_t len', 'int advice']
 	case 272: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		uint64_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fadvise64_64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fadvise64_64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_64(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -3308,15 +4935,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 274 long sys_mbind ['unsigned long start', 'unsigned long len', 'unsigned long mode', 'const unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
 	case 274: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_mbind_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mbind_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3329,14 +4962,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 275 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', 'unsigned long flags']
 	case 275: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_get_mempolicy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_mempolicy_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3348,12 +4986,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 276 long sys_set_mempolicy ['int mode', 'const unsigned long __user *nmask', 'unsigned long maxnode']
 	case 276: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_set_mempolicy_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_mempolicy_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3363,13 +5004,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 277 long sys_mq_open ['const char __user *name', 'int oflag', 'umode_t mode', 'struct mq_attr __user *attr']
 	case 277: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3380,10 +5025,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 278 long sys_mq_unlink ['const char __user *name']
 	case 278: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_unlink_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_unlink_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_mq_unlink_enter, cpu, pc, arg0);
@@ -3391,14 +5037,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 279 long sys_mq_timedsend ['mqd_t mqdes', 'const char __user *msg_ptr', 'size_t msg_len', 'unsigned int msg_prio', 'const struct timespec __user *abs_timeout']
 	case 279: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_timedsend_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedsend_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3410,14 +5061,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 280 long sys_mq_timedreceive ['mqd_t mqdes', 'char __user *msg_ptr', 'size_t msg_len', 'unsigned int __user *msg_prio', 'const struct timespec __user *abs_timeout']
 	case 280: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_timedreceive_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_timedreceive_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3429,11 +5085,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 281 long sys_mq_notify ['mqd_t mqdes', 'const struct sigevent __user *notification']
 	case 281: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_notify_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_notify_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3442,12 +5100,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 282 long sys_mq_getsetattr ['mqd_t mqdes', 'const struct mq_attr __user *mqstat', 'struct mq_attr __user *omqstat']
 	case 282: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mq_getsetattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mq_getsetattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3457,13 +5118,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 283 long sys_kexec_load ['unsigned long entry', 'unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
 	case 283: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_kexec_load_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kexec_load_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3474,14 +5139,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 284 long sys_waitid ['int which', 'pid_t pid', 'struct siginfo __user *infop', 'int options', 'struct rusage __user *ru']
 	case 284: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_waitid_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_waitid_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3493,14 +5163,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 286 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
 	case 286: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_add_key_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_add_key_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3512,13 +5187,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 287 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
 	case 287: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_request_key_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_request_key_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3529,14 +5208,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 288 long sys_keyctl ['int cmd', 'unsigned long arg2', 'unsigned long arg3', 'unsigned long arg4', 'unsigned long arg5']
 	case 288: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_keyctl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_keyctl_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3548,12 +5232,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 289 long sys_ioprio_set ['int which', 'int who', 'int ioprio']
 	case 289: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_ioprio_set_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_set_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3563,11 +5250,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 290 long sys_ioprio_get ['int which', 'int who']
 	case 290: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_ioprio_get_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ioprio_get_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3581,12 +5270,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 292 long sys_inotify_add_watch ['int fd', 'const char __user *path', 'u32 mask']
 	case 292: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_add_watch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_add_watch_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3596,11 +5288,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 293 long sys_inotify_rm_watch ['int fd', '__s32 wd']
 	case 293: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_rm_watch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_rm_watch_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -3609,13 +5303,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 294 long sys_migrate_pages ['pid_t pid', 'unsigned long maxnode', 'const unsigned long __user *from', 'const unsigned long __user *to']
 	case 294: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_migrate_pages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_migrate_pages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3626,13 +5324,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 295 long sys_openat ['int dfd', 'const char __user *filename', 'int flags', 'umode_t mode']
 	case 295: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_openat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_openat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3643,12 +5345,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 296 long sys_mkdirat ['int dfd', 'const char __user *pathname', 'umode_t mode']
 	case 296: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mkdirat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mkdirat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3658,13 +5363,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 297 long sys_mknodat ['int dfd', 'const char __user *filename', 'umode_t mode', 'unsigned dev']
 	case 297: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_mknodat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mknodat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3675,14 +5384,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 298 long sys_fchownat ['int dfd', 'const char __user *filename', 'uid_t user', 'gid_t group', 'int flag']
 	case 298: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fchownat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchownat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3694,12 +5408,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 299 long sys_futimesat ['int dfd', 'const char __user *filename', 'struct timeval __user *utimes']
 	case 299: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_futimesat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_futimesat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3709,13 +5426,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 300 long sys_fstatat64 ['int dfd', 'const char __user *filename', 'struct stat64 __user *statbuf', 'int flag']
 	case 300: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fstatat64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fstatat64_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3726,12 +5447,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 301 long sys_unlinkat ['int dfd', 'const char __user *pathname', 'int flag']
 	case 301: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_unlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unlinkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3741,13 +5465,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 302 long sys_renameat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 302: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_renameat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3758,14 +5486,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 303 long sys_linkat ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'int flags']
 	case 303: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_linkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_linkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3777,12 +5510,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 304 long sys_symlinkat ['const char __user *oldname', 'int newdfd', 'const char __user *newname']
 	case 304: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_symlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_symlinkat_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3792,13 +5528,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 305 long sys_readlinkat ['int dfd', 'const char __user *path', 'char __user *buf', 'int bufsiz']
 	case 305: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_readlinkat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_readlinkat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3809,12 +5549,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 306 long sys_fchmodat ['int dfd', 'const char __user *filename', 'umode_t mode']
 	case 306: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_fchmodat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fchmodat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3824,12 +5567,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 307 long sys_faccessat ['int dfd', 'const char __user *filename', 'int mode']
 	case 307: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_faccessat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_faccessat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3839,15 +5585,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 308 long sys_pselect6 ['int', 'fd_set __user *', 'fd_set __user *', 'fd_set __user *', 'struct timespec __user *', 'void __user *']
 	case 308: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_pselect6_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pselect6_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3860,14 +5612,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 309 long sys_ppoll ['struct pollfd __user *', 'unsigned int', 'struct timespec __user *', 'const sigset_t __user *', 'size_t']
 	case 309: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_ppoll_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_ppoll_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3879,10 +5636,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 310 long sys_unshare ['unsigned long unshare_flags']
 	case 310: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_unshare_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_unshare_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_unshare_enter, cpu, pc, arg0);
@@ -3890,11 +5648,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 311 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
 	case 311: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_set_robust_list_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_set_robust_list_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3903,12 +5663,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 312 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
 	case 312: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_get_robust_list_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_get_robust_list_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3918,15 +5681,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 313 long sys_splice ['int fd_in', 'loff_t __user *off_in', 'int fd_out', 'loff_t __user *off_out', 'size_t len', 'unsigned int flags']
 	case 313: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_splice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_splice_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -3939,13 +5708,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 314 long sys_sync_file_range ['int fd', 'loff_t offset', 'loff_t nbytes', 'unsigned int flags']
 	case 314: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint64_t arg1 = get_64(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint64_t arg1 = 0;
+		uint64_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sync_file_range_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sync_file_range_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_64(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint64_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -3956,13 +5729,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 315 long sys_tee ['int fdin', 'int fdout', 'size_t len', 'unsigned int flags']
 	case 315: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_tee_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_tee_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3973,13 +5750,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 316 long sys_vmsplice ['int fd', 'const struct iovec __user *iov', 'unsigned long nr_segs', 'unsigned int flags']
 	case 316: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_vmsplice_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_vmsplice_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3990,15 +5771,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 317 long sys_move_pages ['pid_t pid', 'unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
 	case 317: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_move_pages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_move_pages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4011,12 +5798,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 318 long sys_getcpu ['unsigned __user *cpu', 'unsigned __user *node', 'struct getcpu_cache __user *cache']
 	case 318: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getcpu_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getcpu_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4026,15 +5816,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 319 long sys_epoll_pwait ['int epfd', 'struct epoll_event __user *events', 'int maxevents', 'int timeout', 'const sigset_t __user *sigmask', 'size_t sigsetsize']
 	case 319: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_pwait_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_pwait_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4047,13 +5843,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 320 long sys_utimensat ['int dfd', 'const char __user *filename', 'struct timespec __user *utimes', 'int flags']
 	case 320: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_utimensat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_utimensat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4064,12 +5864,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 321 long sys_signalfd ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask']
 	case 321: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_signalfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4079,11 +5882,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 322 long sys_timerfd_create ['int clockid', 'int flags']
 	case 322: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_create_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4092,10 +5897,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 323 long sys_eventfd ['unsigned int count']
 	case 323: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_eventfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_sys_eventfd_enter, cpu, pc, arg0);
@@ -4103,13 +5909,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 324 long sys_fallocate ['int fd', 'int mode', 'loff_t offset', 'loff_t len']
 	case 324: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		uint64_t arg3 = get_64(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		uint64_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_fallocate_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fallocate_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_64(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -4120,13 +5930,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 325 long sys_timerfd_settime ['int ufd', 'int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
 	case 325: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_settime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_settime_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4137,11 +5951,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 326 long sys_timerfd_gettime ['int ufd', 'struct itimerspec __user *otmr']
 	case 326: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_timerfd_gettime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_timerfd_gettime_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4150,13 +5966,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 327 long sys_signalfd4 ['int ufd', 'sigset_t __user *user_mask', 'size_t sizemask', 'int flags']
 	case 327: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_signalfd4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_signalfd4_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4167,11 +5987,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 328 long sys_eventfd2 ['unsigned int count', 'int flags']
 	case 328: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_eventfd2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_eventfd2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4180,10 +6002,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 329 long sys_epoll_create1 ['int flags']
 	case 329: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_epoll_create1_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_epoll_create1_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_epoll_create1_enter, cpu, pc, arg0);
@@ -4191,12 +6014,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 330 long sys_dup3 ['unsigned int oldfd', 'unsigned int newfd', 'int flags']
 	case 330: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_dup3_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_dup3_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4206,11 +6032,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 331 long sys_pipe2 ['int __user *fildes', 'int flags']
 	case 331: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_pipe2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pipe2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4219,10 +6047,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 332 long sys_inotify_init1 ['int flags']
 	case 332: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_inotify_init1_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_inotify_init1_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_inotify_init1_enter, cpu, pc, arg0);
@@ -4230,14 +6059,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 333 long sys_preadv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 333: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_preadv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_preadv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4249,14 +6083,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 334 long sys_pwritev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen', 'unsigned long pos_l', 'unsigned long pos_h']
 	case 334: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_pwritev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_pwritev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4268,13 +6107,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 335 long sys_rt_tgsigqueueinfo ['pid_t tgid', 'pid_t pid', 'int sig', 'siginfo_t __user *uinfo']
 	case 335: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_rt_tgsigqueueinfo_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4285,14 +6128,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 336 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', 'pid_t pid', 'int cpu', 'int group_fd', 'unsigned long flags']
 	case 336: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_perf_event_open_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_perf_event_open_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4304,14 +6152,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 337 long sys_recvmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags', 'struct timespec __user *timeout']
 	case 337: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_recvmmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4323,11 +6176,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 338 long sys_fanotify_init ['unsigned int flags', 'unsigned int event_f_flags']
 	case 338: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_fanotify_init_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_init_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4336,14 +6191,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 339 long sys_fanotify_mark ['int fanotify_fd', 'unsigned int flags', 'u64 mask', 'int fd', 'const char __user *pathname']
 	case 339: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint64_t arg2 = get_64(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint64_t arg2 = 0;
+		int32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_fanotify_mark_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_fanotify_mark_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_64(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint64_t));
@@ -4355,13 +6215,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 340 long sys_prlimit64 ['pid_t pid', 'unsigned int resource', 'const struct rlimit64 __user *new_rlim', 'struct rlimit64 __user *old_rlim']
 	case 340: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_prlimit64_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_prlimit64_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4372,14 +6236,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 341 long sys_name_to_handle_at ['int dfd', 'const char __user *name', 'struct file_handle __user *handle', 'int __user *mnt_id', 'int flag']
 	case 341: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_name_to_handle_at_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_name_to_handle_at_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4391,12 +6260,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 342 long sys_open_by_handle_at ['int mountdirfd', 'struct file_handle __user *handle', 'int flags']
 	case 342: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_open_by_handle_at_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_open_by_handle_at_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4406,11 +6278,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 343 long sys_clock_adjtime ['clockid_t which_clock', 'struct timex __user *tx']
 	case 343: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_clock_adjtime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_clock_adjtime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4419,10 +6293,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 344 long sys_syncfs ['int fd']
 	case 344: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_syncfs_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_syncfs_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_syncfs_enter, cpu, pc, arg0);
@@ -4430,13 +6305,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 345 long sys_sendmmsg ['int fd', 'struct mmsghdr __user *msg', 'unsigned int vlen', 'unsigned flags']
 	case 345: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sendmmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4447,11 +6326,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 346 long sys_setns ['int fd', 'int nstype']
 	case 346: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_setns_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setns_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4460,15 +6341,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 347 long sys_process_vm_readv ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 347: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_process_vm_readv_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_readv_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4481,15 +6368,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 348 long sys_process_vm_writev ['pid_t pid', 'const struct iovec __user *lvec', 'unsigned long liovcnt', 'const struct iovec __user *rvec', 'unsigned long riovcnt', 'unsigned long flags']
 	case 348: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_process_vm_writev_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_process_vm_writev_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4502,14 +6395,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 349 long sys_kcmp ['pid_t pid1', 'pid_t pid2', 'int type', 'unsigned long idx1', 'unsigned long idx2']
 	case 349: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_kcmp_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_kcmp_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4521,12 +6419,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 350 long sys_finit_module ['int fd', 'const char __user *uargs', 'int flags']
 	case 350: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_finit_module_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_finit_module_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4536,12 +6437,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 351 long sys_sched_setattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int flags']
 	case 351: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_setattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_setattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4551,13 +6455,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 352 long sys_sched_getattr ['pid_t pid', 'struct sched_attr __user *attr', 'unsigned int size', 'unsigned int flags']
 	case 352: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_sched_getattr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sched_getattr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4568,14 +6476,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 353 long sys_renameat2 ['int olddfd', 'const char __user *oldname', 'int newdfd', 'const char __user *newname', 'unsigned int flags']
 	case 353: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_renameat2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_renameat2_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4587,12 +6500,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 354 long sys_seccomp ['unsigned int op', 'unsigned int flags', 'const char __user *uargs']
 	case 354: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_seccomp_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_seccomp_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4602,12 +6518,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 355 long sys_getrandom ['char __user *buf', 'size_t count', 'unsigned int flags']
 	case 355: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getrandom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getrandom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4617,11 +6536,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 356 long sys_memfd_create ['const char __user *uname_ptr', 'unsigned int flags']
 	case 356: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_memfd_create_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_memfd_create_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4630,12 +6551,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 357 long sys_bpf ['int cmd', 'union bpf_attr *attr', 'unsigned int size']
 	case 357: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_bpf_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bpf_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4645,14 +6569,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 358 long sys_execveat ['int dfd', 'const char __user *filename', 'const char __user *const __user *argv', 'const char __user *const __user *envp', 'int flags']
 	case 358: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_execveat_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_execveat_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4664,12 +6593,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 359 long sys_socket ['int', 'int', 'int']
 	case 359: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_socket_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socket_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4679,13 +6611,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 360 long sys_socketpair ['int', 'int', 'int', 'int __user *']
 	case 360: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_socketpair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_socketpair_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4696,12 +6632,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 361 long sys_bind ['int', 'struct sockaddr __user *', 'int']
 	case 361: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_bind_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_bind_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4711,12 +6650,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 362 long sys_connect ['int', 'struct sockaddr __user *', 'int']
 	case 362: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_connect_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_connect_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4726,11 +6668,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 363 long sys_listen ['int', 'int']
 	case 363: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_listen_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_listen_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4739,13 +6683,17 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 364 long sys_accept4 ['int', 'struct sockaddr __user *', 'int __user *', 'int']
 	case 364: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_sys_accept4_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_accept4_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4756,14 +6704,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 365 long sys_getsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int __user *optlen']
 	case 365: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_getsockopt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockopt_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4775,14 +6728,19 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 366 long sys_setsockopt ['int fd', 'int level', 'int optname', 'char __user *optval', 'int optlen']
 	case 366: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		int32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_sys_setsockopt_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_setsockopt_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4794,12 +6752,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 367 long sys_getsockname ['int', 'struct sockaddr __user *', 'int __user *']
 	case 367: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getsockname_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getsockname_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4809,12 +6770,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 368 long sys_getpeername ['int', 'struct sockaddr __user *', 'int __user *']
 	case 368: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_getpeername_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_getpeername_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4824,15 +6788,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 369 long sys_sendto ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int']
 	case 369: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_sendto_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendto_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4845,12 +6815,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 370 long sys_sendmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 370: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_sendmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_sendmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4860,15 +6833,21 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 371 long sys_recvfrom ['int', 'void __user *', 'size_t', 'unsigned', 'struct sockaddr __user *', 'int __user *']
 	case 371: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_sys_recvfrom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvfrom_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4881,12 +6860,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 372 long sys_recvmsg ['int fd', 'struct user_msghdr __user *msg', 'unsigned flags']
 	case 372: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_recvmsg_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_recvmsg_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4896,11 +6878,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 373 long sys_shutdown ['int', 'int']
 	case 373: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_shutdown_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_shutdown_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4909,10 +6893,11 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 374 long sys_userfaultfd ['int flags']
 	case 374: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_sys_userfaultfd_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_userfaultfd_return)))) {
+			arg0 = get_s32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 		}
 		PPP_RUN_CB(on_sys_userfaultfd_enter, cpu, pc, arg0);
@@ -4920,11 +6905,13 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 375 long sys_membarrier ['int cmd', 'int flags']
 	case 375: {
 		panda_noreturn = false;
-		int32_t arg0 = get_s32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		int32_t arg0 = 0;
+		int32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_sys_membarrier_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_membarrier_return)))) {
+			arg0 = get_s32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(int32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 		}
@@ -4933,12 +6920,15 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 	// 376 long sys_mlock2 ['unsigned long start', 'size_t len', 'int flags']
 	case 376: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		int32_t arg2 = get_s32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		int32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_sys_mlock2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_sys_mlock2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_s32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(int32_t));
@@ -4952,7 +6942,7 @@ void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
@@ -13,21 +13,754 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_windows_2000_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef TARGET_I386
+	subs.assign(247 + 1, unknown);
+	subs[0] = all |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[1] = all |
+		(PPP_CHECK_CB(on_NtAccessCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[2] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[3] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[4] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[5] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[6] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[7] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[8] = all |
+		(PPP_CHECK_CB(on_NtAddAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[9] = all |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[10] = all |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[11] = all |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[12] = all |
+		(PPP_CHECK_CB(on_NtAlertThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[13] = all |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[14] = all |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[15] = all |
+		(PPP_CHECK_CB(on_NtAllocateUuids_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUuids_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[16] = all |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[17] = all |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[18] = all |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[19] = all |
+		(PPP_CHECK_CB(on_NtCallbackReturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCallbackReturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[20] = all |
+		(PPP_CHECK_CB(on_NtCancelIoFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelIoFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[21] = all |
+		(PPP_CHECK_CB(on_NtCancelTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[23] = all |
+		(PPP_CHECK_CB(on_NtClearEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClearEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[24] = all |
+		(PPP_CHECK_CB(on_NtClose_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClose_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[25] = all |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[26] = all |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[27] = all |
+		(PPP_CHECK_CB(on_NtConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[28] = all |
+		(PPP_CHECK_CB(on_NtContinue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtContinue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[29] = all |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[30] = all |
+		(PPP_CHECK_CB(on_NtCreateEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[31] = all |
+		(PPP_CHECK_CB(on_NtCreateEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[32] = all |
+		(PPP_CHECK_CB(on_NtCreateFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[33] = all |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[34] = all |
+		(PPP_CHECK_CB(on_NtCreateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[35] = all |
+		(PPP_CHECK_CB(on_NtCreateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[36] = all |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[37] = all |
+		(PPP_CHECK_CB(on_NtCreateMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[38] = all |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[39] = all |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[40] = all |
+		(PPP_CHECK_CB(on_NtCreatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[41] = all |
+		(PPP_CHECK_CB(on_NtCreateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[42] = all |
+		(PPP_CHECK_CB(on_NtCreateProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[43] = all |
+		(PPP_CHECK_CB(on_NtCreateSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[44] = all |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[45] = all |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[46] = all |
+		(PPP_CHECK_CB(on_NtCreateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[47] = all |
+		(PPP_CHECK_CB(on_NtCreateTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[48] = all |
+		(PPP_CHECK_CB(on_NtCreateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[49] = all |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[50] = all |
+		(PPP_CHECK_CB(on_NtDelayExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDelayExecution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[51] = all |
+		(PPP_CHECK_CB(on_NtDeleteAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[52] = all |
+		(PPP_CHECK_CB(on_NtDeleteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[53] = all |
+		(PPP_CHECK_CB(on_NtDeleteKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[54] = all |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[55] = all |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[56] = all |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[57] = all |
+		(PPP_CHECK_CB(on_NtDisplayString_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDisplayString_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[58] = all |
+		(PPP_CHECK_CB(on_NtDuplicateObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[59] = all |
+		(PPP_CHECK_CB(on_NtDuplicateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[60] = all |
+		(PPP_CHECK_CB(on_NtEnumerateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[61] = all |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[62] = all |
+		(PPP_CHECK_CB(on_NtExtendSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtExtendSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[63] = all |
+		(PPP_CHECK_CB(on_NtFilterToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFilterToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[64] = all |
+		(PPP_CHECK_CB(on_NtFindAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFindAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[65] = all |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[66] = all |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[67] = all |
+		(PPP_CHECK_CB(on_NtFlushKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[68] = all |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[69] = all |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[70] = all |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[71] = all |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[72] = all |
+		(PPP_CHECK_CB(on_NtFsControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFsControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[73] = all |
+		(PPP_CHECK_CB(on_NtGetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[74] = all |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[75] = all |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[77] = all |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[78] = all |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[79] = all |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[80] = all |
+		(PPP_CHECK_CB(on_NtImpersonateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[81] = all |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[82] = all |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[83] = all |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[84] = all |
+		(PPP_CHECK_CB(on_NtListenPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtListenPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[85] = all |
+		(PPP_CHECK_CB(on_NtLoadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[86] = all |
+		(PPP_CHECK_CB(on_NtLoadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[87] = all |
+		(PPP_CHECK_CB(on_NtLoadKey2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[88] = all |
+		(PPP_CHECK_CB(on_NtLockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[89] = all |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[90] = all |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[91] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[92] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[93] = all |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[94] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[95] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[96] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[97] = all |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[98] = all |
+		(PPP_CHECK_CB(on_NtOpenEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[99] = all |
+		(PPP_CHECK_CB(on_NtOpenEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[100] = all |
+		(PPP_CHECK_CB(on_NtOpenFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[101] = all |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[102] = all |
+		(PPP_CHECK_CB(on_NtOpenJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[103] = all |
+		(PPP_CHECK_CB(on_NtOpenKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[104] = all |
+		(PPP_CHECK_CB(on_NtOpenMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[105] = all |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[106] = all |
+		(PPP_CHECK_CB(on_NtOpenProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[107] = all |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[108] = all |
+		(PPP_CHECK_CB(on_NtOpenSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[109] = all |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[110] = all |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[111] = all |
+		(PPP_CHECK_CB(on_NtOpenThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[112] = all |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[113] = all |
+		(PPP_CHECK_CB(on_NtOpenTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[114] = all |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[115] = all |
+		(PPP_CHECK_CB(on_NtPowerInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPowerInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[116] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[117] = all |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[118] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[119] = all |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[120] = all |
+		(PPP_CHECK_CB(on_NtPulseEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPulseEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[121] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[122] = all |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[123] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[124] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[125] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[126] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[127] = all |
+		(PPP_CHECK_CB(on_NtQueryEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[128] = all |
+		(PPP_CHECK_CB(on_NtQueryEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[129] = all |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[130] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[131] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[132] = all |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[133] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[134] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[135] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[136] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[137] = all |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[138] = all |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[139] = all |
+		(PPP_CHECK_CB(on_NtQueryKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[140] = all |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[141] = all |
+		(PPP_CHECK_CB(on_NtQueryMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[142] = all |
+		(PPP_CHECK_CB(on_NtQueryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[143] = all |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[144] = all |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[145] = all |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[146] = all |
+		(PPP_CHECK_CB(on_NtQuerySection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[147] = all |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[148] = all |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[149] = all |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[150] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[151] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[152] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[153] = all |
+		(PPP_CHECK_CB(on_NtQueryTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[154] = all |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[155] = all |
+		(PPP_CHECK_CB(on_NtQueryValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[156] = all |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[157] = all |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[158] = all |
+		(PPP_CHECK_CB(on_NtQueueApcThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueueApcThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[159] = all |
+		(PPP_CHECK_CB(on_NtRaiseException_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseException_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[160] = all |
+		(PPP_CHECK_CB(on_NtRaiseHardError_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseHardError_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[161] = all |
+		(PPP_CHECK_CB(on_NtReadFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[162] = all |
+		(PPP_CHECK_CB(on_NtReadFileScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFileScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[163] = all |
+		(PPP_CHECK_CB(on_NtReadRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[164] = all |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[165] = all |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[166] = all |
+		(PPP_CHECK_CB(on_NtReleaseMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[167] = all |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[168] = all |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[169] = all |
+		(PPP_CHECK_CB(on_NtReplaceKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplaceKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[170] = all |
+		(PPP_CHECK_CB(on_NtReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[171] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[172] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[173] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[175] = all |
+		(PPP_CHECK_CB(on_NtRequestPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[176] = all |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[178] = all |
+		(PPP_CHECK_CB(on_NtResetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[179] = all |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[180] = all |
+		(PPP_CHECK_CB(on_NtRestoreKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRestoreKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[181] = all |
+		(PPP_CHECK_CB(on_NtResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[182] = all |
+		(PPP_CHECK_CB(on_NtSaveKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[183] = all |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[184] = all |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[185] = all |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[186] = all |
+		(PPP_CHECK_CB(on_NtSetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[187] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[188] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[189] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[190] = all |
+		(PPP_CHECK_CB(on_NtSetEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[191] = all |
+		(PPP_CHECK_CB(on_NtSetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[192] = all |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[193] = all |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[194] = all |
+		(PPP_CHECK_CB(on_NtSetInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[195] = all |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[196] = all |
+		(PPP_CHECK_CB(on_NtSetInformationKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[197] = all |
+		(PPP_CHECK_CB(on_NtSetInformationObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[198] = all |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[199] = all |
+		(PPP_CHECK_CB(on_NtSetInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[200] = all |
+		(PPP_CHECK_CB(on_NtSetInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[201] = all |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[202] = all |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[203] = all |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[204] = all |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[205] = all |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[206] = all |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[207] = all |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[208] = all |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[209] = all |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[210] = all |
+		(PPP_CHECK_CB(on_NtSetSystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[211] = all |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[212] = all |
+		(PPP_CHECK_CB(on_NtSetTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[213] = all |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[214] = all |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[215] = all |
+		(PPP_CHECK_CB(on_NtSetValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[216] = all |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[217] = all |
+		(PPP_CHECK_CB(on_NtShutdownSystem_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtShutdownSystem_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[218] = all |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[219] = all |
+		(PPP_CHECK_CB(on_NtStartProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStartProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[220] = all |
+		(PPP_CHECK_CB(on_NtStopProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStopProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[221] = all |
+		(PPP_CHECK_CB(on_NtSuspendThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSuspendThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[222] = all |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[223] = all |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[224] = all |
+		(PPP_CHECK_CB(on_NtTerminateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[225] = all |
+		(PPP_CHECK_CB(on_NtTerminateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[226] = all |
+		(PPP_CHECK_CB(on_NtTestAlert_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTestAlert_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[227] = all |
+		(PPP_CHECK_CB(on_NtUnloadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[228] = all |
+		(PPP_CHECK_CB(on_NtUnloadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[229] = all |
+		(PPP_CHECK_CB(on_NtUnlockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[230] = all |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[231] = all |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[232] = all |
+		(PPP_CHECK_CB(on_NtVdmControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtVdmControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[233] = all |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[234] = all |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[235] = all |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[236] = all |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[237] = all |
+		(PPP_CHECK_CB(on_NtWriteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[238] = all |
+		(PPP_CHECK_CB(on_NtWriteFileGather_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFileGather_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[239] = all |
+		(PPP_CHECK_CB(on_NtWriteRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[240] = all |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[247] = all |
+		(PPP_CHECK_CB(on_NtYieldExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtYieldExecution_return) ? SYSCALL_SUB_RETURN : 0);
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 #ifdef TARGET_I386
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[R_EAX];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -35,15 +768,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', 'PVOID PortContext', 'PPORT_MESSAGE ConnectionRequest', 'BOOLEAN AcceptConnection', 'PPORT_VIEW ServerView', 'PREMOTE_PORT_VIEW ClientView']
 	case 0: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -56,17 +795,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 1: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -81,20 +828,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 2: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -112,20 +870,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -143,25 +912,41 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -184,20 +969,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -215,25 +1011,41 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -256,26 +1068,43 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 7: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		uint32_t arg16 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
+			arg16 = get_32(cpu, 16);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -299,12 +1128,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 8 NTSTATUS NtAddAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -314,15 +1146,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 9 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', 'BOOLEAN ResetToDefault', 'PTOKEN_GROUPS NewState', 'ULONG BufferLength', 'PTOKEN_GROUPS PreviousState', 'PULONG ReturnLength']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -335,15 +1173,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 10 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', 'BOOLEAN DisableAllPrivileges', 'PTOKEN_PRIVILEGES NewState', 'ULONG BufferLength', 'PTOKEN_PRIVILEGES PreviousState', 'PULONG ReturnLength']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -356,11 +1200,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 11 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 11: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -369,10 +1215,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 12 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertThread_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -380,10 +1227,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 13 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -391,12 +1239,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 14 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -406,13 +1257,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 15 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', 'PULONG Range', 'PULONG Sequence', 'PCHAR Seed']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -423,15 +1278,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 16 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'PSIZE_T RegionSize', 'ULONG AllocationType', 'ULONG Protect']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -444,11 +1305,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 17 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', 'PVOID File2MappedAsFile']
 	case 17: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -457,11 +1320,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 18 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', 'HANDLE ProcessHandle']
 	case 18: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -470,12 +1335,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 19 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', 'ULONG OutputLength', 'NTSTATUS Status']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -485,11 +1353,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 20 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 20: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -498,11 +1368,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 21 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', 'PBOOLEAN CurrentState']
 	case 21: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -511,10 +1383,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 23 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClearEvent_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -522,10 +1395,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 24 NTSTATUS NtClose ['HANDLE Handle']
 	case 24: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClose_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -533,12 +1407,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 25 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -548,10 +1425,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 26 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 	case 26: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -559,17 +1437,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 27 NTSTATUS NtConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -584,11 +1470,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 28 NTSTATUS NtContinue ['PCONTEXT ContextRecord', 'BOOLEAN TestAlert']
 	case 28: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtContinue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -597,12 +1485,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 29 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 29: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -612,14 +1503,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 30 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'EVENT_TYPE EventType', 'BOOLEAN InitialState']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -631,12 +1527,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 31 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 31: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -646,20 +1545,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 32 NTSTATUS NtCreateFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER AllocationSize', 'ULONG FileAttributes', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'PVOID EaBuffer', 'ULONG EaLength']
 	case 32: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -677,13 +1587,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 33 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Count']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -694,12 +1608,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 34 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 34: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -709,16 +1626,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 35 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG TitleIndex', 'PUNICODE_STRING Class', 'ULONG CreateOptions', 'PULONG Disposition']
 	case 35: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -732,17 +1656,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 36 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CreateOptions', 'ULONG MailslotQuota', 'ULONG MaximumMessageSize', 'PLARGE_INTEGER ReadTimeout']
 	case 36: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -757,13 +1689,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 37 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN InitialOwner']
 	case 37: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -774,23 +1710,37 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 38 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'ULONG NamedPipeType', 'ULONG ReadMode', 'ULONG CompletionMode', 'ULONG MaximumInstances', 'ULONG InboundQuota', 'ULONG OutboundQuota', 'PLARGE_INTEGER DefaultTimeout']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -811,13 +1761,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 39 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', 'PLARGE_INTEGER MinimumSize', 'PLARGE_INTEGER MaximumSize', 'ULONG Priority']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -828,14 +1782,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 40 NTSTATUS NtCreatePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -847,17 +1806,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 41 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'BOOLEAN InheritObjectTable', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -872,18 +1839,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 42 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', 'HANDLE Process', 'PVOID RangeBase', 'SIZE_T RangeSize', 'ULONG BucketSize', 'PULONG Buffer', 'ULONG BufferSize', 'KPROFILE_SOURCE ProfileSource', 'KAFFINITY Affinity']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -899,16 +1875,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 43 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PLARGE_INTEGER MaximumSize', 'ULONG SectionPageProtection', 'ULONG AllocationAttributes', 'HANDLE FileHandle']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -922,14 +1905,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 44 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LONG InitialCount', 'LONG MaximumCount']
 	case 44: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -941,13 +1929,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 45 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LinkTarget']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -958,17 +1950,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 46 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ProcessHandle', 'PCLIENT_ID ClientId', 'PCONTEXT ThreadContext', 'PINITIAL_TEB InitialTeb', 'BOOLEAN CreateSuspended']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -983,13 +1983,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 47 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TIMER_TYPE TimerType']
 	case 47: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1000,22 +2004,35 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 48 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TOKEN_TYPE TokenType', 'PLUID AuthenticationId', 'PLARGE_INTEGER ExpirationTime', 'PTOKEN_USER User', 'PTOKEN_GROUPS Groups', 'PTOKEN_PRIVILEGES Privileges', 'PTOKEN_OWNER Owner', 'PTOKEN_PRIMARY_GROUP PrimaryGroup', 'PTOKEN_DEFAULT_DACL DefaultDacl', 'PTOKEN_SOURCE TokenSource']
 	case 48: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1035,14 +2052,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 49 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 49: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1054,11 +2076,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 50 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', 'PLARGE_INTEGER DelayInterval']
 	case 50: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1067,10 +2091,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 51 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1078,10 +2103,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 52 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -1089,10 +2115,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 53 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 	case 53: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -1100,12 +2127,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 54 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1115,11 +2145,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 55 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1128,19 +2160,29 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 56 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 56: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1157,10 +2199,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 57 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDisplayString_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1168,16 +2211,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 58 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', 'HANDLE SourceHandle', 'HANDLE TargetProcessHandle', 'PHANDLE TargetHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Options']
 	case 58: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1191,15 +2241,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 59 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN EffectiveOnly', 'TOKEN_TYPE TokenType', 'PHANDLE NewTokenHandle']
 	case 59: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1212,15 +2268,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 60 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 60: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1233,15 +2295,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 61 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1254,11 +2322,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 62 NTSTATUS NtExtendSection ['HANDLE SectionHandle', 'PLARGE_INTEGER NewSectionSize']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtExtendSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1267,15 +2337,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 63 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', 'ULONG Flags', 'PTOKEN_GROUPS SidsToDisable', 'PTOKEN_PRIVILEGES PrivilegesToDelete', 'PTOKEN_GROUPS RestrictedSids', 'PHANDLE NewTokenHandle']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFilterToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1288,12 +2364,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 64 NTSTATUS NtFindAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 64: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFindAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1303,11 +2382,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 65 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 65: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1316,12 +2397,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 66 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T Length']
 	case 66: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1331,10 +2415,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 67 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 	case 67: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -1342,13 +2427,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 68 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'PIO_STATUS_BLOCK IoStatus']
 	case 68: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1364,12 +2453,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 70 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1379,13 +2471,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 71 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG FreeType']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1396,19 +2492,29 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 72 NTSTATUS NtFsControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 72: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1425,11 +2531,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 73 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1438,11 +2546,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 74 NTSTATUS NtGetDevicePowerState ['HANDLE Device', 'DEVICE_POWER_STATE *State']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1451,13 +2561,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 75 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', 'PVOID Context', 'PPLUGPLAY_EVENT_BLOCK EventBlock', 'ULONG EventBufferSize']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1468,16 +2582,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 77 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', 'ULONG Flags', 'PVOID BaseAddress', 'SIZE_T RegionSize', 'PVOID *UserAddressArray', 'PULONG_PTR EntriesInUserAddressArray', 'PULONG Granularity']
 	case 77: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1491,10 +2612,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 78 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -1502,11 +2624,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 79 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', 'PPORT_MESSAGE Message']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1515,12 +2639,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 80 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', 'HANDLE ClientThreadHandle', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 	case 80: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1530,10 +2657,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 81 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 	case 81: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -1541,13 +2669,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 82 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags', 'BOOLEAN Asynchronous']
 	case 82: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1563,11 +2695,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 84 NTSTATUS NtListenPort ['HANDLE PortHandle', 'PPORT_MESSAGE ConnectionRequest']
 	case 84: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtListenPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1576,10 +2710,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 85 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -1587,11 +2722,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 86 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1600,12 +2737,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 87 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile', 'ULONG Flags']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1615,19 +2755,29 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 88 NTSTATUS NtLockFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key', 'BOOLEAN FailImmediately', 'BOOLEAN ExclusiveLock']
 	case 88: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1644,13 +2794,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 89 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 89: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1661,10 +2815,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 90 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 	case 90: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -1672,12 +2827,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 91 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1687,12 +2845,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 92 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1702,19 +2863,29 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 93 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', 'HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'SIZE_T CommitSize', 'PLARGE_INTEGER SectionOffset', 'PSIZE_T ViewSize', 'SECTION_INHERIT InheritDisposition', 'ULONG AllocationType', 'WIN32_PROTECTION_MASK Win32Protect']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1731,18 +2902,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 94 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'ULONG CompletionFilter', 'BOOLEAN WatchTree']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1758,19 +2938,29 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 95 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 95: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1787,21 +2977,33 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 96 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', 'ULONG Count', 'OBJECT_ATTRIBUTES SlaveObjects[]', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 96: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1820,12 +3022,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 97 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 97: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1835,12 +3040,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 98 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 98: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1850,12 +3058,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 99 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1865,15 +3076,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 100 NTSTATUS NtOpenFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG OpenOptions']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1886,12 +3103,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 101 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 101: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1901,12 +3121,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 102 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 102: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1916,12 +3139,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 103 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 103: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1931,12 +3157,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 104 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 104: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1946,21 +3175,33 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 105 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'ACCESS_MASK GrantedAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN ObjectCreation', 'BOOLEAN AccessGranted', 'PBOOLEAN GenerateOnClose']
 	case 105: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1979,13 +3220,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 106 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1996,12 +3241,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 107 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'PHANDLE TokenHandle']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2011,12 +3259,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 108 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 108: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2026,12 +3277,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 109 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 109: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2041,12 +3295,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 110 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 110: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2056,13 +3313,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 111 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 111: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2073,13 +3334,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 112 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'PHANDLE TokenHandle']
 	case 112: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2090,12 +3355,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 113 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 113: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2105,12 +3373,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 114 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', 'PVOID PnPControlData', 'ULONG PnPControlDataLength']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2120,14 +3391,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 115 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2139,12 +3415,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 116 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', 'PPRIVILEGE_SET RequiredPrivileges', 'PBOOLEAN Result']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2154,14 +3433,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 117 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', 'PUNICODE_STRING ServiceName', 'HANDLE ClientToken', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2173,15 +3457,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 118 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2194,14 +3484,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 119 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'WIN32_PROTECTION_MASK NewProtectWin32', 'PULONG OldProtect']
 	case 119: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2213,11 +3508,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 120 NTSTATUS NtPulseEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2226,14 +3523,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 121 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', 'ATOM_INFORMATION_CLASS InformationClass', 'PVOID AtomInformation', 'ULONG AtomInformationLength', 'PULONG ReturnLength']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2245,11 +3547,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 122 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_BASIC_INFORMATION FileInformation']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2258,11 +3562,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 123 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', 'PLCID DefaultLocaleId']
 	case 123: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2271,10 +3577,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 124 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -2282,20 +3589,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 125 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass', 'BOOLEAN ReturnSingleEntry', 'PUNICODE_STRING FileName', 'BOOLEAN RestartScan']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2313,16 +3631,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 126 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'BOOLEAN RestartScan', 'PULONG Context', 'PULONG ReturnLength']
 	case 126: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2336,18 +3661,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 127 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID EaList', 'ULONG EaListLength', 'PULONG EaIndex', 'BOOLEAN RestartScan']
 	case 127: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2363,14 +3697,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 128 NTSTATUS NtQueryEvent ['HANDLE EventHandle', 'EVENT_INFORMATION_CLASS EventInformationClass', 'PVOID EventInformation', 'ULONG EventInformationLength', 'PULONG ReturnLength']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2382,11 +3721,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 129 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 	case 129: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2395,14 +3736,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 130 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 130: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2414,14 +3760,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 131 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength', 'PULONG ReturnLength']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2433,14 +3784,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 132 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', 'IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', 'PVOID IoCompletionInformation', 'ULONG IoCompletionInformationLength', 'PULONG ReturnLength']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2452,14 +3808,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 133 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', 'PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2471,14 +3832,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 134 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength', 'PULONG ReturnLength']
 	case 134: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2490,14 +3856,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 135 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength', 'PULONG ReturnLength']
 	case 135: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2509,14 +3880,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 136 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength', 'PULONG ReturnLength']
 	case 136: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2528,10 +3904,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 137 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 	case 137: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -2539,11 +3916,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 138 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', 'PULONG Interval']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2552,14 +3931,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 139 NTSTATUS NtQueryKey ['HANDLE KeyHandle', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2571,15 +3955,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 140 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', 'PKEY_VALUE_ENTRY ValueEntries', 'ULONG EntryCount', 'PVOID ValueBuffer', 'PULONG BufferLength', 'PULONG RequiredBufferLength']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2592,14 +3982,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 141 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', 'MUTANT_INFORMATION_CLASS MutantInformationClass', 'PVOID MutantInformation', 'ULONG MutantInformationLength', 'PULONG ReturnLength']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2611,14 +4006,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 142 NTSTATUS NtQueryObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength', 'PULONG ReturnLength']
 	case 142: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2630,11 +4030,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 143 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', 'PULONG HandleCount']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2643,11 +4045,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 144 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', 'PLARGE_INTEGER PerformanceFrequency']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2656,18 +4060,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 145 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID SidList', 'ULONG SidListLength', 'PULONG StartSid', 'BOOLEAN RestartScan']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2683,14 +4096,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 146 NTSTATUS NtQuerySection ['HANDLE SectionHandle', 'SECTION_INFORMATION_CLASS SectionInformationClass', 'PVOID SectionInformation', 'SIZE_T SectionInformationLength', 'PSIZE_T ReturnLength']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2702,14 +4120,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 147 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ULONG Length', 'PULONG LengthNeeded']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2721,14 +4144,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 148 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', 'SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', 'PVOID SemaphoreInformation', 'ULONG SemaphoreInformationLength', 'PULONG ReturnLength']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2740,12 +4168,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 149 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', 'PUNICODE_STRING LinkTarget', 'PULONG ReturnedLength']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2755,13 +4186,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 150 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PWSTR VariableValue', 'USHORT ValueLength', 'PUSHORT ReturnLength']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2772,13 +4207,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 151 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength', 'PULONG ReturnLength']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2789,10 +4228,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 152 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 	case 152: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -2800,14 +4240,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 153 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', 'TIMER_INFORMATION_CLASS TimerInformationClass', 'PVOID TimerInformation', 'ULONG TimerInformationLength', 'PULONG ReturnLength']
 	case 153: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2819,12 +4264,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 154 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', 'PULONG MinimumTime', 'PULONG CurrentTime']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2834,15 +4282,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 155 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2855,15 +4309,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 156 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'MEMORY_INFORMATION_CLASS MemoryInformationClass', 'PVOID MemoryInformation', 'SIZE_T MemoryInformationLength', 'PSIZE_T ReturnLength']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2876,14 +4336,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 157 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2895,14 +4360,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 158 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', 'PPS_APC_ROUTINE ApcRoutine', 'PVOID ApcArgument1', 'PVOID ApcArgument2', 'PVOID ApcArgument3']
 	case 158: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2914,12 +4384,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 159 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', 'PCONTEXT ContextRecord', 'BOOLEAN FirstChance']
 	case 159: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseException_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2929,15 +4402,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 160 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', 'ULONG NumberOfParameters', 'ULONG UnicodeStringParameterMask', 'PULONG_PTR Parameters', 'ULONG ValidResponseOptions', 'PULONG Response']
 	case 160: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2950,18 +4429,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 161 NTSTATUS NtReadFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2977,18 +4465,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 162 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3004,15 +4501,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 163 NTSTATUS NtReadRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3025,14 +4528,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 164 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3044,10 +4552,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 165 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -3055,11 +4564,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 166 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', 'PLONG PreviousCount']
 	case 166: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3068,12 +4579,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 167 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', 'LONG ReleaseCount', 'PLONG PreviousCount']
 	case 167: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3083,14 +4597,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 168 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', 'PVOID *KeyContext', 'PVOID *ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER Timeout']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3102,12 +4621,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 169 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', 'HANDLE TargetHandle', 'POBJECT_ATTRIBUTES OldFile']
 	case 169: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3117,11 +4639,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 170 NTSTATUS NtReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3130,13 +4654,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 171 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3147,14 +4675,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 172 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage', 'PLARGE_INTEGER Timeout']
 	case 172: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3166,11 +4699,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 173 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 173: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3179,11 +4714,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 175 NTSTATUS NtRequestPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage']
 	case 175: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3192,12 +4729,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 176 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage', 'PPORT_MESSAGE ReplyMessage']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3207,11 +4747,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 178 NTSTATUS NtResetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 178: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3220,12 +4762,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 179 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T RegionSize']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3235,12 +4780,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 180 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Flags']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3250,11 +4798,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 181 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3263,11 +4813,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 182 NTSTATUS NtSaveKey ['HANDLE KeyHandle', 'HANDLE FileHandle']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3276,12 +4828,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 183 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', 'HANDLE LowPrecedenceKeyHandle', 'HANDLE FileHandle']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3291,18 +4846,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 184 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PSID RequiredServerSid', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3318,14 +4882,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 185 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', 'PVOID KeyContext', 'PVOID ApcContext', 'NTSTATUS IoStatus', 'ULONG_PTR IoStatusInformation']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3337,11 +4906,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 186 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3350,10 +4921,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 187 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 	case 187: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -3361,11 +4933,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 188 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', 'LCID DefaultLocaleId']
 	case 188: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3374,10 +4948,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 189 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 	case 189: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3385,13 +4960,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 190 NTSTATUS NtSetEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 190: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3402,11 +4981,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 191 NTSTATUS NtSetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3415,10 +4996,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 192 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -3426,10 +5008,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 193 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3437,14 +5020,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 194 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3456,13 +5044,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 195 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3473,13 +5065,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 196 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', 'KEY_SET_INFORMATION_CLASS KeySetInformationClass', 'PVOID KeySetInformation', 'ULONG KeySetInformationLength']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3490,13 +5086,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 197 NTSTATUS NtSetInformationObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3507,13 +5107,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 198 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength']
 	case 198: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3524,13 +5128,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 199 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength']
 	case 199: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3541,13 +5149,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 200 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength']
 	case 200: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3558,11 +5170,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 201 NTSTATUS NtSetIntervalProfile ['ULONG Interval', 'KPROFILE_SOURCE Source']
 	case 201: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3571,15 +5185,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 202 NTSTATUS NtSetLdtEntries ['ULONG Selector0', 'ULONG Entry0Low', 'ULONG Entry0Hi', 'ULONG Selector1', 'ULONG Entry1Low', 'ULONG Entry1Hi']
 	case 202: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3592,10 +5212,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 203 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -3603,10 +5224,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 204 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -3614,13 +5236,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 205 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 205: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3631,12 +5257,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 206 NTSTATUS NtSetSecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor']
 	case 206: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3646,11 +5275,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 207 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PUNICODE_STRING VariableValue']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3659,12 +5290,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 208 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3674,12 +5308,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 209 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3689,11 +5326,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 210 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', 'PLARGE_INTEGER PreviousTime']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3702,11 +5341,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 211 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', 'PEXECUTION_STATE PreviousFlags']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3715,16 +5356,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 212 NTSTATUS NtSetTimer ['HANDLE TimerHandle', 'PLARGE_INTEGER DueTime', 'PTIMER_APC_ROUTINE TimerApcRoutine', 'PVOID TimerContext', 'BOOLEAN WakeTimer', 'LONG Period', 'PBOOLEAN PreviousState']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3738,12 +5386,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 213 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', 'BOOLEAN SetResolution', 'PULONG ActualTime']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3753,10 +5404,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 214 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -3764,15 +5416,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 215 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'ULONG TitleIndex', 'ULONG Type', 'PVOID Data', 'ULONG DataSize']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3785,14 +5443,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 216 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3804,10 +5467,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 217 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -3815,13 +5479,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 218 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', 'HANDLE WaitHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3832,10 +5500,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 219 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStartProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -3843,10 +5512,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 220 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStopProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -3854,11 +5524,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 221 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3867,15 +5539,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 222 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength', 'PULONG ReturnLength']
 	case 222: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3888,11 +5566,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 223 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', 'NTSTATUS ExitStatus']
 	case 223: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3901,11 +5581,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 224 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', 'NTSTATUS ExitStatus']
 	case 224: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3914,11 +5596,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 225 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', 'NTSTATUS ExitStatus']
 	case 225: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3932,10 +5616,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 227 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -3943,10 +5628,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 228 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 	case 228: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -3954,14 +5640,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 229 NTSTATUS NtUnlockFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3973,13 +5664,17 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 230 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3990,11 +5685,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 231 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', 'PVOID BaseAddress']
 	case 231: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4003,11 +5700,13 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 232 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', 'PVOID ServiceData']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtVdmControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4016,14 +5715,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 233 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', 'HANDLE Handles[]', 'WAIT_TYPE WaitType', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4035,12 +5739,15 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 234 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 234: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4050,10 +5757,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 235 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -4061,10 +5769,11 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 236 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -4072,18 +5781,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 237 NTSTATUS NtWriteFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 237: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4099,18 +5817,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 238 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 238: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4126,15 +5853,21 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 239 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 239: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4147,14 +5880,19 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	// 240 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4175,7 +5913,7 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
@@ -13,21 +13,1243 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_windows_7_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef TARGET_I386
+	subs.assign(400 + 1, unknown);
+	subs[0] = all |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[1] = all |
+		(PPP_CHECK_CB(on_NtAccessCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[2] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[3] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[4] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[5] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[6] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[7] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[8] = all |
+		(PPP_CHECK_CB(on_NtAddAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[9] = all |
+		(PPP_CHECK_CB(on_NtAddBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[10] = all |
+		(PPP_CHECK_CB(on_NtAddDriverEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddDriverEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[11] = all |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[12] = all |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[13] = all |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[14] = all |
+		(PPP_CHECK_CB(on_NtAlertThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[15] = all |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[16] = all |
+		(PPP_CHECK_CB(on_NtAllocateReserveObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateReserveObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[17] = all |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[18] = all |
+		(PPP_CHECK_CB(on_NtAllocateUuids_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUuids_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[19] = all |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[20] = all |
+		(PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[21] = all |
+		(PPP_CHECK_CB(on_NtAlpcCancelMessage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCancelMessage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[22] = all |
+		(PPP_CHECK_CB(on_NtAlpcConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[23] = all |
+		(PPP_CHECK_CB(on_NtAlpcCreatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCreatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[24] = all |
+		(PPP_CHECK_CB(on_NtAlpcCreatePortSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCreatePortSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[25] = all |
+		(PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[26] = all |
+		(PPP_CHECK_CB(on_NtAlpcCreateSectionView_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCreateSectionView_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[27] = all |
+		(PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[28] = all |
+		(PPP_CHECK_CB(on_NtAlpcDeletePortSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcDeletePortSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[29] = all |
+		(PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[30] = all |
+		(PPP_CHECK_CB(on_NtAlpcDeleteSectionView_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[31] = all |
+		(PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[32] = all |
+		(PPP_CHECK_CB(on_NtAlpcDisconnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcDisconnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[33] = all |
+		(PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[34] = all |
+		(PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[35] = all |
+		(PPP_CHECK_CB(on_NtAlpcOpenSenderThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[36] = all |
+		(PPP_CHECK_CB(on_NtAlpcQueryInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcQueryInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[37] = all |
+		(PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[38] = all |
+		(PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[39] = all |
+		(PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[40] = all |
+		(PPP_CHECK_CB(on_NtAlpcSetInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlpcSetInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[41] = all |
+		(PPP_CHECK_CB(on_NtApphelpCacheControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtApphelpCacheControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[42] = all |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[43] = all |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[44] = all |
+		(PPP_CHECK_CB(on_NtCallbackReturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCallbackReturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[45] = all |
+		(PPP_CHECK_CB(on_NtCancelIoFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelIoFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[46] = all |
+		(PPP_CHECK_CB(on_NtCancelIoFileEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelIoFileEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[47] = all |
+		(PPP_CHECK_CB(on_NtCancelSynchronousIoFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[48] = all |
+		(PPP_CHECK_CB(on_NtCancelTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[49] = all |
+		(PPP_CHECK_CB(on_NtClearEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClearEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[50] = all |
+		(PPP_CHECK_CB(on_NtClose_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClose_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[51] = all |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[52] = all |
+		(PPP_CHECK_CB(on_NtCommitComplete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCommitComplete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[53] = all |
+		(PPP_CHECK_CB(on_NtCommitEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCommitEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[54] = all |
+		(PPP_CHECK_CB(on_NtCommitTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCommitTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[55] = all |
+		(PPP_CHECK_CB(on_NtCompactKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompactKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[56] = all |
+		(PPP_CHECK_CB(on_NtCompareTokens_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompareTokens_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[57] = all |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[58] = all |
+		(PPP_CHECK_CB(on_NtCompressKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompressKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[59] = all |
+		(PPP_CHECK_CB(on_NtConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[60] = all |
+		(PPP_CHECK_CB(on_NtContinue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtContinue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[61] = all |
+		(PPP_CHECK_CB(on_NtCreateDebugObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateDebugObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[62] = all |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[63] = all |
+		(PPP_CHECK_CB(on_NtCreateEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[64] = all |
+		(PPP_CHECK_CB(on_NtCreateEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[65] = all |
+		(PPP_CHECK_CB(on_NtCreateEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[66] = all |
+		(PPP_CHECK_CB(on_NtCreateFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[67] = all |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[68] = all |
+		(PPP_CHECK_CB(on_NtCreateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[69] = all |
+		(PPP_CHECK_CB(on_NtCreateJobSet_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateJobSet_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[70] = all |
+		(PPP_CHECK_CB(on_NtCreateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[71] = all |
+		(PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[72] = all |
+		(PPP_CHECK_CB(on_NtCreateKeyTransacted_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKeyTransacted_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[73] = all |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[74] = all |
+		(PPP_CHECK_CB(on_NtCreateMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[75] = all |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[76] = all |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[77] = all |
+		(PPP_CHECK_CB(on_NtCreatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[78] = all |
+		(PPP_CHECK_CB(on_NtCreatePrivateNamespace_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePrivateNamespace_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[79] = all |
+		(PPP_CHECK_CB(on_NtCreateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[80] = all |
+		(PPP_CHECK_CB(on_NtCreateProcessEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProcessEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[81] = all |
+		(PPP_CHECK_CB(on_NtCreateProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[82] = all |
+		(PPP_CHECK_CB(on_NtCreateProfileEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProfileEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[83] = all |
+		(PPP_CHECK_CB(on_NtCreateResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[84] = all |
+		(PPP_CHECK_CB(on_NtCreateSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[85] = all |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[86] = all |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[87] = all |
+		(PPP_CHECK_CB(on_NtCreateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[88] = all |
+		(PPP_CHECK_CB(on_NtCreateThreadEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateThreadEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[89] = all |
+		(PPP_CHECK_CB(on_NtCreateTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[90] = all |
+		(PPP_CHECK_CB(on_NtCreateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[91] = all |
+		(PPP_CHECK_CB(on_NtCreateTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[92] = all |
+		(PPP_CHECK_CB(on_NtCreateTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[93] = all |
+		(PPP_CHECK_CB(on_NtCreateUserProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateUserProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[94] = all |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[95] = all |
+		(PPP_CHECK_CB(on_NtCreateWorkerFactory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateWorkerFactory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[96] = all |
+		(PPP_CHECK_CB(on_NtDebugActiveProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDebugActiveProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[97] = all |
+		(PPP_CHECK_CB(on_NtDebugContinue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDebugContinue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[98] = all |
+		(PPP_CHECK_CB(on_NtDelayExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDelayExecution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[99] = all |
+		(PPP_CHECK_CB(on_NtDeleteAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[100] = all |
+		(PPP_CHECK_CB(on_NtDeleteBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[101] = all |
+		(PPP_CHECK_CB(on_NtDeleteDriverEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteDriverEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[102] = all |
+		(PPP_CHECK_CB(on_NtDeleteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[103] = all |
+		(PPP_CHECK_CB(on_NtDeleteKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[104] = all |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[105] = all |
+		(PPP_CHECK_CB(on_NtDeletePrivateNamespace_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeletePrivateNamespace_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[106] = all |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[107] = all |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[108] = all |
+		(PPP_CHECK_CB(on_NtDisableLastKnownGood_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDisableLastKnownGood_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[109] = all |
+		(PPP_CHECK_CB(on_NtDisplayString_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDisplayString_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[110] = all |
+		(PPP_CHECK_CB(on_NtDrawText_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDrawText_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[111] = all |
+		(PPP_CHECK_CB(on_NtDuplicateObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[112] = all |
+		(PPP_CHECK_CB(on_NtDuplicateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[113] = all |
+		(PPP_CHECK_CB(on_NtEnableLastKnownGood_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnableLastKnownGood_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[114] = all |
+		(PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateBootEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[115] = all |
+		(PPP_CHECK_CB(on_NtEnumerateDriverEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateDriverEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[116] = all |
+		(PPP_CHECK_CB(on_NtEnumerateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[117] = all |
+		(PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[118] = all |
+		(PPP_CHECK_CB(on_NtEnumerateTransactionObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateTransactionObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[119] = all |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[120] = all |
+		(PPP_CHECK_CB(on_NtExtendSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtExtendSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[121] = all |
+		(PPP_CHECK_CB(on_NtFilterToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFilterToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[122] = all |
+		(PPP_CHECK_CB(on_NtFindAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFindAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[123] = all |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[124] = all |
+		(PPP_CHECK_CB(on_NtFlushInstallUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushInstallUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[125] = all |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[126] = all |
+		(PPP_CHECK_CB(on_NtFlushKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[127] = all |
+		(PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushProcessWriteBuffers_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[128] = all |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[129] = all |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[130] = all |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[131] = all |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[132] = all |
+		(PPP_CHECK_CB(on_NtFreezeRegistry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreezeRegistry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[133] = all |
+		(PPP_CHECK_CB(on_NtFreezeTransactions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreezeTransactions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[134] = all |
+		(PPP_CHECK_CB(on_NtFsControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFsControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[135] = all |
+		(PPP_CHECK_CB(on_NtGetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[136] = all |
+		(PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetCurrentProcessorNumber_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[137] = all |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[138] = all |
+		(PPP_CHECK_CB(on_NtGetMUIRegistryInfo_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[139] = all |
+		(PPP_CHECK_CB(on_NtGetNextProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetNextProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[140] = all |
+		(PPP_CHECK_CB(on_NtGetNextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetNextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[141] = all |
+		(PPP_CHECK_CB(on_NtGetNlsSectionPtr_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetNlsSectionPtr_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[142] = all |
+		(PPP_CHECK_CB(on_NtGetNotificationResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetNotificationResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[143] = all |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[144] = all |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[145] = all |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[146] = all |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[147] = all |
+		(PPP_CHECK_CB(on_NtImpersonateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[148] = all |
+		(PPP_CHECK_CB(on_NtInitializeNlsFiles_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitializeNlsFiles_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[149] = all |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[150] = all |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[151] = all |
+		(PPP_CHECK_CB(on_NtIsProcessInJob_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsProcessInJob_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[152] = all |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[153] = all |
+		(PPP_CHECK_CB(on_NtIsUILanguageComitted_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsUILanguageComitted_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[154] = all |
+		(PPP_CHECK_CB(on_NtListenPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtListenPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[155] = all |
+		(PPP_CHECK_CB(on_NtLoadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[156] = all |
+		(PPP_CHECK_CB(on_NtLoadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[157] = all |
+		(PPP_CHECK_CB(on_NtLoadKey2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[158] = all |
+		(PPP_CHECK_CB(on_NtLoadKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[159] = all |
+		(PPP_CHECK_CB(on_NtLockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[160] = all |
+		(PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockProductActivationKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[161] = all |
+		(PPP_CHECK_CB(on_NtLockRegistryKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockRegistryKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[162] = all |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[163] = all |
+		(PPP_CHECK_CB(on_NtMakePermanentObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMakePermanentObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[164] = all |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[165] = all |
+		(PPP_CHECK_CB(on_NtMapCMFModule_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapCMFModule_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[166] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[167] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[168] = all |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[169] = all |
+		(PPP_CHECK_CB(on_NtModifyBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtModifyBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[170] = all |
+		(PPP_CHECK_CB(on_NtModifyDriverEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtModifyDriverEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[171] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[172] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[173] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[174] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeSession_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeSession_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[175] = all |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[176] = all |
+		(PPP_CHECK_CB(on_NtOpenEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[177] = all |
+		(PPP_CHECK_CB(on_NtOpenEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[178] = all |
+		(PPP_CHECK_CB(on_NtOpenEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[179] = all |
+		(PPP_CHECK_CB(on_NtOpenFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[180] = all |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[181] = all |
+		(PPP_CHECK_CB(on_NtOpenJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[182] = all |
+		(PPP_CHECK_CB(on_NtOpenKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[183] = all |
+		(PPP_CHECK_CB(on_NtOpenKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[184] = all |
+		(PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[185] = all |
+		(PPP_CHECK_CB(on_NtOpenKeyTransacted_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKeyTransacted_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[186] = all |
+		(PPP_CHECK_CB(on_NtOpenKeyTransactedEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[187] = all |
+		(PPP_CHECK_CB(on_NtOpenMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[188] = all |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[189] = all |
+		(PPP_CHECK_CB(on_NtOpenPrivateNamespace_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenPrivateNamespace_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[190] = all |
+		(PPP_CHECK_CB(on_NtOpenProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[191] = all |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[192] = all |
+		(PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcessTokenEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[193] = all |
+		(PPP_CHECK_CB(on_NtOpenResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[194] = all |
+		(PPP_CHECK_CB(on_NtOpenSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[195] = all |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[196] = all |
+		(PPP_CHECK_CB(on_NtOpenSession_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSession_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[197] = all |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[198] = all |
+		(PPP_CHECK_CB(on_NtOpenThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[199] = all |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[200] = all |
+		(PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThreadTokenEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[201] = all |
+		(PPP_CHECK_CB(on_NtOpenTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[202] = all |
+		(PPP_CHECK_CB(on_NtOpenTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[203] = all |
+		(PPP_CHECK_CB(on_NtOpenTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[204] = all |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[205] = all |
+		(PPP_CHECK_CB(on_NtPowerInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPowerInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[206] = all |
+		(PPP_CHECK_CB(on_NtPrepareComplete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrepareComplete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[207] = all |
+		(PPP_CHECK_CB(on_NtPrepareEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrepareEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[208] = all |
+		(PPP_CHECK_CB(on_NtPrePrepareComplete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrePrepareComplete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[209] = all |
+		(PPP_CHECK_CB(on_NtPrePrepareEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrePrepareEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[210] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[211] = all |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[212] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[213] = all |
+		(PPP_CHECK_CB(on_NtPropagationComplete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPropagationComplete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[214] = all |
+		(PPP_CHECK_CB(on_NtPropagationFailed_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPropagationFailed_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[215] = all |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[216] = all |
+		(PPP_CHECK_CB(on_NtPulseEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPulseEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[217] = all |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[218] = all |
+		(PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryBootEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[219] = all |
+		(PPP_CHECK_CB(on_NtQueryBootOptions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryBootOptions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[220] = all |
+		(PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDebugFilterState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[221] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[222] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[223] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[224] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[225] = all |
+		(PPP_CHECK_CB(on_NtQueryDriverEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[226] = all |
+		(PPP_CHECK_CB(on_NtQueryEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[227] = all |
+		(PPP_CHECK_CB(on_NtQueryEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[228] = all |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[229] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[230] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[231] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[232] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[233] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[234] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[235] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[236] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[237] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[238] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[239] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[240] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[241] = all |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[242] = all |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[243] = all |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[244] = all |
+		(PPP_CHECK_CB(on_NtQueryKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[245] = all |
+		(PPP_CHECK_CB(on_NtQueryLicenseValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryLicenseValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[246] = all |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[247] = all |
+		(PPP_CHECK_CB(on_NtQueryMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[248] = all |
+		(PPP_CHECK_CB(on_NtQueryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[249] = all |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[250] = all |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[251] = all |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[252] = all |
+		(PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryPortInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[253] = all |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[254] = all |
+		(PPP_CHECK_CB(on_NtQuerySection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[255] = all |
+		(PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[256] = all |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[257] = all |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[258] = all |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[259] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[260] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[261] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[262] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemInformationEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemInformationEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[263] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[264] = all |
+		(PPP_CHECK_CB(on_NtQueryTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[265] = all |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[266] = all |
+		(PPP_CHECK_CB(on_NtQueryValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[267] = all |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[268] = all |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[269] = all |
+		(PPP_CHECK_CB(on_NtQueueApcThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueueApcThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[270] = all |
+		(PPP_CHECK_CB(on_NtQueueApcThreadEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueueApcThreadEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[271] = all |
+		(PPP_CHECK_CB(on_NtRaiseException_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseException_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[272] = all |
+		(PPP_CHECK_CB(on_NtRaiseHardError_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseHardError_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[273] = all |
+		(PPP_CHECK_CB(on_NtReadFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[274] = all |
+		(PPP_CHECK_CB(on_NtReadFileScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFileScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[275] = all |
+		(PPP_CHECK_CB(on_NtReadOnlyEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadOnlyEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[276] = all |
+		(PPP_CHECK_CB(on_NtReadRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[277] = all |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[278] = all |
+		(PPP_CHECK_CB(on_NtRecoverEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRecoverEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[279] = all |
+		(PPP_CHECK_CB(on_NtRecoverResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRecoverResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[280] = all |
+		(PPP_CHECK_CB(on_NtRecoverTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRecoverTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[281] = all |
+		(PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[282] = all |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[283] = all |
+		(PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[284] = all |
+		(PPP_CHECK_CB(on_NtReleaseMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[285] = all |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[286] = all |
+		(PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[287] = all |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[288] = all |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletionEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[289] = all |
+		(PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveProcessDebug_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[290] = all |
+		(PPP_CHECK_CB(on_NtRenameKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRenameKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[291] = all |
+		(PPP_CHECK_CB(on_NtRenameTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRenameTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[292] = all |
+		(PPP_CHECK_CB(on_NtReplaceKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplaceKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[293] = all |
+		(PPP_CHECK_CB(on_NtReplacePartitionUnit_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplacePartitionUnit_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[294] = all |
+		(PPP_CHECK_CB(on_NtReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[295] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[296] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[297] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[298] = all |
+		(PPP_CHECK_CB(on_NtRequestPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[299] = all |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[300] = all |
+		(PPP_CHECK_CB(on_NtResetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[301] = all |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[302] = all |
+		(PPP_CHECK_CB(on_NtRestoreKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRestoreKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[303] = all |
+		(PPP_CHECK_CB(on_NtResumeProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResumeProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[304] = all |
+		(PPP_CHECK_CB(on_NtResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[305] = all |
+		(PPP_CHECK_CB(on_NtRollbackComplete_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRollbackComplete_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[306] = all |
+		(PPP_CHECK_CB(on_NtRollbackEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRollbackEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[307] = all |
+		(PPP_CHECK_CB(on_NtRollbackTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRollbackTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[308] = all |
+		(PPP_CHECK_CB(on_NtRollforwardTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRollforwardTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[309] = all |
+		(PPP_CHECK_CB(on_NtSaveKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[310] = all |
+		(PPP_CHECK_CB(on_NtSaveKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[311] = all |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[312] = all |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[313] = all |
+		(PPP_CHECK_CB(on_NtSerializeBoot_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSerializeBoot_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[314] = all |
+		(PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetBootEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[315] = all |
+		(PPP_CHECK_CB(on_NtSetBootOptions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetBootOptions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[316] = all |
+		(PPP_CHECK_CB(on_NtSetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[317] = all |
+		(PPP_CHECK_CB(on_NtSetDebugFilterState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDebugFilterState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[318] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[319] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[320] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[321] = all |
+		(PPP_CHECK_CB(on_NtSetDriverEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDriverEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[322] = all |
+		(PPP_CHECK_CB(on_NtSetEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[323] = all |
+		(PPP_CHECK_CB(on_NtSetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[324] = all |
+		(PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEventBoostPriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[325] = all |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[326] = all |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[327] = all |
+		(PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationDebugObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[328] = all |
+		(PPP_CHECK_CB(on_NtSetInformationEnlistment_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationEnlistment_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[329] = all |
+		(PPP_CHECK_CB(on_NtSetInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[330] = all |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[331] = all |
+		(PPP_CHECK_CB(on_NtSetInformationKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[332] = all |
+		(PPP_CHECK_CB(on_NtSetInformationObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[333] = all |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[334] = all |
+		(PPP_CHECK_CB(on_NtSetInformationResourceManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationResourceManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[335] = all |
+		(PPP_CHECK_CB(on_NtSetInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[336] = all |
+		(PPP_CHECK_CB(on_NtSetInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[337] = all |
+		(PPP_CHECK_CB(on_NtSetInformationTransaction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationTransaction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[338] = all |
+		(PPP_CHECK_CB(on_NtSetInformationTransactionManager_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationTransactionManager_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[339] = all |
+		(PPP_CHECK_CB(on_NtSetInformationWorkerFactory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[340] = all |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[341] = all |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[342] = all |
+		(PPP_CHECK_CB(on_NtSetIoCompletionEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIoCompletionEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[343] = all |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[344] = all |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[345] = all |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[346] = all |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[347] = all |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[348] = all |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[349] = all |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[350] = all |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[351] = all |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[352] = all |
+		(PPP_CHECK_CB(on_NtSetSystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[353] = all |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[354] = all |
+		(PPP_CHECK_CB(on_NtSetTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[355] = all |
+		(PPP_CHECK_CB(on_NtSetTimerEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimerEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[356] = all |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[357] = all |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[358] = all |
+		(PPP_CHECK_CB(on_NtSetValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[359] = all |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[360] = all |
+		(PPP_CHECK_CB(on_NtShutdownSystem_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtShutdownSystem_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[361] = all |
+		(PPP_CHECK_CB(on_NtShutdownWorkerFactory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtShutdownWorkerFactory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[362] = all |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[363] = all |
+		(PPP_CHECK_CB(on_NtSinglePhaseReject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSinglePhaseReject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[364] = all |
+		(PPP_CHECK_CB(on_NtStartProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStartProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[365] = all |
+		(PPP_CHECK_CB(on_NtStopProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStopProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[366] = all |
+		(PPP_CHECK_CB(on_NtSuspendProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSuspendProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[367] = all |
+		(PPP_CHECK_CB(on_NtSuspendThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSuspendThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[368] = all |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[369] = all |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[370] = all |
+		(PPP_CHECK_CB(on_NtTerminateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[371] = all |
+		(PPP_CHECK_CB(on_NtTerminateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[372] = all |
+		(PPP_CHECK_CB(on_NtTestAlert_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTestAlert_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[373] = all |
+		(PPP_CHECK_CB(on_NtThawRegistry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtThawRegistry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[374] = all |
+		(PPP_CHECK_CB(on_NtThawTransactions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtThawTransactions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[375] = all |
+		(PPP_CHECK_CB(on_NtTraceControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTraceControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[376] = all |
+		(PPP_CHECK_CB(on_NtTraceEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTraceEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[377] = all |
+		(PPP_CHECK_CB(on_NtTranslateFilePath_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTranslateFilePath_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[378] = all |
+		(PPP_CHECK_CB(on_NtUmsThreadYield_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUmsThreadYield_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[379] = all |
+		(PPP_CHECK_CB(on_NtUnloadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[380] = all |
+		(PPP_CHECK_CB(on_NtUnloadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[381] = all |
+		(PPP_CHECK_CB(on_NtUnloadKey2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKey2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[382] = all |
+		(PPP_CHECK_CB(on_NtUnloadKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[383] = all |
+		(PPP_CHECK_CB(on_NtUnlockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[384] = all |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[385] = all |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[386] = all |
+		(PPP_CHECK_CB(on_NtVdmControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtVdmControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[387] = all |
+		(PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForDebugEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[388] = all |
+		(PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[389] = all |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[390] = all |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects32_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[391] = all |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[392] = all |
+		(PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[393] = all |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[394] = all |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[395] = all |
+		(PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[396] = all |
+		(PPP_CHECK_CB(on_NtWriteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[397] = all |
+		(PPP_CHECK_CB(on_NtWriteFileGather_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFileGather_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[398] = all |
+		(PPP_CHECK_CB(on_NtWriteRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[399] = all |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[400] = all |
+		(PPP_CHECK_CB(on_NtYieldExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtYieldExecution_return) ? SYSCALL_SUB_RETURN : 0);
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 #ifdef TARGET_I386
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[R_EAX];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -35,15 +1257,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', 'PVOID PortContext', 'PPORT_MESSAGE ConnectionRequest', 'BOOLEAN AcceptConnection', 'PPORT_VIEW ServerView', 'PREMOTE_PORT_VIEW ClientView']
 	case 0: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -56,17 +1284,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 1: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -81,20 +1317,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 2: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -112,20 +1359,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -143,25 +1401,41 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -184,20 +1458,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -215,25 +1500,41 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -256,26 +1557,43 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 7: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		uint32_t arg16 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
+			arg16 = get_32(cpu, 16);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -299,12 +1617,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 8 NTSTATUS NtAddAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -314,11 +1635,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 9 NTSTATUS NtAddBootEntry ['PBOOT_ENTRY BootEntry', 'PULONG Id']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -327,11 +1650,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 10 NTSTATUS NtAddDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry', 'PULONG Id']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAddDriverEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddDriverEntry_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -340,15 +1665,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 11 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', 'BOOLEAN ResetToDefault', 'PTOKEN_GROUPS NewState', 'ULONG BufferLength', 'PTOKEN_GROUPS PreviousState', 'PULONG ReturnLength']
 	case 11: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -361,15 +1692,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 12 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', 'BOOLEAN DisableAllPrivileges', 'PTOKEN_PRIVILEGES NewState', 'ULONG BufferLength', 'PTOKEN_PRIVILEGES PreviousState', 'PULONG ReturnLength']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -382,11 +1719,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 13 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -395,10 +1734,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 14 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertThread_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -406,10 +1746,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 15 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -417,12 +1758,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 16 NTSTATUS NtAllocateReserveObject ['PHANDLE MemoryReserveHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'MEMORY_RESERVE_TYPE Type']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateReserveObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateReserveObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -432,12 +1776,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 17 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 17: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -447,13 +1794,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 18 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', 'PULONG Range', 'PULONG Sequence', 'PCHAR Seed']
 	case 18: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -464,15 +1815,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 19 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'PSIZE_T RegionSize', 'ULONG AllocationType', 'ULONG Protect']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -485,18 +1842,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 20 NTSTATUS NtAlpcAcceptConnectPort ['PHANDLE PortHandle', 'HANDLE ConnectionPortHandle', 'ULONG Flags', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PALPC_PORT_ATTRIBUTES PortAttributes', 'PVOID PortContext', 'PPORT_MESSAGE ConnectionRequest', 'PALPC_MESSAGE_ATTRIBUTES ConnectionMessageAttributes', 'BOOLEAN AcceptConnection']
 	case 20: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcAcceptConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -512,12 +1878,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 21 NTSTATUS NtAlpcCancelMessage ['HANDLE PortHandle', 'ULONG Flags', 'PALPC_CONTEXT_ATTR MessageContext']
 	case 21: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCancelMessage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCancelMessage_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -527,20 +1896,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 22 NTSTATUS NtAlpcConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PALPC_PORT_ATTRIBUTES PortAttributes', 'ULONG Flags', 'PSID RequiredServerSid', 'PPORT_MESSAGE ConnectionMessage', 'PULONG BufferLength', 'PALPC_MESSAGE_ATTRIBUTES OutMessageAttributes', 'PALPC_MESSAGE_ATTRIBUTES InMessageAttributes', 'PLARGE_INTEGER Timeout']
 	case 22: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -558,12 +1938,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 23 NTSTATUS NtAlpcCreatePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PALPC_PORT_ATTRIBUTES PortAttributes']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCreatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreatePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -573,15 +1956,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 24 NTSTATUS NtAlpcCreatePortSection ['HANDLE PortHandle', 'ULONG Flags', 'HANDLE SectionHandle', 'SIZE_T SectionSize', 'PALPC_HANDLE AlpcSectionHandle', 'PSIZE_T ActualSectionSize']
 	case 24: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCreatePortSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreatePortSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -594,13 +1983,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 25 NTSTATUS NtAlpcCreateResourceReserve ['HANDLE PortHandle', 'ULONG Flags', 'SIZE_T MessageSize', 'PALPC_HANDLE ResourceId']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateResourceReserve_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -611,12 +2004,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 26 NTSTATUS NtAlpcCreateSectionView ['HANDLE PortHandle', 'ULONG Flags', 'PALPC_DATA_VIEW_ATTR ViewAttributes']
 	case 26: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCreateSectionView_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateSectionView_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -626,12 +2022,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 27 NTSTATUS NtAlpcCreateSecurityContext ['HANDLE PortHandle', 'ULONG Flags', 'PALPC_SECURITY_ATTR SecurityAttribute']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcCreateSecurityContext_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -641,12 +2040,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 28 NTSTATUS NtAlpcDeletePortSection ['HANDLE PortHandle', 'ULONG Flags', 'ALPC_HANDLE SectionHandle']
 	case 28: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcDeletePortSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeletePortSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -656,12 +2058,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 29 NTSTATUS NtAlpcDeleteResourceReserve ['HANDLE PortHandle', 'ULONG Flags', 'ALPC_HANDLE ResourceId']
 	case 29: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteResourceReserve_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -671,12 +2076,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 30 NTSTATUS NtAlpcDeleteSectionView ['HANDLE PortHandle', 'ULONG Flags', 'PVOID ViewBase']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcDeleteSectionView_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteSectionView_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -686,12 +2094,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 31 NTSTATUS NtAlpcDeleteSecurityContext ['HANDLE PortHandle', 'ULONG Flags', 'ALPC_HANDLE ContextHandle']
 	case 31: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDeleteSecurityContext_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -701,11 +2112,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 32 NTSTATUS NtAlpcDisconnectPort ['HANDLE PortHandle', 'ULONG Flags']
 	case 32: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcDisconnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcDisconnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -714,12 +2127,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 33 NTSTATUS NtAlpcImpersonateClientOfPort ['HANDLE PortHandle', 'PPORT_MESSAGE PortMessage', 'PVOID Reserved']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcImpersonateClientOfPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -729,15 +2145,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 34 NTSTATUS NtAlpcOpenSenderProcess ['PHANDLE ProcessHandle', 'HANDLE PortHandle', 'PPORT_MESSAGE PortMessage', 'ULONG Flags', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 34: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcOpenSenderProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -750,15 +2172,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 35 NTSTATUS NtAlpcOpenSenderThread ['PHANDLE ThreadHandle', 'HANDLE PortHandle', 'PPORT_MESSAGE PortMessage', 'ULONG Flags', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 35: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcOpenSenderThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcOpenSenderThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -771,14 +2199,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 36 NTSTATUS NtAlpcQueryInformation ['HANDLE PortHandle', 'ALPC_PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 36: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcQueryInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcQueryInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -790,15 +2223,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 37 NTSTATUS NtAlpcQueryInformationMessage ['HANDLE PortHandle', 'PPORT_MESSAGE PortMessage', 'ALPC_MESSAGE_INFORMATION_CLASS MessageInformationClass', 'PVOID MessageInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 37: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcQueryInformationMessage_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -811,12 +2250,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 38 NTSTATUS NtAlpcRevokeSecurityContext ['HANDLE PortHandle', 'ULONG Flags', 'ALPC_HANDLE ContextHandle']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcRevokeSecurityContext_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -826,17 +2268,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 39 NTSTATUS NtAlpcSendWaitReceivePort ['HANDLE PortHandle', 'ULONG Flags', 'PPORT_MESSAGE SendMessage', 'PALPC_MESSAGE_ATTRIBUTES SendMessageAttributes', 'PPORT_MESSAGE ReceiveMessage', 'PULONG BufferLength', 'PALPC_MESSAGE_ATTRIBUTES ReceiveMessageAttributes', 'PLARGE_INTEGER Timeout']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcSendWaitReceivePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -851,13 +2301,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 40 NTSTATUS NtAlpcSetInformation ['HANDLE PortHandle', 'ALPC_PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtAlpcSetInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlpcSetInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -868,11 +2322,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 41 NTSTATUS NtApphelpCacheControl ['APPHELPCOMMAND type', 'PVOID buf']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtApphelpCacheControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtApphelpCacheControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -881,11 +2337,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 42 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', 'PVOID File2MappedAsFile']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -894,11 +2352,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 43 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', 'HANDLE ProcessHandle']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -907,12 +2367,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 44 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', 'ULONG OutputLength', 'NTSTATUS Status']
 	case 44: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -922,11 +2385,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 45 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -935,12 +2400,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 46 NTSTATUS NtCancelIoFileEx ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoRequestToCancel', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCancelIoFileEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFileEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -950,12 +2418,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 47 NTSTATUS NtCancelSynchronousIoFile ['HANDLE ThreadHandle', 'PIO_STATUS_BLOCK IoRequestToCancel', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 47: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCancelSynchronousIoFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelSynchronousIoFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -965,11 +2436,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 48 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', 'PBOOLEAN CurrentState']
 	case 48: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -978,10 +2451,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 49 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 	case 49: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClearEvent_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -989,10 +2463,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 50 NTSTATUS NtClose ['HANDLE Handle']
 	case 50: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClose_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -1000,12 +2475,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 51 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1015,11 +2493,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 52 NTSTATUS NtCommitComplete ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCommitComplete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitComplete_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1028,11 +2508,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 53 NTSTATUS NtCommitEnlistment ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 53: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCommitEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1041,11 +2523,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 54 NTSTATUS NtCommitTransaction ['HANDLE TransactionHandle', 'BOOLEAN Wait']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCommitTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCommitTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1054,11 +2538,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 55 NTSTATUS NtCompactKeys ['ULONG Count', 'HANDLE KeyArray[]']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompactKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1067,12 +2553,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 56 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', 'HANDLE SecondTokenHandle', 'PBOOLEAN Equal']
 	case 56: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompareTokens_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1082,10 +2571,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 57 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -1093,10 +2583,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 58 NTSTATUS NtCompressKey ['HANDLE Key']
 	case 58: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompressKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtCompressKey_enter, cpu, pc, arg0);
@@ -1104,17 +2595,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 59 NTSTATUS NtConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 59: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1129,11 +2628,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 60 NTSTATUS NtContinue ['PCONTEXT ContextRecord', 'BOOLEAN TestAlert']
 	case 60: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtContinue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1142,13 +2643,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 61 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Flags']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDebugObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1159,12 +2664,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 62 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1174,17 +2682,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 63 NTSTATUS NtCreateEnlistment ['PHANDLE EnlistmentHandle', 'ACCESS_MASK DesiredAccess', 'HANDLE ResourceManagerHandle', 'HANDLE TransactionHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG CreateOptions', 'NOTIFICATION_MASK NotificationMask', 'PVOID EnlistmentKey']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1199,14 +2715,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 64 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'EVENT_TYPE EventType', 'BOOLEAN InitialState']
 	case 64: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1218,12 +2739,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 65 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 65: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1233,20 +2757,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 66 NTSTATUS NtCreateFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER AllocationSize', 'ULONG FileAttributes', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'PVOID EaBuffer', 'ULONG EaLength']
 	case 66: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1264,13 +2799,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 67 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Count']
 	case 67: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1281,12 +2820,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 68 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 68: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1296,12 +2838,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 69 NTSTATUS NtCreateJobSet ['ULONG NumJob', 'PJOB_SET_ARRAY UserJobSet', 'ULONG Flags']
 	case 69: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobSet_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1311,16 +2856,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 70 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG TitleIndex', 'PUNICODE_STRING Class', 'ULONG CreateOptions', 'PULONG Disposition']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1334,13 +2886,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 71 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Flags']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1351,17 +2907,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 72 NTSTATUS NtCreateKeyTransacted ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG TitleIndex', 'PUNICODE_STRING Class', 'ULONG CreateOptions', 'HANDLE TransactionHandle', 'PULONG Disposition']
 	case 72: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKeyTransacted_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKeyTransacted_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1376,17 +2940,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 73 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CreateOptions', 'ULONG MailslotQuota', 'ULONG MaximumMessageSize', 'PLARGE_INTEGER ReadTimeout']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1401,13 +2973,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 74 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN InitialOwner']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1418,23 +2994,37 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 75 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'ULONG NamedPipeType', 'ULONG ReadMode', 'ULONG CompletionMode', 'ULONG MaximumInstances', 'ULONG InboundQuota', 'ULONG OutboundQuota', 'PLARGE_INTEGER DefaultTimeout']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1455,13 +3045,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 76 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', 'PLARGE_INTEGER MinimumSize', 'PLARGE_INTEGER MaximumSize', 'ULONG Priority']
 	case 76: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1472,14 +3066,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 77 NTSTATUS NtCreatePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 77: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1491,13 +3090,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 78 NTSTATUS NtCreatePrivateNamespace ['PHANDLE NamespaceHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PVOID BoundaryDescriptor']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePrivateNamespace_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePrivateNamespace_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1508,17 +3111,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 79 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'BOOLEAN InheritObjectTable', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1533,18 +3144,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 80 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'ULONG Flags', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort', 'ULONG JobMemberLevel']
 	case 80: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcessEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1560,18 +3180,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 81 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', 'HANDLE Process', 'PVOID RangeBase', 'SIZE_T RangeSize', 'ULONG BucketSize', 'PULONG Buffer', 'ULONG BufferSize', 'KPROFILE_SOURCE ProfileSource', 'KAFFINITY Affinity']
 	case 81: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1587,19 +3216,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 82 NTSTATUS NtCreateProfileEx ['PHANDLE ProfileHandle', 'HANDLE Process', 'PVOID ProfileBase', 'SIZE_T ProfileSize', 'ULONG BucketSize', 'PULONG Buffer', 'ULONG BufferSize', 'KPROFILE_SOURCE ProfileSource', 'ULONG GroupAffinityCount', 'PGROUP_AFFINITY GroupAffinity']
 	case 82: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProfileEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfileEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1616,16 +3255,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 83 NTSTATUS NtCreateResourceManager ['PHANDLE ResourceManagerHandle', 'ACCESS_MASK DesiredAccess', 'HANDLE TmHandle', 'LPGUID RmGuid', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG CreateOptions', 'PUNICODE_STRING Description']
 	case 83: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1639,16 +3285,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 84 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PLARGE_INTEGER MaximumSize', 'ULONG SectionPageProtection', 'ULONG AllocationAttributes', 'HANDLE FileHandle']
 	case 84: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1662,14 +3315,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 85 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LONG InitialCount', 'LONG MaximumCount']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1681,13 +3339,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 86 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LinkTarget']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1698,17 +3360,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 87 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ProcessHandle', 'PCLIENT_ID ClientId', 'PCONTEXT ThreadContext', 'PINITIAL_TEB InitialTeb', 'BOOLEAN CreateSuspended']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1723,20 +3393,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 88 NTSTATUS NtCreateThreadEx ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ProcessHandle', 'PVOID StartRoutine', 'PVOID Argument', 'ULONG CreateFlags', 'ULONG_PTR ZeroBits', 'SIZE_T StackSize', 'SIZE_T MaximumStackSize', 'PPS_ATTRIBUTE_LIST AttributeList']
 	case 88: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtCreateThreadEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThreadEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1754,13 +3435,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 89 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TIMER_TYPE TimerType']
 	case 89: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1771,22 +3456,35 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 90 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TOKEN_TYPE TokenType', 'PLUID AuthenticationId', 'PLARGE_INTEGER ExpirationTime', 'PTOKEN_USER User', 'PTOKEN_GROUPS Groups', 'PTOKEN_PRIVILEGES Privileges', 'PTOKEN_OWNER Owner', 'PTOKEN_PRIMARY_GROUP PrimaryGroup', 'PTOKEN_DEFAULT_DACL DefaultDacl', 'PTOKEN_SOURCE TokenSource']
 	case 90: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1806,19 +3504,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 91 NTSTATUS NtCreateTransaction ['PHANDLE TransactionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LPGUID Uow', 'HANDLE TmHandle', 'ULONG CreateOptions', 'ULONG IsolationLevel', 'ULONG IsolationFlags', 'PLARGE_INTEGER Timeout', 'PUNICODE_STRING Description']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtCreateTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1835,15 +3543,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 92 NTSTATUS NtCreateTransactionManager ['PHANDLE TmHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LogFileName', 'ULONG CreateOptions', 'ULONG CommitStrength']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtCreateTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1856,20 +3570,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 93 NTSTATUS NtCreateUserProcess ['PHANDLE ProcessHandle', 'PHANDLE ThreadHandle', 'ACCESS_MASK ProcessDesiredAccess', 'ACCESS_MASK ThreadDesiredAccess', 'POBJECT_ATTRIBUTES ProcessObjectAttributes', 'POBJECT_ATTRIBUTES ThreadObjectAttributes', 'ULONG ProcessFlags', 'ULONG ThreadFlags', 'PRTL_USER_PROCESS_PARAMETERS ProcessParameters', 'PPROCESS_CREATE_INFO CreateInfo', 'PPROCESS_ATTRIBUTE_LIST AttributeList']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtCreateUserProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateUserProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1887,14 +3612,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 94 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1906,19 +3636,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 95 NTSTATUS NtCreateWorkerFactory ['PHANDLE WorkerFactoryHandleReturn', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE CompletionPortHandle', 'HANDLE WorkerProcessHandle', 'PVOID StartRoutine', 'PVOID StartParameter', 'ULONG MaxThreadCount', 'SIZE_T StackReserve', 'SIZE_T StackCommit']
 	case 95: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtCreateWorkerFactory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWorkerFactory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1935,11 +3675,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 96 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', 'HANDLE DebugObjectHandle']
 	case 96: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugActiveProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1948,12 +3690,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 97 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', 'PCLIENT_ID ClientId', 'NTSTATUS ContinueStatus']
 	case 97: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugContinue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1963,11 +3708,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 98 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', 'PLARGE_INTEGER DelayInterval']
 	case 98: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1976,10 +3723,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 99 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1987,10 +3735,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 100 NTSTATUS NtDeleteBootEntry ['ULONG Id']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteBootEntry_enter, cpu, pc, arg0);
@@ -1998,10 +3747,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 101 NTSTATUS NtDeleteDriverEntry ['ULONG Id']
 	case 101: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteDriverEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteDriverEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteDriverEntry_enter, cpu, pc, arg0);
@@ -2009,10 +3759,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 102 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 	case 102: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -2020,10 +3771,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 103 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 	case 103: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -2031,12 +3783,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 104 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 104: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2046,10 +3801,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 105 NTSTATUS NtDeletePrivateNamespace ['HANDLE NamespaceHandle']
 	case 105: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeletePrivateNamespace_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeletePrivateNamespace_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeletePrivateNamespace_enter, cpu, pc, arg0);
@@ -2057,11 +3813,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 106 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2070,19 +3828,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 107 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2104,10 +3872,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 109 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 	case 109: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDisplayString_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -2115,10 +3884,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 110 NTSTATUS NtDrawText ['PUNICODE_STRING Text']
 	case 110: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDrawText_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDrawText_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDrawText_enter, cpu, pc, arg0);
@@ -2126,16 +3896,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 111 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', 'HANDLE SourceHandle', 'HANDLE TargetProcessHandle', 'PHANDLE TargetHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Options']
 	case 111: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2149,15 +3926,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 112 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN EffectiveOnly', 'TOKEN_TYPE TokenType', 'PHANDLE NewTokenHandle']
 	case 112: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2175,11 +3958,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 114 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', 'PULONG BufferLength']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateBootEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2188,11 +3973,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 115 NTSTATUS NtEnumerateDriverEntries ['PVOID Buffer', 'PULONG BufferLength']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateDriverEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateDriverEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2201,15 +3988,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 116 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2222,12 +4015,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 117 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', 'PVOID Buffer', 'PULONG BufferLength']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2237,14 +4033,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 118 NTSTATUS NtEnumerateTransactionObject ['HANDLE RootObjectHandle', 'KTMOBJECT_TYPE QueryType', 'PKTMOBJECT_CURSOR ObjectCursor', 'ULONG ObjectCursorLength', 'PULONG ReturnLength']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateTransactionObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateTransactionObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2256,15 +4057,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 119 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 119: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2277,11 +4084,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 120 NTSTATUS NtExtendSection ['HANDLE SectionHandle', 'PLARGE_INTEGER NewSectionSize']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtExtendSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2290,15 +4099,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 121 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', 'ULONG Flags', 'PTOKEN_GROUPS SidsToDisable', 'PTOKEN_PRIVILEGES PrivilegesToDelete', 'PTOKEN_GROUPS RestrictedSids', 'PHANDLE NewTokenHandle']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFilterToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2311,12 +4126,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 122 NTSTATUS NtFindAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFindAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2326,11 +4144,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 123 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 123: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2339,11 +4159,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 124 NTSTATUS NtFlushInstallUILanguage ['LANGID InstallUILanguage', 'ULONG SetComittedFlag']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtFlushInstallUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstallUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2352,12 +4174,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 125 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T Length']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2367,10 +4192,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 126 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 	case 126: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -2383,13 +4209,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 128 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'PIO_STATUS_BLOCK IoStatus']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2405,12 +4235,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 130 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 130: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2420,13 +4253,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 131 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG FreeType']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2437,10 +4274,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 132 NTSTATUS NtFreezeRegistry ['ULONG TimeOutInSeconds']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtFreezeRegistry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreezeRegistry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtFreezeRegistry_enter, cpu, pc, arg0);
@@ -2448,11 +4286,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 133 NTSTATUS NtFreezeTransactions ['PLARGE_INTEGER FreezeTimeout', 'PLARGE_INTEGER ThawTimeout']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtFreezeTransactions_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreezeTransactions_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2461,19 +4301,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 134 NTSTATUS NtFsControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 134: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2490,11 +4340,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 135 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 135: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2508,11 +4360,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 137 NTSTATUS NtGetDevicePowerState ['HANDLE Device', 'DEVICE_POWER_STATE *State']
 	case 137: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2521,12 +4375,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 138 NTSTATUS NtGetMUIRegistryInfo ['ULONG Flags', 'PULONG DataSize', 'PVOID Data']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtGetMUIRegistryInfo_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetMUIRegistryInfo_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2536,14 +4393,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 139 NTSTATUS NtGetNextProcess ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Flags', 'PHANDLE NewProcessHandle']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtGetNextProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNextProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2555,15 +4417,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 140 NTSTATUS NtGetNextThread ['HANDLE ProcessHandle', 'HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Flags', 'PHANDLE NewThreadHandle']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtGetNextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2576,14 +4444,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 141 NTSTATUS NtGetNlsSectionPtr ['ULONG SectionType', 'ULONG SectionData', 'PVOID ContextData', 'PVOID *SectionPointer', 'PULONG SectionSize']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtGetNlsSectionPtr_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNlsSectionPtr_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2595,16 +4468,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 142 NTSTATUS NtGetNotificationResourceManager ['HANDLE ResourceManagerHandle', 'PTRANSACTION_NOTIFICATION TransactionNotification', 'ULONG NotificationLength', 'PLARGE_INTEGER Timeout', 'PULONG ReturnLength', 'ULONG Asynchronous', 'ULONG_PTR AsynchronousContext']
 	case 142: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtGetNotificationResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetNotificationResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2618,13 +4498,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 143 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', 'PVOID Context', 'PPLUGPLAY_EVENT_BLOCK EventBlock', 'ULONG EventBufferSize']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2635,16 +4519,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 144 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', 'ULONG Flags', 'PVOID BaseAddress', 'SIZE_T RegionSize', 'PVOID *UserAddressArray', 'PULONG_PTR EntriesInUserAddressArray', 'PULONG Granularity']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2658,10 +4549,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 145 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -2669,11 +4561,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 146 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', 'PPORT_MESSAGE Message']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2682,12 +4576,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 147 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', 'HANDLE ClientThreadHandle', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2697,12 +4594,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 148 NTSTATUS NtInitializeNlsFiles ['PVOID *BaseAddress', 'PLCID DefaultLocaleId', 'PLARGE_INTEGER DefaultCasingTableSize']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtInitializeNlsFiles_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeNlsFiles_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2712,10 +4612,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 149 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -2723,13 +4624,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 150 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags', 'BOOLEAN Asynchronous']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2740,11 +4645,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 151 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', 'HANDLE JobHandle']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtIsProcessInJob_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2763,11 +4670,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 154 NTSTATUS NtListenPort ['HANDLE PortHandle', 'PPORT_MESSAGE ConnectionRequest']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtListenPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2776,10 +4685,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 155 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -2787,11 +4697,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 156 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2800,12 +4712,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 157 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile', 'ULONG Flags']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2815,13 +4730,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 158 NTSTATUS NtLoadKeyEx ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile', 'ULONG Flags', 'HANDLE TrustClassKey']
 	case 158: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2832,19 +4751,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 159 NTSTATUS NtLockFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key', 'BOOLEAN FailImmediately', 'BOOLEAN ExclusiveLock']
 	case 159: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2861,11 +4790,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 160 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', 'ULONG *pSafeMode']
 	case 160: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockProductActivationKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2874,10 +4805,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 161 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockRegistryKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtLockRegistryKey_enter, cpu, pc, arg0);
@@ -2885,13 +4817,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 162 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2902,10 +4838,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 163 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakePermanentObject_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtMakePermanentObject_enter, cpu, pc, arg0);
@@ -2913,10 +4850,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 164 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -2924,15 +4862,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 165 NTSTATUS NtMapCMFModule ['ULONG What', 'ULONG Index', 'PULONG CacheIndexOut', 'PULONG CacheFlagsOut', 'PULONG ViewSizeOut', 'PVOID *BaseAddress']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtMapCMFModule_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapCMFModule_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2945,12 +4889,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 166 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 166: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2960,12 +4907,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 167 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 167: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2975,19 +4925,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 168 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', 'HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'SIZE_T CommitSize', 'PLARGE_INTEGER SectionOffset', 'PSIZE_T ViewSize', 'SECTION_INHERIT InheritDisposition', 'ULONG AllocationType', 'WIN32_PROTECTION_MASK Win32Protect']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3004,10 +4964,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 169 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 	case 169: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtModifyBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtModifyBootEntry_enter, cpu, pc, arg0);
@@ -3015,10 +4976,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 170 NTSTATUS NtModifyDriverEntry ['PEFI_DRIVER_ENTRY DriverEntry']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtModifyDriverEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtModifyDriverEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtModifyDriverEntry_enter, cpu, pc, arg0);
@@ -3026,18 +4988,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 171 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'ULONG CompletionFilter', 'BOOLEAN WatchTree']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3053,19 +5024,29 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 172 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 172: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3082,21 +5063,33 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 173 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', 'ULONG Count', 'OBJECT_ATTRIBUTES SlaveObjects[]', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 173: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3115,17 +5108,25 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 174 NTSTATUS NtNotifyChangeSession ['HANDLE Session', 'ULONG IoStateSequence', 'PVOID Reserved', 'ULONG Action', 'IO_SESSION_STATE IoState', 'IO_SESSION_STATE IoState2', 'PVOID Buffer', 'ULONG BufferSize']
 	case 174: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeSession_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeSession_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3140,12 +5141,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 175 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 175: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3155,14 +5159,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 176 NTSTATUS NtOpenEnlistment ['PHANDLE EnlistmentHandle', 'ACCESS_MASK DesiredAccess', 'HANDLE ResourceManagerHandle', 'LPGUID EnlistmentGuid', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3174,12 +5183,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 177 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 177: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3189,12 +5201,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 178 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 178: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3204,15 +5219,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 179 NTSTATUS NtOpenFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG OpenOptions']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3225,12 +5246,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 180 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3240,12 +5264,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 181 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3255,12 +5282,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 182 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3270,13 +5300,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 183 NTSTATUS NtOpenKeyEx ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG OpenOptions']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3287,12 +5321,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 184 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3302,13 +5339,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 185 NTSTATUS NtOpenKeyTransacted ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE TransactionHandle']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKeyTransacted_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyTransacted_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3319,14 +5360,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 186 NTSTATUS NtOpenKeyTransactedEx ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG OpenOptions', 'HANDLE TransactionHandle']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKeyTransactedEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyTransactedEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3338,12 +5384,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 187 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 187: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3353,21 +5402,33 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 188 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'ACCESS_MASK GrantedAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN ObjectCreation', 'BOOLEAN AccessGranted', 'PBOOLEAN GenerateOnClose']
 	case 188: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3386,13 +5447,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 189 NTSTATUS NtOpenPrivateNamespace ['PHANDLE NamespaceHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PVOID BoundaryDescriptor']
 	case 189: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenPrivateNamespace_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenPrivateNamespace_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3403,13 +5468,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 190 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 190: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3420,12 +5489,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 191 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'PHANDLE TokenHandle']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3435,13 +5507,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 192 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'PHANDLE TokenHandle']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3452,14 +5528,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 193 NTSTATUS NtOpenResourceManager ['PHANDLE ResourceManagerHandle', 'ACCESS_MASK DesiredAccess', 'HANDLE TmHandle', 'LPGUID ResourceManagerGuid', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3471,12 +5552,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 194 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3486,12 +5570,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 195 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3501,12 +5588,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 196 NTSTATUS NtOpenSession ['PHANDLE SessionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSession_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSession_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3516,12 +5606,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 197 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3531,13 +5624,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 198 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 198: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3548,13 +5645,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 199 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'PHANDLE TokenHandle']
 	case 199: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3565,14 +5666,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 200 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'ULONG HandleAttributes', 'PHANDLE TokenHandle']
 	case 200: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3584,12 +5690,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 201 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 201: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3599,14 +5708,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 202 NTSTATUS NtOpenTransaction ['PHANDLE TransactionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LPGUID Uow', 'HANDLE TmHandle']
 	case 202: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3618,15 +5732,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 203 NTSTATUS NtOpenTransactionManager ['PHANDLE TmHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LogFileName', 'LPGUID TmIdentity', 'ULONG OpenOptions']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtOpenTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3639,12 +5759,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 204 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', 'PVOID PnPControlData', 'ULONG PnPControlDataLength']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3654,14 +5777,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 205 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 205: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3673,11 +5801,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 206 NTSTATUS NtPrepareComplete ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 206: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPrepareComplete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrepareComplete_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3686,11 +5816,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 207 NTSTATUS NtPrepareEnlistment ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPrepareEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrepareEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3699,11 +5831,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 208 NTSTATUS NtPrePrepareComplete ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPrePrepareComplete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrePrepareComplete_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3712,11 +5846,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 209 NTSTATUS NtPrePrepareEnlistment ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPrePrepareEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrePrepareEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3725,12 +5861,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 210 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', 'PPRIVILEGE_SET RequiredPrivileges', 'PBOOLEAN Result']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3740,14 +5879,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 211 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', 'PUNICODE_STRING ServiceName', 'HANDLE ClientToken', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3759,15 +5903,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 212 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3780,13 +5930,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 213 NTSTATUS NtPropagationComplete ['HANDLE ResourceManagerHandle', 'ULONG RequestCookie', 'ULONG BufferLength', 'PVOID Buffer']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtPropagationComplete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPropagationComplete_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3797,12 +5951,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 214 NTSTATUS NtPropagationFailed ['HANDLE ResourceManagerHandle', 'ULONG RequestCookie', 'NTSTATUS PropStatus']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPropagationFailed_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPropagationFailed_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3812,14 +5969,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 215 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'WIN32_PROTECTION_MASK NewProtectWin32', 'PULONG OldProtect']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3831,11 +5993,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 216 NTSTATUS NtPulseEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3844,11 +6008,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 217 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_BASIC_INFORMATION FileInformation']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3857,11 +6023,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 218 NTSTATUS NtQueryBootEntryOrder ['PULONG Ids', 'PULONG Count']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3870,11 +6038,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 219 NTSTATUS NtQueryBootOptions ['PBOOT_OPTIONS BootOptions', 'PULONG BootOptionsLength']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootOptions_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3883,11 +6053,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 220 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', 'ULONG Level']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDebugFilterState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3896,11 +6068,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 221 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', 'PLCID DefaultLocaleId']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3909,10 +6083,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 222 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 	case 222: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3920,20 +6095,31 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 223 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass', 'BOOLEAN ReturnSingleEntry', 'PUNICODE_STRING FileName', 'BOOLEAN RestartScan']
 	case 223: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3951,16 +6137,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 224 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'BOOLEAN RestartScan', 'PULONG Context', 'PULONG ReturnLength']
 	case 224: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3974,11 +6167,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 225 NTSTATUS NtQueryDriverEntryOrder ['PULONG Ids', 'PULONG Count']
 	case 225: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDriverEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDriverEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3987,18 +6182,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 226 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID EaList', 'ULONG EaListLength', 'PULONG EaIndex', 'BOOLEAN RestartScan']
 	case 226: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4014,14 +6218,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 227 NTSTATUS NtQueryEvent ['HANDLE EventHandle', 'EVENT_INFORMATION_CLASS EventInformationClass', 'PVOID EventInformation', 'ULONG EventInformationLength', 'PULONG ReturnLength']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4033,11 +6242,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 228 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 	case 228: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4046,14 +6257,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 229 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', 'ATOM_INFORMATION_CLASS InformationClass', 'PVOID AtomInformation', 'ULONG AtomInformationLength', 'PULONG ReturnLength']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4065,14 +6281,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 230 NTSTATUS NtQueryInformationEnlistment ['HANDLE EnlistmentHandle', 'ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', 'PVOID EnlistmentInformation', 'ULONG EnlistmentInformationLength', 'PULONG ReturnLength']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4084,14 +6305,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 231 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 231: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4103,14 +6329,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 232 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength', 'PULONG ReturnLength']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4122,14 +6353,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 233 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', 'PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4141,14 +6377,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 234 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength', 'PULONG ReturnLength']
 	case 234: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4160,14 +6401,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 235 NTSTATUS NtQueryInformationResourceManager ['HANDLE ResourceManagerHandle', 'RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', 'PVOID ResourceManagerInformation', 'ULONG ResourceManagerInformationLength', 'PULONG ReturnLength']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4179,14 +6425,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 236 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength', 'PULONG ReturnLength']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4198,14 +6449,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 237 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength', 'PULONG ReturnLength']
 	case 237: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4217,14 +6473,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 238 NTSTATUS NtQueryInformationTransaction ['HANDLE TransactionHandle', 'TRANSACTION_INFORMATION_CLASS TransactionInformationClass', 'PVOID TransactionInformation', 'ULONG TransactionInformationLength', 'PULONG ReturnLength']
 	case 238: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4236,14 +6497,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 239 NTSTATUS NtQueryInformationTransactionManager ['HANDLE TransactionManagerHandle', 'TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', 'PVOID TransactionManagerInformation', 'ULONG TransactionManagerInformationLength', 'PULONG ReturnLength']
 	case 239: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4255,14 +6521,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 240 NTSTATUS NtQueryInformationWorkerFactory ['HANDLE WorkerFactoryHandle', 'WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', 'PVOID WorkerFactoryInformation', 'ULONG WorkerFactoryInformationLength', 'PULONG ReturnLength']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationWorkerFactory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4274,10 +6545,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 241 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 	case 241: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -4285,11 +6557,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 242 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', 'PULONG Interval']
 	case 242: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4298,14 +6572,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 243 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', 'IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', 'PVOID IoCompletionInformation', 'ULONG IoCompletionInformationLength', 'PULONG ReturnLength']
 	case 243: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4317,14 +6596,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 244 NTSTATUS NtQueryKey ['HANDLE KeyHandle', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 244: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4336,14 +6620,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 245 NTSTATUS NtQueryLicenseValue ['PUNICODE_STRING Name', 'PULONG Type', 'PVOID Buffer', 'ULONG Length', 'PULONG ReturnedLength']
 	case 245: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryLicenseValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryLicenseValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4355,15 +6644,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 246 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', 'PKEY_VALUE_ENTRY ValueEntries', 'ULONG EntryCount', 'PVOID ValueBuffer', 'PULONG BufferLength', 'PULONG RequiredBufferLength']
 	case 246: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4376,14 +6671,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 247 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', 'MUTANT_INFORMATION_CLASS MutantInformationClass', 'PVOID MutantInformation', 'ULONG MutantInformationLength', 'PULONG ReturnLength']
 	case 247: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4395,14 +6695,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 248 NTSTATUS NtQueryObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength', 'PULONG ReturnLength']
 	case 248: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4414,11 +6719,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 249 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', 'PULONG HandleCount']
 	case 249: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4427,13 +6734,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 250 NTSTATUS NtQueryOpenSubKeysEx ['POBJECT_ATTRIBUTES TargetKey', 'ULONG BufferLength', 'PVOID Buffer', 'PULONG RequiredSize']
 	case 250: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeysEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4444,11 +6755,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 251 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', 'PLARGE_INTEGER PerformanceFrequency']
 	case 251: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4462,18 +6775,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 253 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID SidList', 'ULONG SidListLength', 'PULONG StartSid', 'BOOLEAN RestartScan']
 	case 253: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4489,14 +6811,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 254 NTSTATUS NtQuerySection ['HANDLE SectionHandle', 'SECTION_INFORMATION_CLASS SectionInformationClass', 'PVOID SectionInformation', 'SIZE_T SectionInformationLength', 'PSIZE_T ReturnLength']
 	case 254: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4508,15 +6835,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 255 NTSTATUS NtQuerySecurityAttributesToken ['HANDLE TokenHandle', 'PUNICODE_STRING Attributes', 'ULONG NumberOfAttributes', 'PVOID Buffer', 'ULONG Length', 'PULONG ReturnLength']
 	case 255: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityAttributesToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4529,14 +6862,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 256 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ULONG Length', 'PULONG LengthNeeded']
 	case 256: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4548,14 +6886,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 257 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', 'SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', 'PVOID SemaphoreInformation', 'ULONG SemaphoreInformationLength', 'PULONG ReturnLength']
 	case 257: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4567,12 +6910,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 258 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', 'PUNICODE_STRING LinkTarget', 'PULONG ReturnedLength']
 	case 258: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4582,13 +6928,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 259 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PWSTR VariableValue', 'USHORT ValueLength', 'PUSHORT ReturnLength']
 	case 259: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4599,14 +6949,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 260 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', 'LPGUID VendorGuid', 'PVOID Value', 'PULONG ValueLength', 'PULONG Attributes']
 	case 260: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4618,13 +6973,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 261 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength', 'PULONG ReturnLength']
 	case 261: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4635,15 +6994,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 262 NTSTATUS NtQuerySystemInformationEx ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID QueryInformation', 'ULONG QueryInformationLength', 'PVOID SystemInformation', 'ULONG SystemInformationLength', 'PULONG ReturnLength']
 	case 262: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemInformationEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformationEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4656,10 +7021,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 263 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 	case 263: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -4667,14 +7033,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 264 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', 'TIMER_INFORMATION_CLASS TimerInformationClass', 'PVOID TimerInformation', 'ULONG TimerInformationLength', 'PULONG ReturnLength']
 	case 264: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4686,12 +7057,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 265 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', 'PULONG MinimumTime', 'PULONG CurrentTime']
 	case 265: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4701,15 +7075,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 266 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 266: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4722,15 +7102,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 267 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'MEMORY_INFORMATION_CLASS MemoryInformationClass', 'PVOID MemoryInformation', 'SIZE_T MemoryInformationLength', 'PSIZE_T ReturnLength']
 	case 267: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4743,14 +7129,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 268 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 268: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4762,14 +7153,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 269 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', 'PPS_APC_ROUTINE ApcRoutine', 'PVOID ApcArgument1', 'PVOID ApcArgument2', 'PVOID ApcArgument3']
 	case 269: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4781,15 +7177,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 270 NTSTATUS NtQueueApcThreadEx ['HANDLE ThreadHandle', 'HANDLE UserApcReserveHandle', 'PPS_APC_ROUTINE ApcRoutine', 'PVOID ApcArgument1', 'PVOID ApcArgument2', 'PVOID ApcArgument3']
 	case 270: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueueApcThreadEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThreadEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4802,12 +7204,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 271 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', 'PCONTEXT ContextRecord', 'BOOLEAN FirstChance']
 	case 271: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseException_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4817,15 +7222,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 272 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', 'ULONG NumberOfParameters', 'ULONG UnicodeStringParameterMask', 'PULONG_PTR Parameters', 'ULONG ValidResponseOptions', 'PULONG Response']
 	case 272: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4838,18 +7249,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 273 NTSTATUS NtReadFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 273: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4865,18 +7285,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 274 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 274: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4892,11 +7321,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 275 NTSTATUS NtReadOnlyEnlistment ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 275: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReadOnlyEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadOnlyEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4905,15 +7336,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 276 NTSTATUS NtReadRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 276: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4926,14 +7363,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 277 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 277: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4945,11 +7387,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 278 NTSTATUS NtRecoverEnlistment ['HANDLE EnlistmentHandle', 'PVOID EnlistmentKey']
 	case 278: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRecoverEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4958,10 +7402,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 279 NTSTATUS NtRecoverResourceManager ['HANDLE ResourceManagerHandle']
 	case 279: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtRecoverResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtRecoverResourceManager_enter, cpu, pc, arg0);
@@ -4969,10 +7414,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 280 NTSTATUS NtRecoverTransactionManager ['HANDLE TransactionManagerHandle']
 	case 280: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtRecoverTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRecoverTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtRecoverTransactionManager_enter, cpu, pc, arg0);
@@ -4980,14 +7426,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 281 NTSTATUS NtRegisterProtocolAddressInformation ['HANDLE ResourceManager', 'PCRM_PROTOCOL_ID ProtocolId', 'ULONG ProtocolInformationSize', 'PVOID ProtocolInformation', 'ULONG CreateOptions']
 	case 281: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterProtocolAddressInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4999,10 +7450,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 282 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 	case 282: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -5010,13 +7462,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 283 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', 'PVOID KeyValue', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 283: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5027,11 +7483,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 284 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', 'PLONG PreviousCount']
 	case 284: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5040,12 +7498,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 285 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', 'LONG ReleaseCount', 'PLONG PreviousCount']
 	case 285: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5055,10 +7516,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 286 NTSTATUS NtReleaseWorkerFactoryWorker ['HANDLE WorkerFactoryHandle']
 	case 286: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseWorkerFactoryWorker_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtReleaseWorkerFactoryWorker_enter, cpu, pc, arg0);
@@ -5066,14 +7528,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 287 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', 'PVOID *KeyContext', 'PVOID *ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER Timeout']
 	case 287: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5085,15 +7552,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 288 NTSTATUS NtRemoveIoCompletionEx ['HANDLE IoCompletionHandle', 'PFILE_IO_COMPLETION_INFORMATION IoCompletionInformation', 'ULONG Count', 'PULONG NumEntriesRemoved', 'PLARGE_INTEGER Timeout', 'BOOLEAN Alertable']
 	case 288: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveIoCompletionEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletionEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5106,11 +7579,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 289 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', 'HANDLE DebugObjectHandle']
 	case 289: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveProcessDebug_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5119,11 +7594,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 290 NTSTATUS NtRenameKey ['HANDLE KeyHandle', 'PUNICODE_STRING NewName']
 	case 290: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRenameKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5132,11 +7609,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 291 NTSTATUS NtRenameTransactionManager ['PUNICODE_STRING LogFileName', 'LPGUID ExistingTransactionManagerGuid']
 	case 291: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRenameTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRenameTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5145,12 +7624,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 292 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', 'HANDLE TargetHandle', 'POBJECT_ATTRIBUTES OldFile']
 	case 292: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5160,12 +7642,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 293 NTSTATUS NtReplacePartitionUnit ['PUNICODE_STRING TargetInstancePath', 'PUNICODE_STRING SpareInstancePath', 'ULONG Flags']
 	case 293: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReplacePartitionUnit_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplacePartitionUnit_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5175,11 +7660,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 294 NTSTATUS NtReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 294: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5188,13 +7675,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 295 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage']
 	case 295: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5205,14 +7696,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 296 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage', 'PLARGE_INTEGER Timeout']
 	case 296: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5224,11 +7720,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 297 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 297: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5237,11 +7735,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 298 NTSTATUS NtRequestPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage']
 	case 298: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5250,12 +7750,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 299 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage', 'PPORT_MESSAGE ReplyMessage']
 	case 299: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5265,11 +7768,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 300 NTSTATUS NtResetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 300: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5278,12 +7783,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 301 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T RegionSize']
 	case 301: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5293,12 +7801,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 302 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Flags']
 	case 302: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5308,10 +7819,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 303 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 	case 303: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeProcess_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtResumeProcess_enter, cpu, pc, arg0);
@@ -5319,11 +7831,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 304 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 304: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5332,11 +7846,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 305 NTSTATUS NtRollbackComplete ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 305: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRollbackComplete_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackComplete_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5345,11 +7861,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 306 NTSTATUS NtRollbackEnlistment ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 306: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRollbackEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5358,11 +7876,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 307 NTSTATUS NtRollbackTransaction ['HANDLE TransactionHandle', 'BOOLEAN Wait']
 	case 307: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRollbackTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollbackTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5371,11 +7891,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 308 NTSTATUS NtRollforwardTransactionManager ['HANDLE TransactionManagerHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 308: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRollforwardTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRollforwardTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5384,11 +7906,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 309 NTSTATUS NtSaveKey ['HANDLE KeyHandle', 'HANDLE FileHandle']
 	case 309: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5397,12 +7921,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 310 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Format']
 	case 310: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5412,12 +7939,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 311 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', 'HANDLE LowPrecedenceKeyHandle', 'HANDLE FileHandle']
 	case 311: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5427,18 +7957,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 312 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PSID RequiredServerSid', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 312: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5459,11 +7998,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 314 NTSTATUS NtSetBootEntryOrder ['PULONG Ids', 'ULONG Count']
 	case 314: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5472,11 +8013,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 315 NTSTATUS NtSetBootOptions ['PBOOT_OPTIONS BootOptions', 'ULONG FieldsToChange']
 	case 315: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootOptions_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5485,11 +8028,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 316 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 316: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5498,12 +8043,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 317 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', 'ULONG Level', 'BOOLEAN State']
 	case 317: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDebugFilterState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5513,10 +8061,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 318 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 	case 318: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -5524,11 +8073,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 319 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', 'LCID DefaultLocaleId']
 	case 319: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5537,10 +8088,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 320 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 	case 320: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -5548,11 +8100,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 321 NTSTATUS NtSetDriverEntryOrder ['PULONG Ids', 'ULONG Count']
 	case 321: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetDriverEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDriverEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5561,13 +8115,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 322 NTSTATUS NtSetEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 322: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5578,11 +8136,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 323 NTSTATUS NtSetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 323: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5591,10 +8151,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 324 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 	case 324: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEventBoostPriority_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetEventBoostPriority_enter, cpu, pc, arg0);
@@ -5602,10 +8163,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 325 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 	case 325: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -5613,10 +8175,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 326 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 	case 326: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -5624,14 +8187,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 327 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', 'DEBUGOBJECTINFOCLASS DebugObjectInformationClass', 'PVOID DebugInformation', 'ULONG DebugInformationLength', 'PULONG ReturnLength']
 	case 327: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationDebugObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5643,13 +8211,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 328 NTSTATUS NtSetInformationEnlistment ['HANDLE EnlistmentHandle', 'ENLISTMENT_INFORMATION_CLASS EnlistmentInformationClass', 'PVOID EnlistmentInformation', 'ULONG EnlistmentInformationLength']
 	case 328: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationEnlistment_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationEnlistment_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5660,14 +8232,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 329 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 329: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5679,13 +8256,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 330 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength']
 	case 330: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5696,13 +8277,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 331 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', 'KEY_SET_INFORMATION_CLASS KeySetInformationClass', 'PVOID KeySetInformation', 'ULONG KeySetInformationLength']
 	case 331: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5713,13 +8298,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 332 NTSTATUS NtSetInformationObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength']
 	case 332: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5730,13 +8319,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 333 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength']
 	case 333: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5747,13 +8340,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 334 NTSTATUS NtSetInformationResourceManager ['HANDLE ResourceManagerHandle', 'RESOURCEMANAGER_INFORMATION_CLASS ResourceManagerInformationClass', 'PVOID ResourceManagerInformation', 'ULONG ResourceManagerInformationLength']
 	case 334: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationResourceManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationResourceManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5764,13 +8361,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 335 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength']
 	case 335: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5781,13 +8382,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 336 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength']
 	case 336: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5798,13 +8403,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 337 NTSTATUS NtSetInformationTransaction ['HANDLE TransactionHandle', 'TRANSACTION_INFORMATION_CLASS TransactionInformationClass', 'PVOID TransactionInformation', 'ULONG TransactionInformationLength']
 	case 337: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationTransaction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationTransaction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5815,13 +8424,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 338 NTSTATUS NtSetInformationTransactionManager ['HANDLE TmHandle', 'TRANSACTIONMANAGER_INFORMATION_CLASS TransactionManagerInformationClass', 'PVOID TransactionManagerInformation', 'ULONG TransactionManagerInformationLength']
 	case 338: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationTransactionManager_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationTransactionManager_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5832,13 +8445,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 339 NTSTATUS NtSetInformationWorkerFactory ['HANDLE WorkerFactoryHandle', 'WORKERFACTORYINFOCLASS WorkerFactoryInformationClass', 'PVOID WorkerFactoryInformation', 'ULONG WorkerFactoryInformationLength']
 	case 339: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationWorkerFactory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationWorkerFactory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5849,11 +8466,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 340 NTSTATUS NtSetIntervalProfile ['ULONG Interval', 'KPROFILE_SOURCE Source']
 	case 340: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5862,14 +8481,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 341 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', 'PVOID KeyContext', 'PVOID ApcContext', 'NTSTATUS IoStatus', 'ULONG_PTR IoStatusInformation']
 	case 341: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5881,15 +8505,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 342 NTSTATUS NtSetIoCompletionEx ['HANDLE IoCompletionHandle', 'HANDLE IoCompletionReserveHandle', 'PVOID KeyContext', 'PVOID ApcContext', 'NTSTATUS IoStatus', 'ULONG_PTR IoStatusInformation']
 	case 342: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetIoCompletionEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletionEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5902,15 +8532,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 343 NTSTATUS NtSetLdtEntries ['ULONG Selector0', 'ULONG Entry0Low', 'ULONG Entry0Hi', 'ULONG Selector1', 'ULONG Entry1Low', 'ULONG Entry1Hi']
 	case 343: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5923,10 +8559,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 344 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 	case 344: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -5934,10 +8571,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 345 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 	case 345: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -5945,13 +8583,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 346 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 346: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5962,12 +8604,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 347 NTSTATUS NtSetSecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor']
 	case 347: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -5977,11 +8622,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 348 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PUNICODE_STRING VariableValue']
 	case 348: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -5990,14 +8637,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 349 NTSTATUS NtSetSystemEnvironmentValueEx ['PUNICODE_STRING VariableName', 'LPGUID VendorGuid', 'PVOID Value', 'ULONG ValueLength', 'ULONG Attributes']
 	case 349: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6009,12 +8661,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 350 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength']
 	case 350: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6024,12 +8679,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 351 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags']
 	case 351: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6039,11 +8697,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 352 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', 'PLARGE_INTEGER PreviousTime']
 	case 352: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6052,11 +8712,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 353 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', 'PEXECUTION_STATE PreviousFlags']
 	case 353: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6065,16 +8727,23 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 354 NTSTATUS NtSetTimer ['HANDLE TimerHandle', 'PLARGE_INTEGER DueTime', 'PTIMER_APC_ROUTINE TimerApcRoutine', 'PVOID TimerContext', 'BOOLEAN WakeTimer', 'LONG Period', 'PBOOLEAN PreviousState']
 	case 354: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6088,13 +8757,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 355 NTSTATUS NtSetTimerEx ['HANDLE TimerHandle', 'TIMER_SET_INFORMATION_CLASS TimerSetInformationClass', 'PVOID TimerSetInformation', 'ULONG TimerSetInformationLength']
 	case 355: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimerEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6105,12 +8778,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 356 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', 'BOOLEAN SetResolution', 'PULONG ActualTime']
 	case 356: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6120,10 +8796,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 357 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 	case 357: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -6131,15 +8808,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 358 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'ULONG TitleIndex', 'ULONG Type', 'PVOID Data', 'ULONG DataSize']
 	case 358: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6152,14 +8835,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 359 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 359: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6171,10 +8859,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 360 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 	case 360: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -6182,11 +8871,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 361 NTSTATUS NtShutdownWorkerFactory ['HANDLE WorkerFactoryHandle', 'LONG *PendingWorkerCount']
 	case 361: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtShutdownWorkerFactory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownWorkerFactory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6195,13 +8886,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 362 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', 'HANDLE WaitHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 362: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6212,11 +8907,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 363 NTSTATUS NtSinglePhaseReject ['HANDLE EnlistmentHandle', 'PLARGE_INTEGER TmVirtualClock']
 	case 363: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSinglePhaseReject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSinglePhaseReject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6225,10 +8922,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 364 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 	case 364: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStartProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -6236,10 +8934,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 365 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 	case 365: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStopProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -6247,10 +8946,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 366 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 	case 366: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendProcess_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSuspendProcess_enter, cpu, pc, arg0);
@@ -6258,11 +8958,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 367 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 367: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6271,15 +8973,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 368 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength', 'PULONG ReturnLength']
 	case 368: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6292,11 +9000,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 369 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', 'NTSTATUS ExitStatus']
 	case 369: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6305,11 +9015,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 370 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', 'NTSTATUS ExitStatus']
 	case 370: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6318,11 +9030,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 371 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', 'NTSTATUS ExitStatus']
 	case 371: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6346,15 +9060,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 375 NTSTATUS NtTraceControl ['ULONG FunctionCode', 'PVOID InBuffer', 'ULONG InBufferLen', 'PVOID OutBuffer', 'ULONG OutBufferLen', 'PULONG ReturnLength']
 	case 375: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtTraceControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTraceControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6367,13 +9087,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 376 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', 'ULONG Flags', 'ULONG FieldSize', 'PVOID Fields']
 	case 376: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTraceEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6384,13 +9108,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 377 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', 'ULONG OutputType', 'PFILE_PATH OutputFilePath', 'PULONG OutputFilePathLength']
 	case 377: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTranslateFilePath_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6401,10 +9129,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 378 NTSTATUS NtUmsThreadYield ['PVOID SchedulerParam']
 	case 378: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUmsThreadYield_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUmsThreadYield_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUmsThreadYield_enter, cpu, pc, arg0);
@@ -6412,10 +9141,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 379 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 	case 379: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -6423,10 +9153,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 380 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 	case 380: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -6434,11 +9165,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 381 NTSTATUS NtUnloadKey2 ['POBJECT_ATTRIBUTES TargetKey', 'ULONG Flags']
 	case 381: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKey2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6447,11 +9180,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 382 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', 'HANDLE Event']
 	case 382: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6460,14 +9195,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 383 NTSTATUS NtUnlockFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key']
 	case 383: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6479,13 +9219,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 384 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 384: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6496,11 +9240,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 385 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', 'PVOID BaseAddress']
 	case 385: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6509,11 +9255,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 386 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', 'PVOID ServiceData']
 	case 386: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtVdmControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6522,13 +9270,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 387 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout', 'PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
 	case 387: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForDebugEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6539,13 +9291,17 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 388 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', 'PVOID KeyValue', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 388: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6556,14 +9312,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 389 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', 'HANDLE Handles[]', 'WAIT_TYPE WaitType', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 389: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6575,14 +9336,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 390 NTSTATUS NtWaitForMultipleObjects32 ['ULONG Count', 'LONG Handles[]', 'WAIT_TYPE WaitType', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 390: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForMultipleObjects32_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects32_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6594,12 +9360,15 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 391 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 391: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6609,11 +9378,13 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 392 NTSTATUS NtWaitForWorkViaWorkerFactory ['HANDLE WorkerFactoryHandle', 'PFILE_IO_COMPLETION_INFORMATION MiniPacket']
 	case 392: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForWorkViaWorkerFactory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -6622,10 +9393,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 393 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 	case 393: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -6633,10 +9405,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 394 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 	case 394: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -6644,10 +9417,11 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 395 NTSTATUS NtWorkerFactoryWorkerReady ['HANDLE WorkerFactoryHandle']
 	case 395: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWorkerFactoryWorkerReady_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWorkerFactoryWorkerReady_enter, cpu, pc, arg0);
@@ -6655,18 +9429,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 396 NTSTATUS NtWriteFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 396: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6682,18 +9465,27 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 397 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 397: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6709,15 +9501,21 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 398 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 398: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6730,14 +9528,19 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 	// 399 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 399: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -6758,7 +9561,7 @@ void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
@@ -13,21 +13,883 @@ extern "C" {
 #include "syscall_ppp_extern_return.h"
 }
 
+/**
+ * @brief Fills in the subscription flags of each system call, based on
+ * the callbacks currently registered. Flags in `all` apply to every system
+ * call, flags in `unknown` to numbers without a prototype.
+ */
+void syscall_subscriptions_windows_xpsp2_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown) {
+#ifdef TARGET_I386
+	subs.assign(283 + 1, unknown);
+	subs[0] = all |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAcceptConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[1] = all |
+		(PPP_CHECK_CB(on_NtAccessCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[2] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[3] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByType_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[4] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[5] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[6] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[7] = all |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[8] = all |
+		(PPP_CHECK_CB(on_NtAddAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[9] = all |
+		(PPP_CHECK_CB(on_NtAddBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAddBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[10] = all |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustGroupsToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[11] = all |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[12] = all |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[13] = all |
+		(PPP_CHECK_CB(on_NtAlertThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAlertThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[14] = all |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[15] = all |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[16] = all |
+		(PPP_CHECK_CB(on_NtAllocateUuids_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateUuids_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[17] = all |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAllocateVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[18] = all |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[19] = all |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtAssignProcessToJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[20] = all |
+		(PPP_CHECK_CB(on_NtCallbackReturn_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCallbackReturn_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[22] = all |
+		(PPP_CHECK_CB(on_NtCancelIoFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelIoFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[23] = all |
+		(PPP_CHECK_CB(on_NtCancelTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCancelTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[24] = all |
+		(PPP_CHECK_CB(on_NtClearEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClearEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[25] = all |
+		(PPP_CHECK_CB(on_NtClose_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtClose_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[26] = all |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[27] = all |
+		(PPP_CHECK_CB(on_NtCompactKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompactKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[28] = all |
+		(PPP_CHECK_CB(on_NtCompareTokens_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompareTokens_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[29] = all |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompleteConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[30] = all |
+		(PPP_CHECK_CB(on_NtCompressKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCompressKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[31] = all |
+		(PPP_CHECK_CB(on_NtConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[32] = all |
+		(PPP_CHECK_CB(on_NtContinue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtContinue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[33] = all |
+		(PPP_CHECK_CB(on_NtCreateDebugObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateDebugObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[34] = all |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[35] = all |
+		(PPP_CHECK_CB(on_NtCreateEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[36] = all |
+		(PPP_CHECK_CB(on_NtCreateEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[37] = all |
+		(PPP_CHECK_CB(on_NtCreateFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[38] = all |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[39] = all |
+		(PPP_CHECK_CB(on_NtCreateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[40] = all |
+		(PPP_CHECK_CB(on_NtCreateJobSet_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateJobSet_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[41] = all |
+		(PPP_CHECK_CB(on_NtCreateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[42] = all |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMailslotFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[43] = all |
+		(PPP_CHECK_CB(on_NtCreateMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[44] = all |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateNamedPipeFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[45] = all |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePagingFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[46] = all |
+		(PPP_CHECK_CB(on_NtCreatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[47] = all |
+		(PPP_CHECK_CB(on_NtCreateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[48] = all |
+		(PPP_CHECK_CB(on_NtCreateProcessEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProcessEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[49] = all |
+		(PPP_CHECK_CB(on_NtCreateProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[50] = all |
+		(PPP_CHECK_CB(on_NtCreateSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[51] = all |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[52] = all |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[53] = all |
+		(PPP_CHECK_CB(on_NtCreateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[54] = all |
+		(PPP_CHECK_CB(on_NtCreateTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[55] = all |
+		(PPP_CHECK_CB(on_NtCreateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[56] = all |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateWaitablePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[57] = all |
+		(PPP_CHECK_CB(on_NtDebugActiveProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDebugActiveProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[58] = all |
+		(PPP_CHECK_CB(on_NtDebugContinue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDebugContinue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[59] = all |
+		(PPP_CHECK_CB(on_NtDelayExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDelayExecution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[60] = all |
+		(PPP_CHECK_CB(on_NtDeleteAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[61] = all |
+		(PPP_CHECK_CB(on_NtDeleteBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[62] = all |
+		(PPP_CHECK_CB(on_NtDeleteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[63] = all |
+		(PPP_CHECK_CB(on_NtDeleteKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[64] = all |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[65] = all |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeleteValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[66] = all |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDeviceIoControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[67] = all |
+		(PPP_CHECK_CB(on_NtDisplayString_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDisplayString_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[68] = all |
+		(PPP_CHECK_CB(on_NtDuplicateObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[69] = all |
+		(PPP_CHECK_CB(on_NtDuplicateToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtDuplicateToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[70] = all |
+		(PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateBootEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[71] = all |
+		(PPP_CHECK_CB(on_NtEnumerateKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[72] = all |
+		(PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[73] = all |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtEnumerateValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[74] = all |
+		(PPP_CHECK_CB(on_NtExtendSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtExtendSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[75] = all |
+		(PPP_CHECK_CB(on_NtFilterToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFilterToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[76] = all |
+		(PPP_CHECK_CB(on_NtFindAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFindAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[77] = all |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushBuffersFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[78] = all |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushInstructionCache_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[79] = all |
+		(PPP_CHECK_CB(on_NtFlushKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[80] = all |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[81] = all |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFlushWriteBuffer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[82] = all |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[83] = all |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFreeVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[84] = all |
+		(PPP_CHECK_CB(on_NtFsControlFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtFsControlFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[85] = all |
+		(PPP_CHECK_CB(on_NtGetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[86] = all |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetDevicePowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[87] = all |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetPlugPlayEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[88] = all |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtGetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[89] = all |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[90] = all |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateClientOfPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[91] = all |
+		(PPP_CHECK_CB(on_NtImpersonateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtImpersonateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[92] = all |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitializeRegistry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[93] = all |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtInitiatePowerAction_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[94] = all |
+		(PPP_CHECK_CB(on_NtIsProcessInJob_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsProcessInJob_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[95] = all |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[96] = all |
+		(PPP_CHECK_CB(on_NtListenPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtListenPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[97] = all |
+		(PPP_CHECK_CB(on_NtLoadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[98] = all |
+		(PPP_CHECK_CB(on_NtLoadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[99] = all |
+		(PPP_CHECK_CB(on_NtLoadKey2_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLoadKey2_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[100] = all |
+		(PPP_CHECK_CB(on_NtLockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[101] = all |
+		(PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockProductActivationKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[102] = all |
+		(PPP_CHECK_CB(on_NtLockRegistryKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockRegistryKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[103] = all |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtLockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[104] = all |
+		(PPP_CHECK_CB(on_NtMakePermanentObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMakePermanentObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[105] = all |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMakeTemporaryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[106] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPages_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[107] = all |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[108] = all |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtMapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[109] = all |
+		(PPP_CHECK_CB(on_NtModifyBootEntry_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtModifyBootEntry_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[110] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[111] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[112] = all |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[113] = all |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[114] = all |
+		(PPP_CHECK_CB(on_NtOpenEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[115] = all |
+		(PPP_CHECK_CB(on_NtOpenEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[116] = all |
+		(PPP_CHECK_CB(on_NtOpenFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[117] = all |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[118] = all |
+		(PPP_CHECK_CB(on_NtOpenJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[119] = all |
+		(PPP_CHECK_CB(on_NtOpenKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[120] = all |
+		(PPP_CHECK_CB(on_NtOpenMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[121] = all |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[122] = all |
+		(PPP_CHECK_CB(on_NtOpenProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[123] = all |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcessToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[124] = all |
+		(PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenProcessTokenEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[125] = all |
+		(PPP_CHECK_CB(on_NtOpenSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[126] = all |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[127] = all |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[128] = all |
+		(PPP_CHECK_CB(on_NtOpenThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[129] = all |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThreadToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[130] = all |
+		(PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenThreadTokenEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[131] = all |
+		(PPP_CHECK_CB(on_NtOpenTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[132] = all |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPlugPlayControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[133] = all |
+		(PPP_CHECK_CB(on_NtPowerInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPowerInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[134] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeCheck_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[135] = all |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[136] = all |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[137] = all |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtProtectVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[138] = all |
+		(PPP_CHECK_CB(on_NtPulseEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtPulseEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[139] = all |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[140] = all |
+		(PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryBootEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[141] = all |
+		(PPP_CHECK_CB(on_NtQueryBootOptions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryBootOptions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[142] = all |
+		(PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDebugFilterState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[143] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[144] = all |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[145] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[146] = all |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryDirectoryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[147] = all |
+		(PPP_CHECK_CB(on_NtQueryEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[148] = all |
+		(PPP_CHECK_CB(on_NtQueryEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[149] = all |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryFullAttributesFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[150] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationAtom_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[151] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[152] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[153] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[154] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[155] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[156] = all |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[157] = all |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryInstallUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[158] = all |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[159] = all |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[160] = all |
+		(PPP_CHECK_CB(on_NtQueryKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[161] = all |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMultipleValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[162] = all |
+		(PPP_CHECK_CB(on_NtQueryMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[163] = all |
+		(PPP_CHECK_CB(on_NtQueryObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[164] = all |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryOpenSubKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[165] = all |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryPerformanceCounter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[166] = all |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[167] = all |
+		(PPP_CHECK_CB(on_NtQuerySection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[168] = all |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[169] = all |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[170] = all |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[171] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[172] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[173] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[174] = all |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQuerySystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[175] = all |
+		(PPP_CHECK_CB(on_NtQueryTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[176] = all |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[177] = all |
+		(PPP_CHECK_CB(on_NtQueryValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[178] = all |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[179] = all |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[180] = all |
+		(PPP_CHECK_CB(on_NtQueueApcThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueueApcThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[181] = all |
+		(PPP_CHECK_CB(on_NtRaiseException_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseException_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[182] = all |
+		(PPP_CHECK_CB(on_NtRaiseHardError_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRaiseHardError_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[183] = all |
+		(PPP_CHECK_CB(on_NtReadFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[184] = all |
+		(PPP_CHECK_CB(on_NtReadFileScatter_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadFileScatter_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[185] = all |
+		(PPP_CHECK_CB(on_NtReadRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[186] = all |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReadVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[187] = all |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[188] = all |
+		(PPP_CHECK_CB(on_NtReleaseMutant_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseMutant_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[189] = all |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseSemaphore_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[190] = all |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[191] = all |
+		(PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRemoveProcessDebug_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[192] = all |
+		(PPP_CHECK_CB(on_NtRenameKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRenameKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[193] = all |
+		(PPP_CHECK_CB(on_NtReplaceKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplaceKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[194] = all |
+		(PPP_CHECK_CB(on_NtReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[195] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[196] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[197] = all |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReplyWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[199] = all |
+		(PPP_CHECK_CB(on_NtRequestPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[200] = all |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRequestWaitReplyPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[202] = all |
+		(PPP_CHECK_CB(on_NtResetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[203] = all |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResetWriteWatch_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[204] = all |
+		(PPP_CHECK_CB(on_NtRestoreKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtRestoreKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[205] = all |
+		(PPP_CHECK_CB(on_NtResumeProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResumeProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[206] = all |
+		(PPP_CHECK_CB(on_NtResumeThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtResumeThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[207] = all |
+		(PPP_CHECK_CB(on_NtSaveKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[208] = all |
+		(PPP_CHECK_CB(on_NtSaveKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[209] = all |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSaveMergedKeys_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[210] = all |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSecureConnectPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[211] = all |
+		(PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetBootEntryOrder_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[212] = all |
+		(PPP_CHECK_CB(on_NtSetBootOptions_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetBootOptions_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[213] = all |
+		(PPP_CHECK_CB(on_NtSetContextThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetContextThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[214] = all |
+		(PPP_CHECK_CB(on_NtSetDebugFilterState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDebugFilterState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[215] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[216] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultLocale_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[217] = all |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetDefaultUILanguage_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[218] = all |
+		(PPP_CHECK_CB(on_NtSetEaFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEaFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[219] = all |
+		(PPP_CHECK_CB(on_NtSetEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[220] = all |
+		(PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetEventBoostPriority_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[221] = all |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[222] = all |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[223] = all |
+		(PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationDebugObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[224] = all |
+		(PPP_CHECK_CB(on_NtSetInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[225] = all |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[226] = all |
+		(PPP_CHECK_CB(on_NtSetInformationKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[227] = all |
+		(PPP_CHECK_CB(on_NtSetInformationObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[228] = all |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[229] = all |
+		(PPP_CHECK_CB(on_NtSetInformationThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[230] = all |
+		(PPP_CHECK_CB(on_NtSetInformationToken_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetInformationToken_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[231] = all |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIntervalProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[232] = all |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetIoCompletion_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[233] = all |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLdtEntries_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[234] = all |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[235] = all |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[236] = all |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetQuotaInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[237] = all |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSecurityObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[238] = all |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[239] = all |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[240] = all |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemInformation_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[241] = all |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemPowerState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[242] = all |
+		(PPP_CHECK_CB(on_NtSetSystemTime_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetSystemTime_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[243] = all |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetThreadExecutionState_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[244] = all |
+		(PPP_CHECK_CB(on_NtSetTimer_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimer_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[245] = all |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetTimerResolution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[246] = all |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetUuidSeed_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[247] = all |
+		(PPP_CHECK_CB(on_NtSetValueKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetValueKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[248] = all |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSetVolumeInformationFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[249] = all |
+		(PPP_CHECK_CB(on_NtShutdownSystem_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtShutdownSystem_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[250] = all |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[251] = all |
+		(PPP_CHECK_CB(on_NtStartProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStartProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[252] = all |
+		(PPP_CHECK_CB(on_NtStopProfile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtStopProfile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[253] = all |
+		(PPP_CHECK_CB(on_NtSuspendProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSuspendProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[254] = all |
+		(PPP_CHECK_CB(on_NtSuspendThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSuspendThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[255] = all |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtSystemDebugControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[256] = all |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateJobObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[257] = all |
+		(PPP_CHECK_CB(on_NtTerminateProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateProcess_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[258] = all |
+		(PPP_CHECK_CB(on_NtTerminateThread_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTerminateThread_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[259] = all |
+		(PPP_CHECK_CB(on_NtTestAlert_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTestAlert_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[260] = all |
+		(PPP_CHECK_CB(on_NtTraceEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTraceEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[261] = all |
+		(PPP_CHECK_CB(on_NtTranslateFilePath_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtTranslateFilePath_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[262] = all |
+		(PPP_CHECK_CB(on_NtUnloadDriver_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadDriver_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[263] = all |
+		(PPP_CHECK_CB(on_NtUnloadKey_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKey_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[264] = all |
+		(PPP_CHECK_CB(on_NtUnloadKeyEx_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnloadKeyEx_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[265] = all |
+		(PPP_CHECK_CB(on_NtUnlockFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[266] = all |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnlockVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[267] = all |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtUnmapViewOfSection_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[268] = all |
+		(PPP_CHECK_CB(on_NtVdmControl_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtVdmControl_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[269] = all |
+		(PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForDebugEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[270] = all |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForMultipleObjects_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[271] = all |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForSingleObject_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[272] = all |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitHighEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[273] = all |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitLowEventPair_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[274] = all |
+		(PPP_CHECK_CB(on_NtWriteFile_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFile_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[275] = all |
+		(PPP_CHECK_CB(on_NtWriteFileGather_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteFileGather_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[276] = all |
+		(PPP_CHECK_CB(on_NtWriteRequestData_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteRequestData_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[277] = all |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWriteVirtualMemory_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[278] = all |
+		(PPP_CHECK_CB(on_NtYieldExecution_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtYieldExecution_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[279] = all |
+		(PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtCreateKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[280] = all |
+		(PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtOpenKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[281] = all |
+		(PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtReleaseKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[282] = all |
+		(PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtWaitForKeyedEvent_return) ? SYSCALL_SUB_RETURN : 0);
+	subs[283] = all |
+		(PPP_CHECK_CB(on_NtQueryPortInformationProcess_enter) ? SYSCALL_SUB_ENTER : 0) |
+		(PPP_CHECK_CB(on_NtQueryPortInformationProcess_return) ? SYSCALL_SUB_RETURN : 0);
+#endif
+}
+
 /**
  * @brief Called when a system call invocation is identified.
  * Invokes all registered callbacks that should run for the call.
  *
  * Additionally, stores the context of the system call (number, asid,
  * arguments, return address) to prepare for handling the respective
- * system call return callbacks.
+ * system call return callbacks. System calls nobody subscribed to are
+ * dropped after a single lookup, and arguments are only decoded when
+ * some callback is going to see them.
  */
 void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 #ifdef TARGET_I386
 	CPUArchState *env = (CPUArchState*)cpu->env_ptr;
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[R_EAX];
-	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
+	uint8_t subs = syscall_subscription(ctx.no);
+	if (subs == 0) {
+		return;
+	}
+	if (subs & (SYSCALL_SUB_CTX | SYSCALL_SUB_RETURN)) {
+		ctx.asid = panda_current_asid(cpu);
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
@@ -35,15 +897,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', 'PVOID PortContext', 'PPORT_MESSAGE ConnectionRequest', 'BOOLEAN AcceptConnection', 'PPORT_VIEW ServerView', 'PREMOTE_PORT_VIEW ClientView']
 	case 0: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -56,17 +924,25 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 1: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -81,20 +957,31 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 2: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -112,20 +999,31 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -143,25 +1041,41 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -184,20 +1098,31 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -215,25 +1140,41 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -256,26 +1197,43 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 7: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		uint32_t arg14 = 0;
+		uint32_t arg15 = 0;
+		uint32_t arg16 = 0;
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
+			arg14 = get_32(cpu, 14);
+			arg15 = get_32(cpu, 15);
+			arg16 = get_32(cpu, 16);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -299,12 +1257,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 8 NTSTATUS NtAddAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -314,11 +1275,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 9 NTSTATUS NtAddBootEntry ['PBOOT_ENTRY BootEntry', 'PULONG Id']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAddBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAddBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -327,15 +1290,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 10 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', 'BOOLEAN ResetToDefault', 'PTOKEN_GROUPS NewState', 'ULONG BufferLength', 'PTOKEN_GROUPS PreviousState', 'PULONG ReturnLength']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -348,15 +1317,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 11 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', 'BOOLEAN DisableAllPrivileges', 'PTOKEN_PRIVILEGES NewState', 'ULONG BufferLength', 'PTOKEN_PRIVILEGES PreviousState', 'PULONG ReturnLength']
 	case 11: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -369,11 +1344,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 12 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -382,10 +1359,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 13 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAlertThread_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
@@ -393,10 +1371,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 14 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
@@ -404,12 +1383,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 15 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -419,13 +1401,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 16 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', 'PULONG Range', 'PULONG Sequence', 'PCHAR Seed']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -436,15 +1422,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 17 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'PSIZE_T RegionSize', 'ULONG AllocationType', 'ULONG Protect']
 	case 17: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -457,11 +1449,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 18 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', 'PVOID File2MappedAsFile']
 	case 18: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -470,11 +1464,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 19 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', 'HANDLE ProcessHandle']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -483,12 +1479,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 20 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', 'ULONG OutputLength', 'NTSTATUS Status']
 	case 20: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -498,11 +1497,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 22 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 22: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -511,11 +1512,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 23 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', 'PBOOLEAN CurrentState']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -524,10 +1527,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 24 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 	case 24: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClearEvent_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
@@ -535,10 +1539,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 25 NTSTATUS NtClose ['HANDLE Handle']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtClose_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
@@ -546,12 +1551,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 26 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 26: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -561,11 +1569,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 27 NTSTATUS NtCompactKeys ['ULONG Count', 'HANDLE KeyArray[]']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtCompactKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompactKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -574,12 +1584,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 28 NTSTATUS NtCompareTokens ['HANDLE FirstTokenHandle', 'HANDLE SecondTokenHandle', 'PBOOLEAN Equal']
 	case 28: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCompareTokens_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompareTokens_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -589,10 +1602,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 29 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 	case 29: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
@@ -600,10 +1614,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 30 NTSTATUS NtCompressKey ['HANDLE Key']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtCompressKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCompressKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtCompressKey_enter, cpu, pc, arg0);
@@ -611,17 +1626,25 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 31 NTSTATUS NtConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 31: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -636,11 +1659,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 32 NTSTATUS NtContinue ['PCONTEXT ContextRecord', 'BOOLEAN TestAlert']
 	case 32: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtContinue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -649,13 +1674,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 33 NTSTATUS NtCreateDebugObject ['PHANDLE DebugObjectHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Flags']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateDebugObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDebugObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -666,12 +1695,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 34 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 34: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -681,14 +1713,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 35 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'EVENT_TYPE EventType', 'BOOLEAN InitialState']
 	case 35: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -700,12 +1737,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 36 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 36: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -715,20 +1755,31 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 37 NTSTATUS NtCreateFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER AllocationSize', 'ULONG FileAttributes', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'PVOID EaBuffer', 'ULONG EaLength']
 	case 37: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -746,13 +1797,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 38 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Count']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -763,12 +1818,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 39 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -778,12 +1836,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 40 NTSTATUS NtCreateJobSet ['ULONG NumJob', 'PJOB_SET_ARRAY UserJobSet', 'ULONG Flags']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtCreateJobSet_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateJobSet_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -793,16 +1854,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 41 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG TitleIndex', 'PUNICODE_STRING Class', 'ULONG CreateOptions', 'PULONG Disposition']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -816,17 +1884,25 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 42 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CreateOptions', 'ULONG MailslotQuota', 'ULONG MaximumMessageSize', 'PLARGE_INTEGER ReadTimeout']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -841,13 +1917,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 43 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN InitialOwner']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -858,23 +1938,37 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 44 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'ULONG NamedPipeType', 'ULONG ReadMode', 'ULONG CompletionMode', 'ULONG MaximumInstances', 'ULONG InboundQuota', 'ULONG OutboundQuota', 'PLARGE_INTEGER DefaultTimeout']
 	case 44: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		uint32_t arg13 = 0;
+		if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
+			arg13 = get_32(cpu, 13);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -895,13 +1989,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 45 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', 'PLARGE_INTEGER MinimumSize', 'PLARGE_INTEGER MaximumSize', 'ULONG Priority']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -912,14 +2010,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 46 NTSTATUS NtCreatePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreatePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -931,17 +2034,25 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 47 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'BOOLEAN InheritObjectTable', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort']
 	case 47: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -956,18 +2067,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 48 NTSTATUS NtCreateProcessEx ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'ULONG Flags', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort', 'ULONG JobMemberLevel']
 	case 48: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProcessEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProcessEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -983,18 +2103,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 49 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', 'HANDLE Process', 'PVOID RangeBase', 'SIZE_T RangeSize', 'ULONG BucketSize', 'PULONG Buffer', 'ULONG BufferSize', 'KPROFILE_SOURCE ProfileSource', 'KAFFINITY Affinity']
 	case 49: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1010,16 +2139,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 50 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PLARGE_INTEGER MaximumSize', 'ULONG SectionPageProtection', 'ULONG AllocationAttributes', 'HANDLE FileHandle']
 	case 50: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1033,14 +2169,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 51 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LONG InitialCount', 'LONG MaximumCount']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		int32_t arg3 = 0;
+		int32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_s32(cpu, 3);
+			arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1052,13 +2193,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 52 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LinkTarget']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1069,17 +2214,25 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 53 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ProcessHandle', 'PCLIENT_ID ClientId', 'PCONTEXT ThreadContext', 'PINITIAL_TEB InitialTeb', 'BOOLEAN CreateSuspended']
 	case 53: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1094,13 +2247,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 54 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TIMER_TYPE TimerType']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1111,22 +2268,35 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 55 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TOKEN_TYPE TokenType', 'PLUID AuthenticationId', 'PLARGE_INTEGER ExpirationTime', 'PTOKEN_USER User', 'PTOKEN_GROUPS Groups', 'PTOKEN_PRIVILEGES Privileges', 'PTOKEN_OWNER Owner', 'PTOKEN_PRIMARY_GROUP PrimaryGroup', 'PTOKEN_DEFAULT_DACL DefaultDacl', 'PTOKEN_SOURCE TokenSource']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		uint32_t arg12 = 0;
+		if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
+			arg12 = get_32(cpu, 12);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1146,14 +2316,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 56 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 56: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1165,11 +2340,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 57 NTSTATUS NtDebugActiveProcess ['HANDLE ProcessHandle', 'HANDLE DebugObjectHandle']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDebugActiveProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugActiveProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1178,12 +2355,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 58 NTSTATUS NtDebugContinue ['HANDLE DebugObjectHandle', 'PCLIENT_ID ClientId', 'NTSTATUS ContinueStatus']
 	case 58: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtDebugContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDebugContinue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1193,11 +2373,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 59 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', 'PLARGE_INTEGER DelayInterval']
 	case 59: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1206,10 +2388,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 60 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 	case 60: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
@@ -1217,10 +2400,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 61 NTSTATUS NtDeleteBootEntry ['ULONG Id']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteBootEntry_enter, cpu, pc, arg0);
@@ -1228,10 +2412,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 62 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
@@ -1239,10 +2424,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 63 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
@@ -1250,12 +2436,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 64 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 64: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1265,11 +2454,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 65 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName']
 	case 65: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1278,19 +2469,29 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 66 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 66: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1307,10 +2508,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 67 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 	case 67: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDisplayString_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
@@ -1318,16 +2520,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 68 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', 'HANDLE SourceHandle', 'HANDLE TargetProcessHandle', 'PHANDLE TargetHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Options']
 	case 68: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1341,15 +2550,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 69 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN EffectiveOnly', 'TOKEN_TYPE TokenType', 'PHANDLE NewTokenHandle']
 	case 69: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1362,11 +2577,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 70 NTSTATUS NtEnumerateBootEntries ['PVOID Buffer', 'PULONG BufferLength']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateBootEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateBootEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1375,15 +2592,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 71 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1396,12 +2619,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 72 NTSTATUS NtEnumerateSystemEnvironmentValuesEx ['ULONG InformationClass', 'PVOID Buffer', 'PULONG BufferLength']
 	case 72: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateSystemEnvironmentValuesEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1411,15 +2637,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 73 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1432,11 +2664,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 74 NTSTATUS NtExtendSection ['HANDLE SectionHandle', 'PLARGE_INTEGER NewSectionSize']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtExtendSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1445,15 +2679,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 75 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', 'ULONG Flags', 'PTOKEN_GROUPS SidsToDisable', 'PTOKEN_PRIVILEGES PrivilegesToDelete', 'PTOKEN_GROUPS RestrictedSids', 'PHANDLE NewTokenHandle']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFilterToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1466,12 +2706,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 76 NTSTATUS NtFindAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 76: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFindAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1481,11 +2724,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 77 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 77: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1494,12 +2739,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 78 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T Length']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1509,10 +2757,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 79 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
@@ -1520,13 +2769,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 80 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'PIO_STATUS_BLOCK IoStatus']
 	case 80: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1542,12 +2795,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 82 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 82: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1557,13 +2813,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 83 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG FreeType']
 	case 83: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1574,19 +2834,29 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 84 NTSTATUS NtFsControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 84: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1603,11 +2873,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 85 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1616,11 +2888,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 86 NTSTATUS NtGetDevicePowerState ['HANDLE Device', 'DEVICE_POWER_STATE *State']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1629,13 +2903,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 87 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', 'PVOID Context', 'PPLUGPLAY_EVENT_BLOCK EventBlock', 'ULONG EventBufferSize']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1646,16 +2924,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 88 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', 'ULONG Flags', 'PVOID BaseAddress', 'SIZE_T RegionSize', 'PVOID *UserAddressArray', 'PULONG_PTR EntriesInUserAddressArray', 'PULONG Granularity']
 	case 88: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1669,10 +2954,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 89 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 	case 89: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
@@ -1680,11 +2966,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 90 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', 'PPORT_MESSAGE Message']
 	case 90: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1693,12 +2981,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 91 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', 'HANDLE ClientThreadHandle', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1708,10 +2999,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 92 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
@@ -1719,13 +3011,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 93 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags', 'BOOLEAN Asynchronous']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1736,11 +3032,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 94 NTSTATUS NtIsProcessInJob ['HANDLE ProcessHandle', 'HANDLE JobHandle']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtIsProcessInJob_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtIsProcessInJob_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1754,11 +3052,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 96 NTSTATUS NtListenPort ['HANDLE PortHandle', 'PPORT_MESSAGE ConnectionRequest']
 	case 96: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtListenPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1767,10 +3067,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 97 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 	case 97: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
@@ -1778,11 +3079,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 98 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile']
 	case 98: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1791,12 +3094,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 99 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile', 'ULONG Flags']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1806,19 +3112,29 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 100 NTSTATUS NtLockFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key', 'BOOLEAN FailImmediately', 'BOOLEAN ExclusiveLock']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1835,11 +3151,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 101 NTSTATUS NtLockProductActivationKeys ['ULONG *pPrivateVer', 'ULONG *pSafeMode']
 	case 101: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtLockProductActivationKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockProductActivationKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -1848,10 +3166,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 102 NTSTATUS NtLockRegistryKey ['HANDLE KeyHandle']
 	case 102: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtLockRegistryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockRegistryKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtLockRegistryKey_enter, cpu, pc, arg0);
@@ -1859,13 +3178,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 103 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 103: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1876,10 +3199,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 104 NTSTATUS NtMakePermanentObject ['HANDLE Handle']
 	case 104: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtMakePermanentObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakePermanentObject_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtMakePermanentObject_enter, cpu, pc, arg0);
@@ -1887,10 +3211,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 105 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 	case 105: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
@@ -1898,12 +3223,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 106 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1913,12 +3241,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 107 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1928,19 +3259,29 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 108 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', 'HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'SIZE_T CommitSize', 'PLARGE_INTEGER SectionOffset', 'PSIZE_T ViewSize', 'SECTION_INHERIT InheritDisposition', 'ULONG AllocationType', 'WIN32_PROTECTION_MASK Win32Protect']
 	case 108: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1957,10 +3298,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 109 NTSTATUS NtModifyBootEntry ['PBOOT_ENTRY BootEntry']
 	case 109: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtModifyBootEntry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtModifyBootEntry_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtModifyBootEntry_enter, cpu, pc, arg0);
@@ -1968,18 +3310,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 110 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'ULONG CompletionFilter', 'BOOLEAN WatchTree']
 	case 110: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1995,19 +3346,29 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 111 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 111: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2024,21 +3385,33 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 112 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', 'ULONG Count', 'OBJECT_ATTRIBUTES SlaveObjects[]', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 112: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2057,12 +3430,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 113 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 113: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2072,12 +3448,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 114 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2087,12 +3466,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 115 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2102,15 +3484,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 116 NTSTATUS NtOpenFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG OpenOptions']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2123,12 +3511,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 117 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2138,12 +3529,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 118 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2153,12 +3547,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 119 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 119: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2168,12 +3565,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 120 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2183,21 +3583,33 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 121 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'ACCESS_MASK GrantedAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN ObjectCreation', 'BOOLEAN AccessGranted', 'PBOOLEAN GenerateOnClose']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		uint32_t arg11 = 0;
+		if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
+			arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2216,13 +3628,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 122 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2233,12 +3649,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 123 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'PHANDLE TokenHandle']
 	case 123: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2248,13 +3667,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 124 NTSTATUS NtOpenProcessTokenEx ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'PHANDLE TokenHandle']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenProcessTokenEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenProcessTokenEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2265,12 +3688,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 125 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2280,12 +3706,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 126 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 126: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2295,12 +3724,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 127 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 127: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2310,13 +3742,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 128 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2327,13 +3763,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 129 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'PHANDLE TokenHandle']
 	case 129: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2344,14 +3784,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 130 NTSTATUS NtOpenThreadTokenEx ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'ULONG HandleAttributes', 'PHANDLE TokenHandle']
 	case 130: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtOpenThreadTokenEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenThreadTokenEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2363,12 +3808,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 131 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2378,12 +3826,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 132 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', 'PVOID PnPControlData', 'ULONG PnPControlDataLength']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2393,14 +3844,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 133 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2412,12 +3868,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 134 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', 'PPRIVILEGE_SET RequiredPrivileges', 'PBOOLEAN Result']
 	case 134: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2427,15 +3886,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 135 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 135: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2448,14 +3913,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 136 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', 'PUNICODE_STRING ServiceName', 'HANDLE ClientToken', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 136: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2467,14 +3937,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 137 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'WIN32_PROTECTION_MASK NewProtectWin32', 'PULONG OldProtect']
 	case 137: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2486,11 +3961,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 138 NTSTATUS NtPulseEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2499,11 +3976,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 139 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_BASIC_INFORMATION FileInformation']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2512,11 +3991,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 140 NTSTATUS NtQueryBootEntryOrder ['PULONG Ids', 'PULONG Count']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryBootEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2525,11 +4006,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 141 NTSTATUS NtQueryBootOptions ['PBOOT_OPTIONS BootOptions', 'PULONG BootOptionsLength']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryBootOptions_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryBootOptions_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2538,11 +4021,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 142 NTSTATUS NtQueryDebugFilterState ['ULONG ComponentId', 'ULONG Level']
 	case 142: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDebugFilterState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDebugFilterState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2551,11 +4036,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 143 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', 'PLCID DefaultLocaleId']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2564,10 +4051,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 144 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
@@ -2575,20 +4063,31 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 145 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass', 'BOOLEAN ReturnSingleEntry', 'PUNICODE_STRING FileName', 'BOOLEAN RestartScan']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		uint32_t arg9 = 0;
+		uint32_t arg10 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
+			arg9 = get_32(cpu, 9);
+			arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2606,16 +4105,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 146 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'BOOLEAN RestartScan', 'PULONG Context', 'PULONG ReturnLength']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2629,18 +4135,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 147 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID EaList', 'ULONG EaListLength', 'PULONG EaIndex', 'BOOLEAN RestartScan']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2656,14 +4171,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 148 NTSTATUS NtQueryEvent ['HANDLE EventHandle', 'EVENT_INFORMATION_CLASS EventInformationClass', 'PVOID EventInformation', 'ULONG EventInformationLength', 'PULONG ReturnLength']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2675,11 +4195,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 149 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2688,14 +4210,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 150 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', 'ATOM_INFORMATION_CLASS InformationClass', 'PVOID AtomInformation', 'ULONG AtomInformationLength', 'PULONG ReturnLength']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2707,14 +4234,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 151 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2726,14 +4258,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 152 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength', 'PULONG ReturnLength']
 	case 152: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2745,14 +4282,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 153 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', 'PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 153: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2764,14 +4306,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 154 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength', 'PULONG ReturnLength']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2783,14 +4330,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 155 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength', 'PULONG ReturnLength']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2802,14 +4354,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 156 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength', 'PULONG ReturnLength']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2821,10 +4378,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 157 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
@@ -2832,11 +4390,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 158 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', 'PULONG Interval']
 	case 158: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2845,14 +4405,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 159 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', 'IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', 'PVOID IoCompletionInformation', 'ULONG IoCompletionInformationLength', 'PULONG ReturnLength']
 	case 159: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2864,14 +4429,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 160 NTSTATUS NtQueryKey ['HANDLE KeyHandle', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 160: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2883,15 +4453,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 161 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', 'PKEY_VALUE_ENTRY ValueEntries', 'ULONG EntryCount', 'PVOID ValueBuffer', 'PULONG BufferLength', 'PULONG RequiredBufferLength']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2904,14 +4480,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 162 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', 'MUTANT_INFORMATION_CLASS MutantInformationClass', 'PVOID MutantInformation', 'ULONG MutantInformationLength', 'PULONG ReturnLength']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2923,14 +4504,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 163 NTSTATUS NtQueryObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength', 'PULONG ReturnLength']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2942,11 +4528,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 164 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', 'PULONG HandleCount']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2955,11 +4543,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 165 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', 'PLARGE_INTEGER PerformanceFrequency']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -2968,18 +4558,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 166 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID SidList', 'ULONG SidListLength', 'PULONG StartSid', 'BOOLEAN RestartScan']
 	case 166: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2995,14 +4594,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 167 NTSTATUS NtQuerySection ['HANDLE SectionHandle', 'SECTION_INFORMATION_CLASS SectionInformationClass', 'PVOID SectionInformation', 'SIZE_T SectionInformationLength', 'PSIZE_T ReturnLength']
 	case 167: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3014,14 +4618,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 168 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ULONG Length', 'PULONG LengthNeeded']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3033,14 +4642,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 169 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', 'SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', 'PVOID SemaphoreInformation', 'ULONG SemaphoreInformationLength', 'PULONG ReturnLength']
 	case 169: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3052,12 +4666,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 170 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', 'PUNICODE_STRING LinkTarget', 'PULONG ReturnedLength']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3067,13 +4684,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 171 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PWSTR VariableValue', 'USHORT ValueLength', 'PUSHORT ReturnLength']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3084,14 +4705,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 172 NTSTATUS NtQuerySystemEnvironmentValueEx ['PUNICODE_STRING VariableName', 'LPGUID VendorGuid', 'PVOID Value', 'PULONG ValueLength', 'PULONG Attributes']
 	case 172: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValueEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3103,13 +4729,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 173 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength', 'PULONG ReturnLength']
 	case 173: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3120,10 +4750,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 174 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 	case 174: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
@@ -3131,14 +4762,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 175 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', 'TIMER_INFORMATION_CLASS TimerInformationClass', 'PVOID TimerInformation', 'ULONG TimerInformationLength', 'PULONG ReturnLength']
 	case 175: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3150,12 +4786,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 176 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', 'PULONG MinimumTime', 'PULONG CurrentTime']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3165,15 +4804,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 177 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 177: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3186,15 +4831,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 178 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'MEMORY_INFORMATION_CLASS MemoryInformationClass', 'PVOID MemoryInformation', 'SIZE_T MemoryInformationLength', 'PSIZE_T ReturnLength']
 	case 178: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3207,14 +4858,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 179 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3226,14 +4882,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 180 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', 'PPS_APC_ROUTINE ApcRoutine', 'PVOID ApcArgument1', 'PVOID ApcArgument2', 'PVOID ApcArgument3']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3245,12 +4906,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 181 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', 'PCONTEXT ContextRecord', 'BOOLEAN FirstChance']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseException_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3260,15 +4924,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 182 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', 'ULONG NumberOfParameters', 'ULONG UnicodeStringParameterMask', 'PULONG_PTR Parameters', 'ULONG ValidResponseOptions', 'PULONG Response']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3281,18 +4951,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 183 NTSTATUS NtReadFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3308,18 +4987,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 184 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3335,15 +5023,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 185 NTSTATUS NtReadRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3356,14 +5050,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 186 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3375,10 +5074,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 187 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 	case 187: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
@@ -3386,11 +5086,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 188 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', 'PLONG PreviousCount']
 	case 188: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3399,12 +5101,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 189 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', 'LONG ReleaseCount', 'PLONG PreviousCount']
 	case 189: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		int32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_s32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3414,14 +5119,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 190 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', 'PVOID *KeyContext', 'PVOID *ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER Timeout']
 	case 190: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3433,11 +5143,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 191 NTSTATUS NtRemoveProcessDebug ['HANDLE ProcessHandle', 'HANDLE DebugObjectHandle']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRemoveProcessDebug_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRemoveProcessDebug_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3446,11 +5158,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 192 NTSTATUS NtRenameKey ['HANDLE KeyHandle', 'PUNICODE_STRING NewName']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRenameKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRenameKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3459,12 +5173,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 193 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', 'HANDLE TargetHandle', 'POBJECT_ATTRIBUTES OldFile']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3474,11 +5191,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 194 NTSTATUS NtReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3487,13 +5206,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 195 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3504,14 +5227,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 196 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage', 'PLARGE_INTEGER Timeout']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3523,11 +5251,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 197 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3536,11 +5266,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 199 NTSTATUS NtRequestPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage']
 	case 199: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3549,12 +5281,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 200 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage', 'PPORT_MESSAGE ReplyMessage']
 	case 200: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3564,11 +5299,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 202 NTSTATUS NtResetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 202: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3577,12 +5314,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 203 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T RegionSize']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3592,12 +5332,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 204 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Flags']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3607,10 +5350,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 205 NTSTATUS NtResumeProcess ['HANDLE ProcessHandle']
 	case 205: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtResumeProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeProcess_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtResumeProcess_enter, cpu, pc, arg0);
@@ -3618,11 +5362,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 206 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 206: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtResumeThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3631,11 +5377,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 207 NTSTATUS NtSaveKey ['HANDLE KeyHandle', 'HANDLE FileHandle']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3644,12 +5392,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 208 NTSTATUS NtSaveKeyEx ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Format']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSaveKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3659,12 +5410,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 209 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', 'HANDLE LowPrecedenceKeyHandle', 'HANDLE FileHandle']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3674,18 +5428,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 210 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PSID RequiredServerSid', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3701,11 +5464,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 211 NTSTATUS NtSetBootEntryOrder ['PULONG Ids', 'ULONG Count']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetBootEntryOrder_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootEntryOrder_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3714,11 +5479,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 212 NTSTATUS NtSetBootOptions ['PBOOT_OPTIONS BootOptions', 'ULONG FieldsToChange']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetBootOptions_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetBootOptions_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3727,11 +5494,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 213 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3740,12 +5509,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 214 NTSTATUS NtSetDebugFilterState ['ULONG ComponentId', 'ULONG Level', 'BOOLEAN State']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetDebugFilterState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDebugFilterState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3755,10 +5527,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 215 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
@@ -3766,11 +5539,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 216 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', 'LCID DefaultLocaleId']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3779,10 +5554,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 217 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
@@ -3790,13 +5566,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 218 NTSTATUS NtSetEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3807,11 +5587,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 219 NTSTATUS NtSetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -3820,10 +5602,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 220 NTSTATUS NtSetEventBoostPriority ['HANDLE EventHandle']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetEventBoostPriority_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetEventBoostPriority_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetEventBoostPriority_enter, cpu, pc, arg0);
@@ -3831,10 +5614,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 221 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
@@ -3842,10 +5626,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 222 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 	case 222: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
@@ -3853,14 +5638,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 223 NTSTATUS NtSetInformationDebugObject ['HANDLE DebugObjectHandle', 'DEBUGOBJECTINFOCLASS DebugObjectInformationClass', 'PVOID DebugInformation', 'ULONG DebugInformationLength', 'PULONG ReturnLength']
 	case 223: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationDebugObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationDebugObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3872,14 +5662,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 224 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 224: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3891,13 +5686,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 225 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength']
 	case 225: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3908,13 +5707,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 226 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', 'KEY_SET_INFORMATION_CLASS KeySetInformationClass', 'PVOID KeySetInformation', 'ULONG KeySetInformationLength']
 	case 226: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3925,13 +5728,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 227 NTSTATUS NtSetInformationObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3942,13 +5749,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 228 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength']
 	case 228: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3959,13 +5770,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 229 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3976,13 +5791,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 230 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3993,11 +5812,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 231 NTSTATUS NtSetIntervalProfile ['ULONG Interval', 'KPROFILE_SOURCE Source']
 	case 231: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4006,14 +5827,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 232 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', 'PVOID KeyContext', 'PVOID ApcContext', 'NTSTATUS IoStatus', 'ULONG_PTR IoStatusInformation']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4025,15 +5851,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 233 NTSTATUS NtSetLdtEntries ['ULONG Selector0', 'ULONG Entry0Low', 'ULONG Entry0Hi', 'ULONG Selector1', 'ULONG Entry1Low', 'ULONG Entry1Hi']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4046,10 +5878,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 234 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 	case 234: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
@@ -4057,10 +5890,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 235 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
@@ -4068,13 +5902,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 236 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4085,12 +5923,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 237 NTSTATUS NtSetSecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor']
 	case 237: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4100,11 +5941,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 238 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PUNICODE_STRING VariableValue']
 	case 238: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4113,14 +5956,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 239 NTSTATUS NtSetSystemEnvironmentValueEx ['PUNICODE_STRING VariableName', 'LPGUID VendorGuid', 'PVOID Value', 'ULONG ValueLength', 'ULONG Attributes']
 	case 239: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemEnvironmentValueEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4132,12 +5980,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 240 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4147,12 +5998,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 241 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags']
 	case 241: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4162,11 +6016,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 242 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', 'PLARGE_INTEGER PreviousTime']
 	case 242: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4175,11 +6031,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 243 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', 'PEXECUTION_STATE PreviousFlags']
 	case 243: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4188,16 +6046,23 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 244 NTSTATUS NtSetTimer ['HANDLE TimerHandle', 'PLARGE_INTEGER DueTime', 'PTIMER_APC_ROUTINE TimerApcRoutine', 'PVOID TimerContext', 'BOOLEAN WakeTimer', 'LONG Period', 'PBOOLEAN PreviousState']
 	case 244: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		int32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimer_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_s32(cpu, 5);
+			arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4211,12 +6076,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 245 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', 'BOOLEAN SetResolution', 'PULONG ActualTime']
 	case 245: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4226,10 +6094,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 246 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 	case 246: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
@@ -4237,15 +6106,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 247 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'ULONG TitleIndex', 'ULONG Type', 'PVOID Data', 'ULONG DataSize']
 	case 247: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4258,14 +6133,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 248 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 248: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4277,10 +6157,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 249 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 	case 249: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
@@ -4288,13 +6169,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 250 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', 'HANDLE WaitHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 250: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4305,10 +6190,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 251 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 	case 251: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStartProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
@@ -4316,10 +6202,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 252 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 	case 252: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtStopProfile_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
@@ -4327,10 +6214,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 253 NTSTATUS NtSuspendProcess ['HANDLE ProcessHandle']
 	case 253: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtSuspendProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendProcess_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtSuspendProcess_enter, cpu, pc, arg0);
@@ -4338,11 +6226,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 254 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 254: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4351,15 +6241,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 255 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength', 'PULONG ReturnLength']
 	case 255: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4372,11 +6268,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 256 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', 'NTSTATUS ExitStatus']
 	case 256: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4385,11 +6283,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 257 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', 'NTSTATUS ExitStatus']
 	case 257: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4398,11 +6298,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 258 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', 'NTSTATUS ExitStatus']
 	case 258: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4416,13 +6318,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 260 NTSTATUS NtTraceEvent ['HANDLE TraceHandle', 'ULONG Flags', 'ULONG FieldSize', 'PVOID Fields']
 	case 260: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtTraceEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTraceEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4433,13 +6339,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 261 NTSTATUS NtTranslateFilePath ['PFILE_PATH InputFilePath', 'ULONG OutputType', 'PFILE_PATH OutputFilePath', 'PULONG OutputFilePathLength']
 	case 261: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtTranslateFilePath_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtTranslateFilePath_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4450,10 +6360,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 262 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 	case 262: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
@@ -4461,10 +6372,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 263 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 	case 263: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
@@ -4472,11 +6384,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 264 NTSTATUS NtUnloadKeyEx ['POBJECT_ATTRIBUTES TargetKey', 'HANDLE Event']
 	case 264: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnloadKeyEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnloadKeyEx_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4485,14 +6399,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 265 NTSTATUS NtUnlockFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key']
 	case 265: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4504,13 +6423,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 266 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 266: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4521,11 +6444,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 267 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', 'PVOID BaseAddress']
 	case 267: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4534,11 +6459,13 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 268 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', 'PVOID ServiceData']
 	case 268: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtVdmControl_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 		}
@@ -4547,13 +6474,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 269 NTSTATUS NtWaitForDebugEvent ['HANDLE DebugObjectHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout', 'PDBGUI_WAIT_STATE_CHANGE WaitStateChange']
 	case 269: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForDebugEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForDebugEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4564,14 +6495,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 270 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', 'HANDLE Handles[]', 'WAIT_TYPE WaitType', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 270: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4583,12 +6519,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 271 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 271: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4598,10 +6537,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 272 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 	case 272: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
@@ -4609,10 +6549,11 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 273 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 	case 273: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
+			arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 		}
 		PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
@@ -4620,18 +6561,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 274 NTSTATUS NtWriteFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 274: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFile_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4647,18 +6597,27 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 275 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 275: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		uint32_t arg6 = 0;
+		uint32_t arg7 = 0;
+		uint32_t arg8 = 0;
+		if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
+			arg6 = get_32(cpu, 6);
+			arg7 = get_32(cpu, 7);
+			arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4674,15 +6633,21 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 276 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 276: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		uint32_t arg5 = 0;
+		if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
+			arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4695,14 +6660,19 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 277 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 277: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		uint32_t arg4 = 0;
+		if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
+			arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4719,13 +6689,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 279 NTSTATUS NtCreateKeyedEvent ['PHANDLE KeyedEventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Flags']
 	case 279: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtCreateKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtCreateKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4736,12 +6710,15 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 280 NTSTATUS NtOpenKeyedEvent ['PHANDLE KeyedEventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 280: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		if (PPP_CHECK_CB(on_NtOpenKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtOpenKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4751,13 +6728,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 281 NTSTATUS NtReleaseKeyedEvent ['HANDLE KeyedEventHandle', 'PVOID KeyValue', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 281: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtReleaseKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtReleaseKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4768,13 +6749,17 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 	// 282 NTSTATUS NtWaitForKeyedEvent ['HANDLE KeyedEventHandle', 'PVOID KeyValue', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 282: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
+		uint32_t arg0 = 0;
+		uint32_t arg1 = 0;
+		uint32_t arg2 = 0;
+		uint32_t arg3 = 0;
+		if (PPP_CHECK_CB(on_NtWaitForKeyedEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
 			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
 					PPP_CHECK_CB(on_NtWaitForKeyedEvent_return)))) {
+			arg0 = get_32(cpu, 0);
+			arg1 = get_32(cpu, 1);
+			arg2 = get_32(cpu, 2);
+			arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4794,7 +6779,7 @@ void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc) {
 
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
-	if (!panda_noreturn) {
+	if (!panda_noreturn && (subs & SYSCALL_SUB_RETURN)) {
 		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
 	}
 #endif
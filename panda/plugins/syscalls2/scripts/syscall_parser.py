@@ -172,21 +172,25 @@ class Argument(object):
             return 'uint16_t'
         assert False, 'Unknown type for argument %s: %s' % (self.name, self.type)
 
-    def emit_temp_declaration(self):
+    def emit_temp_declaration(self, init=False):
         ''' Returns a snippet declaring an appropriate temp
-            variable for this argument.
+            variable for this argument, optionally zeroed.
         '''
+        if init:
+            return "{0} arg{1} = 0;".format(self.ctype, self.no)
         return "{0} arg{1};".format(self.ctype, self.no)
 
-    def emit_temp_assignment(self):
-        ''' Returns a snippet declaring an appropriate temp
-            variable for this argument and assigning its
-            runtime value to it.
+    def emit_temp_assignment(self, declare=True):
+        ''' Returns a snippet assigning the runtime value of
+            this argument to its temp variable. Unless declare
+            is False, the temp is also declared.
         '''
         ctype = self.ctype
-        ctype_bits = int(filter(str.isdigit, ctype))
+        ctype_bits = int(''.join(filter(str.isdigit, ctype)))
         assert ctype_bits in [32, 64], 'Invalid number of bits for type %s' % ctype
         ctype_get = 'get_%d' % ctype_bits if ctype.startswith('uint') else 'get_s%d' % ctype_bits
+        if not declare:
+            return "arg{0} = {1}(cpu, {0});".format(self.no, ctype_get)
         return "{0} arg{1} = {2}(cpu, {1});".format(ctype, self.no, ctype_get)
 
     def emit_memcpy_temp_to_ref(self):
@@ -84,6 +84,7 @@ enum ProfileType {
 struct Profile {
     void         (*enter_switch)(CPUState *, target_ulong);
     void         (*return_switch)(CPUState *, target_ulong, const syscall_ctx_t *);
+    void         (*subscriptions)(std::vector<uint8_t> &, uint8_t, uint8_t);
     target_long  (*get_return_val )(CPUState *);
     target_ulong (*calc_retaddr )(CPUState *, target_ulong);
     uint32_t     (*get_32 )(CPUState *, uint32_t);
@@ -103,6 +104,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_linux_x86,
         .return_switch = syscall_return_switch_linux_x86,
+        .subscriptions = syscall_subscriptions_linux_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_linux_x86,
         .get_32 = get_32_linux_x86,
@@ -120,6 +122,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_linux_arm,
         .return_switch = syscall_return_switch_linux_arm,
+        .subscriptions = syscall_subscriptions_linux_arm,
         .get_return_val = get_return_val_arm,
         .calc_retaddr = calc_retaddr_linux_arm,
         .get_32 = get_32_linux_arm,
@@ -137,6 +140,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_2000_x86,
         .return_switch = syscall_return_switch_windows_2000_x86,
+        .subscriptions = syscall_subscriptions_windows_2000_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -158,6 +162,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_xpsp2_x86,
         .return_switch = syscall_return_switch_windows_xpsp2_x86,
+        .subscriptions = syscall_subscriptions_windows_xpsp2_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -179,6 +184,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_xpsp3_x86,
         .return_switch = syscall_return_switch_windows_xpsp3_x86,
+        .subscriptions = syscall_subscriptions_windows_xpsp3_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -200,6 +206,7 @@ Profile profiles[PROFILE_LAST] = {
     {
         .enter_switch = syscall_enter_switch_windows_7_x86,
         .return_switch = syscall_return_switch_windows_7_x86,
+        .subscriptions = syscall_subscriptions_windows_7_x86,
         .get_return_val = get_return_val_x86,
         .calc_retaddr = calc_retaddr_windows_x86,
         .get_32 = get_32_windows_x86,
@@ -477,6 +484,41 @@ extern const syscall_meta_t *syscall_meta;
  */
 context_map_t running_syscalls;
 
+/**
+ * @brief Subscription flags of each system call of the active profile,
+ * indexed by system call number. Rebuilt lazily after a callback is
+ * registered, so the enter path only costs one lookup for system calls
+ * nobody listens to.
+ */
+static std::vector<uint8_t> subscriptions;
+static uint8_t unknown_subscription;
+static bool subscriptions_stale = true;
+
+void syscall_subscriptions_changed(void) {
+    subscriptions_stale = true;
+}
+
+static void update_subscriptions(void) {
+    uint8_t all = 0;
+    if (PPP_CHECK_CB(on_all_sys_enter)) all |= SYSCALL_SUB_ENTER;
+    if (PPP_CHECK_CB(on_all_sys_enter2)) all |= SYSCALL_SUB_ENTER | SYSCALL_SUB_CTX;
+    if (PPP_CHECK_CB(on_all_sys_return) || PPP_CHECK_CB(on_all_sys_return2)) {
+        all |= SYSCALL_SUB_RETURN;
+    }
+    unknown_subscription = all;
+    if (PPP_CHECK_CB(on_unknown_sys_enter)) unknown_subscription |= SYSCALL_SUB_ENTER;
+    if (PPP_CHECK_CB(on_unknown_sys_return)) unknown_subscription |= SYSCALL_SUB_RETURN;
+    syscalls_profile->subscriptions(subscriptions, all, unknown_subscription);
+    subscriptions_stale = false;
+}
+
+uint8_t syscall_subscription(uint32_t no) {
+    if (unlikely(subscriptions_stale)) {
+        update_subscriptions();
+    }
+    return no < subscriptions.size() ? subscriptions[no] : unknown_subscription;
+}
+
 #if defined(SYSCALL_RETURN_DEBUG)
 /**
  * @brief Returns a string representation of a context_map_t container.
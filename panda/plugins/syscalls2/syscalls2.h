@@ -1,10 +1,24 @@
 #pragma once
 #include <map>
+#include <vector>
+#include <cstdint>
 typedef struct CPUState CPUState;
 typedef struct syscall_ctx syscall_ctx_t;
 typedef std::map<std::pair<target_ptr_t, target_ptr_t>, syscall_ctx_t> context_map_t;
 extern context_map_t running_syscalls;
 
+/**
+ * @brief Subscription flags of a system call: which work the enter switch
+ * has to do for it. A system call with no flags set is skipped.
+ */
+enum {
+    SYSCALL_SUB_ENTER = 1,  /**< an enter callback has to run */
+    SYSCALL_SUB_CTX = 2,    /**< on_all_sys_enter2 needs the full context */
+    SYSCALL_SUB_RETURN = 4, /**< the return of the call has to be tracked */
+};
+uint8_t syscall_subscription(uint32_t no);
+void syscall_subscriptions_changed(void);
+
 // grep -hE '^.*syscall_(enter|return)_switch_[^(]*\(' *.cpp | sed 's/ {$/;/' >> syscalls2.h
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc);
 void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc);
@@ -12,6 +26,12 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc);
 void syscall_enter_switch_windows_7_x86(CPUState *cpu, target_ptr_t pc);
 void syscall_enter_switch_windows_xpsp2_x86(CPUState *cpu, target_ptr_t pc);
 void syscall_enter_switch_windows_xpsp3_x86(CPUState *cpu, target_ptr_t pc);
+void syscall_subscriptions_linux_arm(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
+void syscall_subscriptions_linux_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
+void syscall_subscriptions_windows_2000_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
+void syscall_subscriptions_windows_7_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
+void syscall_subscriptions_windows_xpsp2_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
+void syscall_subscriptions_windows_xpsp3_x86(std::vector<uint8_t> &subs, uint8_t all, uint8_t unknown);
 void syscall_return_switch_linux_arm(CPUState *cpu, target_ptr_t pc, const syscall_ctx_t *rp);
 void syscall_return_switch_linux_x86(CPUState *cpu, target_ptr_t pc, const syscall_ctx_t *rp);
 void syscall_return_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc, const syscall_ctx_t *rp);
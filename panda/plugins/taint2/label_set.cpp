@@ -1,6 +1,4 @@
-extern "C" {
-#include <sys/mman.h>
-}
+#include <malloc.h>
 
 #include <cassert>
 
@@ -13,59 +11,6 @@ extern "C" {
 
 #include "label_set.h"
 
-template<typename T>
-class ArenaAlloc {
-private:
-    uint8_t *next = NULL;
-    std::vector<std::pair<uint8_t *, size_t>> blocks;
-    size_t next_block_size = 1 << 15;
-
-    void alloc_block() {
-        //printf("taint2: allocating block of size %lu\n", next_block_size);
-        next = (uint8_t *)mmap(NULL, next_block_size, PROT_READ | PROT_WRITE,
-                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        assert(next);
-        blocks.push_back(std::make_pair(next, next_block_size));
-        next_block_size <<= 1;
-    }
-
-    T *alloc_imp() {
-        assert(blocks.size() > 0);
-        std::pair<uint8_t *, size_t>& block = blocks.back();
-        if (next + sizeof(T) > block.first + block.second) {
-            alloc_block();
-            assert(next != NULL);
-        }
-
-        T *result = new(next) T;
-        next += sizeof(T);
-        return result;
-    }
-
-public:
-    ArenaAlloc() {
-        alloc_block();
-    }
-
-    const T *alloc() {
-        return alloc_imp();
-    }
-
-    const T *alloc(T &old) {
-        T *result = alloc_imp();
-        result->swap(old);
-        return result;
-    }
-
-    ~ArenaAlloc() {
-        for (auto&& block : blocks) {
-            munmap(block.first, block.second);
-        }
-    }
-};
-
-static ArenaAlloc<std::set<uint32_t>> LSA;
-
 namespace std {
 template<>
 class hash<set<uint32_t>> {
@@ -90,10 +35,19 @@ class hash<pair<LabelSetP, LabelSetP>> {
 };
 }
 
+// Every label set lives here, deduplicated by contents. Pointers to the
+// elements of an unordered_set stay valid until the element is erased, which
+// only label_set_sweep() does.
 static std::unordered_set<std::set<uint32_t>> label_sets;
-LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
-    static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP> memoized_unions;
+static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP> memoized_unions;
+
+// Label sets marked since the last sweep.
+static std::unordered_set<LabelSetP> live_label_sets;
+
+// Number of sweeps that freed anything.
+static uint64_t sweep_epoch = 0;
 
+LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
     if (ls1 == ls2) {
         return ls1;
     } else if (ls1 && ls2) {
@@ -130,7 +84,56 @@ LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
 LabelSetP label_set_singleton(uint32_t label) {
     std::set<uint32_t> temp;
     temp.insert(label);
-    return LSA.alloc(temp);
+    return &(*label_sets.insert(temp).first);
+}
+
+void label_set_mark(LabelSetP ls) {
+    if (ls) live_label_sets.insert(ls);
+}
+
+bool label_set_marked(LabelSetP ls) {
+    return live_label_sets.count(ls) != 0;
+}
+
+size_t label_set_sweep() {
+    size_t freed = 0;
+    for (auto it = label_sets.begin(); it != label_sets.end();) {
+        if (live_label_sets.count(&(*it))) {
+            ++it;
+        } else {
+            it = label_sets.erase(it);
+            freed++;
+        }
+    }
+
+    // Any memo entry mentioning a freed set is stale: its address may be
+    // handed out again for a set with different contents.
+    for (auto it = memoized_unions.begin(); it != memoized_unions.end();) {
+        if (live_label_sets.count(it->first.first) &&
+                live_label_sets.count(it->first.second) &&
+                live_label_sets.count(it->second)) {
+            ++it;
+        } else {
+            it = memoized_unions.erase(it);
+        }
+    }
+
+    // Compact: shrink the tables to the survivors and hand the freed nodes
+    // back to the OS.
+    std::unordered_set<LabelSetP>().swap(live_label_sets);
+    label_sets.rehash(0);
+    memoized_unions.rehash(0);
+    malloc_trim(0);
+    if (freed) sweep_epoch++;
+    return freed;
+}
+
+size_t label_set_count() {
+    return label_sets.size();
+}
+
+uint64_t label_set_epoch() {
+    return sweep_epoch;
 }
 
 std::set<uint32_t> label_set_render_set(LabelSetP ls) {
@@ -15,6 +15,7 @@ PANDAENDCOMMENT */
 #ifndef __LABEL_SET_H_
 #define __LABEL_SET_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <set>
 
@@ -28,4 +29,15 @@ LabelSetP label_set_singleton(uint32_t label);
 void label_set_iter(LabelSetP ls, void (*leaf)(uint32_t, void *), void *user);
 std::set<uint32_t> label_set_render_set(LabelSetP ls);
 
+// Label-set garbage collection. At a point where nothing holds label sets
+// outside the shadow memories, mark every label set still referenced, then
+// sweep to free the others. Returns the number of label sets freed.
+void label_set_mark(LabelSetP ls);
+bool label_set_marked(LabelSetP ls);
+size_t label_set_sweep();
+size_t label_set_count();
+// Bumped by every sweep that frees label sets; a freed set's address may be
+// handed out again for different labels afterwards.
+uint64_t label_set_epoch();
+
 #endif
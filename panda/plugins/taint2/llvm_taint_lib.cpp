@@ -66,6 +66,7 @@ PPP_CB_BOILERPLATE(on_ptr_store);
 }
 
 extern const char *qemu_file;
+extern bool labels_only;
 
 // Helper methods for doing structure computations.
 #define cpu_off(member) (uint64_t)(&((CPUArchState *)0)->member)
@@ -231,13 +232,19 @@ bool PandaTaintFunctionPass::doInitialization(Module &M) {
 #define ADD_MAPPING(func) \
     EE->addGlobalMapping(M.getFunction(#func), (void *)(func));\
     M.getFunction(#func)->deleteBody();
+// The ops that depend on the shadow policy get their LabelsOnly
+// instantiation in labels-only mode.
+#define ADD_POLICY_MAPPING(func) \
+    EE->addGlobalMapping(M.getFunction(#func), labels_only ? \
+            (void *)(func##_t<LabelsOnly>) : (void *)(func));\
+    M.getFunction(#func)->deleteBody();
     ADD_MAPPING(taint_delete);
-    ADD_MAPPING(taint_mix);
-    ADD_MAPPING(taint_pointer);
-    ADD_MAPPING(taint_mix_compute);
-    ADD_MAPPING(taint_mul_compute);
-    ADD_MAPPING(taint_parallel_compute);
-    ADD_MAPPING(taint_copy);
+    ADD_POLICY_MAPPING(taint_mix);
+    ADD_POLICY_MAPPING(taint_pointer);
+    ADD_POLICY_MAPPING(taint_mix_compute);
+    ADD_POLICY_MAPPING(taint_mul_compute);
+    ADD_POLICY_MAPPING(taint_parallel_compute);
+    ADD_POLICY_MAPPING(taint_copy);
     ADD_MAPPING(taint_sext);
     ADD_MAPPING(taint_select);
     ADD_MAPPING(taint_host_copy);
@@ -253,6 +260,7 @@ bool PandaTaintFunctionPass::doInitialization(Module &M) {
 
     //ADD_MAPPING(label_set_union);
     //ADD_MAPPING(label_set_singleton);
+#undef ADD_POLICY_MAPPING
 #undef ADD_MAPPING
 
     std::cout << "taint2: Done initializing taint transformation." << std::endl;
@@ -22,6 +22,8 @@ PANDAENDCOMMENT */
 #include <string.h>
 #include <inttypes.h>
 
+#include <fcntl.h>
+#include <unistd.h>
 #include <sys/mman.h>
 
 #include "taint_defines.h"
@@ -40,22 +42,23 @@ Shad::~Shad() = default;
 
 typedef const std::set<uint32_t> *LabelSetP;
 
-FastShad::FastShad(std::string name, uint64_t labelsets) : Shad(name, labelsets)
+template <typename Policy>
+FastShadT<Policy>::FastShadT(std::string name, uint64_t labelsets) : Shad(name, labelsets)
 {
-    uint64_t bytes = sizeof(TaintData) * labelsets;
+    uint64_t bytes = sizeof(Entry) * labelsets;
 
-    TaintData *array;
+    Entry *array;
     if (labelsets < (1UL << 24)) {
-        array = (TaintData *)malloc(bytes);
+        array = (Entry *)malloc(bytes);
         printf("taint2: Allocating small fast_shad (%" PRIu64 " bytes) using malloc @ %lx.\n",
                 bytes, (uint64_t)array);
         assert(array);
         memset(array, 0, bytes);
     } else {
         printf("taint2: Allocating large fast_shad (%lu bytes).\n", bytes);
-        array = (TaintData *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+        array = (Entry *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
                 MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
-        if (array == (TaintData *)MAP_FAILED) {
+        if (array == (Entry *)MAP_FAILED) {
             puts(strerror(errno));
         }
     }
@@ -65,20 +68,71 @@ FastShad::FastShad(std::string name, uint64_t labelsets) : Shad(name, labelsets)
 }
 
 // release all memory associated with this fast_shad.
-FastShad::~FastShad() {
+template <typename Policy>
+FastShadT<Policy>::~FastShadT() {
     if (size < (1UL << 24)) {
         free(orig_labels);
     } else {
-        munmap(orig_labels, sizeof(TaintData) * size);
+        munmap(orig_labels, sizeof(Entry) * size);
     }
 }
 
-LazyShad::LazyShad(std::string name, uint64_t max_size) : Shad(name, max_size)
+// Large shadows are sparse mmap()s, mostly never written. Walking all of
+// them would fault in every page, so only look at pages the kernel reports
+// as present or swapped in /proc/self/pagemap.
+template <typename Policy>
+void FastShadT<Policy>::mark_label_sets()
+{
+    if (size < (1UL << 24)) {
+        for (uint64_t i = 0; i < size; i++) {
+            label_set_mark(Policy::ls(orig_labels[i]));
+        }
+        return;
+    }
+
+    const uint64_t page_size = sysconf(_SC_PAGESIZE);
+    const uint64_t bytes = sizeof(Entry) * size;
+    const uintptr_t base = (uintptr_t)orig_labels;
+    int fd = open("/proc/self/pagemap", O_RDONLY);
+
+    uint64_t entries[512];
+    for (uint64_t off = 0; off < bytes; off += page_size * 512) {
+        uint64_t npages = std::min<uint64_t>(512,
+                (bytes - off + page_size - 1) / page_size);
+        ssize_t want = npages * sizeof(uint64_t);
+        off_t pos = (base + off) / page_size * sizeof(uint64_t);
+        if (fd < 0 || pread(fd, entries, want, pos) != want) {
+            // can't tell, look at everything
+            for (uint64_t p = 0; p < npages; p++) entries[p] = 3ULL << 62;
+        }
+        for (uint64_t p = 0; p < npages; p++) {
+            // bit 63: present, bit 62: swapped
+            if (!(entries[p] >> 62)) continue;
+            uint64_t start = off + p * page_size;
+            uint64_t end = std::min(bytes, start + page_size);
+            for (uint64_t i = (start + sizeof(Entry) - 1) / sizeof(Entry);
+                    i * sizeof(Entry) < end; i++) {
+                label_set_mark(Policy::ls(orig_labels[i]));
+            }
+        }
+    }
+
+    if (fd >= 0) close(fd);
+}
+
+template <typename Policy>
+LazyShadT<Policy>::LazyShadT(std::string name, uint64_t max_size) : Shad(name, max_size)
 {
     tassert(this->size > 0);
     tassert(this->_name.size() > 0);
 }
 
-LazyShad::~LazyShad()
+template <typename Policy>
+LazyShadT<Policy>::~LazyShadT()
 {
 }
+
+template class FastShadT<FullTaint>;
+template class FastShadT<LabelsOnly>;
+template class LazyShadT<FullTaint>;
+template class LazyShadT<LabelsOnly>;
@@ -37,7 +37,6 @@ extern "C" {
 class Shad;
 
 extern "C" {
-extern bool track_taint_state;
 extern void taint_state_changed(Shad *shad, uint64_t addr, uint64_t size);
 
 // maximum taintset compute number (0=unlimited)
@@ -134,6 +133,10 @@ class Shad
     virtual bool range_tainted(uint64_t addr, uint64_t size) = 0;
 
   public:
+    // Whether copy() and remove() check for and report taint changes to this
+    // shadow; set by taint2 for the kinds of shadow someone subscribed to.
+    bool track_changes = false;
+
     Shad(std::string name, uint64_t max_size);
 
     virtual ~Shad() = 0;
@@ -161,7 +164,7 @@ class Shad
         tassert(src + size <= shad_src->size);
 
         bool change = false;
-        if (track_taint_state && (shad_dest->range_tainted(dest, size) ||
+        if (shad_dest->track_changes && (shad_dest->range_tainted(dest, size) ||
                     shad_src->range_tainted(src, size)))
             change = true;
 
@@ -199,6 +202,9 @@ class Shad
 
     virtual uint32_t query_tcn(uint64_t addr) = 0;
 
+    // Marks every label set this shadow references (see label_set_mark).
+    virtual void mark_label_sets() = 0;
+
     const char *name()
     {
         return _name.c_str();
@@ -206,14 +212,41 @@ class Shad
 
 };
 
+// Shadow entry policies: what the shadows store per byte, and which
+// bookkeeping the taint ops do. FullTaint keeps the whole TaintData.
+// LabelsOnly keeps just the label set, for users who only ask which labels
+// reached a location; it drops taint compute numbers and controlled-bit
+// masks, halving the shadow size and the per-op work. taint2 picks one when
+// it is loaded (the "labels_only" option).
+struct FullTaint {
+    typedef TaintData Entry;
+    static const bool track_tcn_cb = true;
+
+    static TaintData load(const Entry &e) { return e; }
+    static Entry store(const TaintData &td) { return td; }
+    static LabelSetP ls(const Entry &e) { return e.ls; }
+};
+
+struct LabelsOnly {
+    typedef LabelSetP Entry;
+    static const bool track_tcn_cb = false;
+
+    static TaintData load(const Entry &e) { return TaintData(e); }
+    static Entry store(const TaintData &td) { return td.ls; }
+    static LabelSetP ls(const Entry &e) { return e; }
+};
+
 // A fast shadow memory - allocates memory on creation.
-class FastShad : public Shad
+template <typename Policy>
+class FastShadT : public Shad
 {
   private:
-    TaintData *labels;
-    TaintData *orig_labels;
+    typedef typename Policy::Entry Entry;
+
+    Entry *labels;
+    Entry *orig_labels;
 
-    TaintData *get_td_p(uint64_t guest_addr)
+    Entry *get_td_p(uint64_t guest_addr)
     {
         tassert(guest_addr < size);
         return &labels[guest_addr];
@@ -223,21 +256,21 @@ class FastShad : public Shad
     bool range_tainted(uint64_t addr, uint64_t size) override
     {
         for (unsigned i = addr; i < addr + size; i++) {
-            if (get_td_p(i)->ls)
+            if (Policy::ls(*get_td_p(i)))
                 return true;
         }
         return false;
     }
 
   public:
-    FastShad(std::string name, uint64_t size);
-    ~FastShad();
+    FastShadT(std::string name, uint64_t size);
+    ~FastShadT();
 
     // Taint an address with a labelset.
     void label(uint64_t addr, LabelSetP ls) override
     {
         taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
-        *get_td_p(addr) = TaintData(ls);
+        *get_td_p(addr) = Policy::store(TaintData(ls));
     }
 
     // Remove taint.
@@ -247,9 +280,9 @@ class FastShad : public Shad
         tassert(addr + remove_size <= size);
 
         bool change = false;
-        if (track_taint_state && range_tainted(addr, remove_size))
+        if (track_changes && range_tainted(addr, remove_size))
             change = true;
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        memset(get_td_p(addr), 0, remove_size * sizeof(Entry));
 
         if (change)
             taint_state_changed(this, addr, remove_size);
@@ -260,12 +293,12 @@ class FastShad : public Shad
         tassert(addr + remove_size >= addr);
         tassert(addr + remove_size <= size);
 
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        memset(get_td_p(addr), 0, remove_size * sizeof(Entry));
     }
 
     LabelSetP query(uint64_t addr) override
     {
-        return get_td_p(addr)->ls;
+        return Policy::ls(*get_td_p(addr));
     }
 
     void reset_frame() override
@@ -290,7 +323,7 @@ class FastShad : public Shad
 
     TaintData query_full(uint64_t addr) override
     {
-        return labels[addr];
+        return Policy::load(labels[addr]);
     }
 
     void set_full(uint64_t addr, TaintData td) override
@@ -299,11 +332,12 @@ class FastShad : public Shad
 
         uint32_t newcard = 0;
         if (td.ls != NULL) newcard = td.ls->size();
-        if (((max_tcn == 0) || (td.tcn <= max_tcn)) &&
+        if ((!Policy::track_tcn_cb || (max_tcn == 0) || (td.tcn <= max_tcn)) &&
             ((max_taintset_card == 0) || (newcard <= max_taintset_card)))
         {
-            bool change = !(td == *get_td_p(addr));
-            labels[addr] = td;
+            Entry e = Policy::store(td);
+            bool change = !(e == *get_td_p(addr));
+            labels[addr] = e;
             
             if (change) taint_state_changed(this, addr, 1);
         }
@@ -323,26 +357,31 @@ class FastShad : public Shad
     void set_full_quiet(uint64_t addr, TaintData td) override
     {
         tassert(addr < size);
-        labels[addr] = td;
+        labels[addr] = Policy::store(td);
     }
 
     uint32_t query_tcn(uint64_t addr) override
     {
         return (query_full(addr)).tcn;
     }
+
+    void mark_label_sets() override;
 };
 
-class LazyShad : public Shad
+typedef FastShadT<FullTaint> FastShad;
+
+template <typename Policy>
+class LazyShadT : public Shad
 {
   private:
-    std::map<uint64_t, TaintData> labels;
+    std::map<uint64_t, typename Policy::Entry> labels;
 
   protected:
     bool range_tainted(uint64_t addr, uint64_t size) override
     {
         for (uint64_t cur = addr; cur < addr + size; cur++) {
             auto it = labels.find(cur);
-            if (it != labels.end() && it->second.ls) {
+            if (it != labels.end() && Policy::ls(it->second)) {
                 return true;
             }
         }
@@ -350,8 +389,8 @@ class LazyShad : public Shad
     }
 
   public:
-    LazyShad(std::string name, uint64_t size);
-    ~LazyShad();
+    LazyShadT(std::string name, uint64_t size);
+    ~LazyShadT();
 
     void label(uint64_t addr, LabelSetP ls) override
     {
@@ -360,13 +399,13 @@ class LazyShad : public Shad
         // use constructor that sets cb_mask to 0xFF, or it's not really tainted
         TaintData td = TaintData(ls);
 
-        labels[addr] = td;
+        labels[addr] = Policy::store(td);
     }
 
     void remove(uint64_t addr, uint64_t remove_size) override
     {
         bool change = false;
-        if (track_taint_state && range_tainted(addr, remove_size)) {
+        if (track_changes && range_tainted(addr, remove_size)) {
             change = true;
         }
         for (uint64_t cur = addr; cur < addr + remove_size; cur++) {
@@ -391,23 +430,24 @@ class LazyShad : public Shad
         if (result == labels.end()) {
             return NULL;
         }
-        return result->second.ls;
+        return Policy::ls(result->second);
     }
 
     TaintData query_full(uint64_t addr) override
     {
-        return labels[addr];
+        return Policy::load(labels[addr]);
     }
 
     void set_full(uint64_t addr, TaintData td) override
     {
         uint32_t newcard = 0;
         if (td.ls != NULL) newcard = td.ls->size();
-        if (((max_tcn == 0) || (td.tcn <= max_tcn)) &&
+        if ((!Policy::track_tcn_cb || (max_tcn == 0) || (td.tcn <= max_tcn)) &&
             ((max_taintset_card == 0) || (newcard <= max_taintset_card)))
         {
-            bool change = !(td == query_full(addr));
-            labels[addr] = td;
+            typename Policy::Entry e = Policy::store(td);
+            bool change = !(e == labels[addr]);
+            labels[addr] = e;
             
             if (change) taint_state_changed(this, addr, 1);
         }
@@ -426,7 +466,7 @@ class LazyShad : public Shad
     // Set taint quietly - ie. no taint change report is made
     void set_full_quiet(uint64_t addr, TaintData td) override
     {
-        labels[addr] = td;
+        labels[addr] = Policy::store(td);
     }
 
     uint32_t query_tcn(uint64_t addr) override
@@ -434,6 +474,13 @@ class LazyShad : public Shad
         return (query_full(addr)).tcn;
     }
 
+    void mark_label_sets() override
+    {
+        for (auto &entry : labels) {
+            label_set_mark(Policy::ls(entry.second));
+        }
+    }
+
     void reset_frame() override
     {
     }
@@ -447,4 +494,6 @@ class LazyShad : public Shad
     }
 };
 
+typedef LazyShadT<FullTaint> LazyShad;
+
 #endif
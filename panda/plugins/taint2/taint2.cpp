@@ -36,7 +36,9 @@
 #undef NDEBUG
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include "panda/plugin.h"
 #include "panda/tcg-llvm.h"
@@ -84,8 +86,11 @@ int on_replay_before_dma(CPUState *cpu, uint32_t is_write, uint8_t *src_addr, ui
 void taint_state_changed(Shad *, uint64_t, uint64_t);
 PPP_PROT_REG_CB(on_taint_change);
 PPP_CB_BOILERPLATE(on_taint_change);
+PPP_PROT_REG_CB(on_taint_changes);
+PPP_CB_BOILERPLATE(on_taint_changes);
 
-bool track_taint_state = false;
+bool track_taint_state = false;   // on_taint_change for every shadow
+uint32_t taint_change_kinds = 0;  // on_taint_changes, mask of 1 << AddrType
 uint32_t max_tcn = 0;          // ie disabled
 uint32_t max_taintset_card = 0;   // ie disabled - there is no maximum
 
@@ -115,6 +120,7 @@ target_ulong savedEflags;
 #endif
 
 int asid_changed_callback(CPUState *env, target_ulong oldval, target_ulong newval);
+int labelset_gc_before_cpu_exec_exit(CPUState *cpu, bool ranBlock);
 }
 
 ShadowState *shadow = nullptr; // Global shadow memory
@@ -144,6 +150,13 @@ bool optimize_llvm = true;
 extern bool inline_taint;
 bool debug_taint = false;
 bool detaint_cb0_bytes = false;
+// Track label sets only: no taint compute numbers or controlled bits.
+bool labels_only = false;
+
+// Label-set garbage collection runs once this many label sets exist
+// (0 = never), and after that whenever the count doubles.
+static uint32_t labelset_gc_threshold = 0;
+static size_t labelset_gc_next = 0;
 
 /*
  * These memory callbacks are only for whole-system mode.  User-mode memory
@@ -311,7 +324,8 @@ void taint2_enable_taint(void) {
     panda_enable_llvm_helpers();
 
     if (shadow) delete shadow;
-    shadow = new ShadowState();
+    shadow = new ShadowState(labels_only);
+    update_taint_change_tracking();
 
     // Initialize memlog.
     memset(&taint_memlog, 0, sizeof(taint_memlog));
@@ -448,6 +462,40 @@ int i386_before_cpu_exec_exit(CPUState *cpu, bool ranBlock) {
 }
 #endif
 
+/**
+ * @brief Frees the label sets that no shadow memory refers to anymore.
+ * Must only run between blocks, when taint ops hold no label sets.
+ */
+static void labelset_gc(void) {
+    shadow->mark_label_sets();
+#if defined(TARGET_I386)
+    if (savedTaint) {
+        for (uint32_t i = 0; i < sizeof(target_ulong); i++) {
+            label_set_mark(ccDstTaint[i].ls);
+            label_set_mark(ccSrcTaint[i].ls);
+            label_set_mark(ccSrc2Taint[i].ls);
+        }
+        for (uint32_t i = 0; i < sizeof(uint32_t); i++) {
+            label_set_mark(ccOpTaint[i].ls);
+        }
+    }
+#endif
+    taint2_prune_pandalog_label_sets();
+
+    size_t freed = label_set_sweep();
+    size_t live = label_set_count();
+    labelset_gc_next = std::max<size_t>(labelset_gc_threshold, 2 * live);
+    std::cerr << PANDA_MSG "label set gc: freed " << freed << ", "
+              << live << " live" << std::endl;
+}
+
+int labelset_gc_before_cpu_exec_exit(CPUState *cpu, bool ranBlock) {
+    if (taintEnabled && label_set_count() >= labelset_gc_next) {
+        labelset_gc();
+    }
+    return 0;
+}
+
 __attribute__((unused)) static void print_labels(uint32_t el, void *stuff) {
     printf("%d ", el);
 }
@@ -474,36 +522,160 @@ void panda_virtual_string_read(CPUState *cpu, target_ulong vaddr, char *str) {
 }
 #endif
 
-/**
- * @brief Wrapper for running the registered `on_taint_change` PPP callbacks.
- * Called by the shadow memory implementation whenever changes occur to it.
- */
-void taint_state_changed(Shad *shad, uint64_t shad_addr, uint64_t size)
+// Translates an offset into one of the shadows into an Addr.
+static bool shad_to_addr(Shad *shad, uint64_t shad_addr, Addr *addr)
 {
-    Addr addr;
     if (shad == &shadow->llv) {
-        addr = make_laddr(shad_addr / MAXREGSIZE, shad_addr % MAXREGSIZE);
+        *addr = make_laddr(shad_addr / MAXREGSIZE, shad_addr % MAXREGSIZE);
     } else if (shad == &shadow->ram) {
-        addr = make_maddr(shad_addr);
+        *addr = make_maddr(shad_addr);
     } else if (shad == &shadow->grv) {
-        addr = make_greg(shad_addr / sizeof(target_ulong), shad_addr % sizeof(target_ulong));
+        *addr = make_greg(shad_addr / sizeof(target_ulong), shad_addr % sizeof(target_ulong));
     } else if (shad == &shadow->gsv) {
-        addr.typ = GSPEC;
-        addr.val.gs = shad_addr;
-        addr.off = 0;
-        addr.flag = (AddrFlag)0;
+        addr->typ = GSPEC;
+        addr->val.gs = shad_addr;
+        addr->off = 0;
+        addr->flag = (AddrFlag)0;
     } else if (shad == &shadow->ret) {
-        addr.typ = RET;
-        addr.val.ret = 0;
-        addr.off = shad_addr;
-        addr.flag = (AddrFlag)0;
+        addr->typ = RET;
+        addr->val.ret = 0;
+        addr->off = shad_addr;
+        addr->flag = (AddrFlag)0;
     } else if (shad == &shadow->hd) {
-        addr = make_haddr(shad_addr);
+        *addr = make_haddr(shad_addr);
     } else if (shad == &shadow->io) {
-        addr = make_iaddr(shad_addr);
+        *addr = make_iaddr(shad_addr);
         /*    } else if (shad == &shadow->ports) {
                 addr = make_paddr(shad_addr); */
-    } else return;
+    } else return false;
+    return true;
+}
+
+static AddrType shad_kind(Shad *shad)
+{
+    if (shad == &shadow->ram) return MADDR;
+    if (shad == &shadow->llv) return LADDR;
+    if (shad == &shadow->grv) return GREG;
+    if (shad == &shadow->gsv) return GSPEC;
+    if (shad == &shadow->ret) return RET;
+    if (shad == &shadow->hd) return HADDR;
+    if (shad == &shadow->io) return IADDR;
+    return ADDR_LAST;
+}
+
+// Ranges are merged only within one of these, so that each reported
+// range stays inside a single register.
+static uint64_t shad_granule(Shad *shad)
+{
+    if (shad == &shadow->llv) return MAXREGSIZE;
+    if (shad == &shadow->grv) return sizeof(target_ulong);
+    return 0;
+}
+
+struct PendingChange {
+    Shad *shad;
+    uint64_t addr;
+    uint64_t size;
+
+    bool operator<(const PendingChange &other) const {
+        return shad != other.shad ? shad < other.shad : addr < other.addr;
+    }
+};
+
+// Changes to shadows in taint_change_kinds since the last block end.
+static std::vector<PendingChange> pending_changes;
+static std::vector<TaintChange> change_batch;
+
+// Tries to grow a so it also covers b.
+static bool merge_change(PendingChange &a, const PendingChange &b)
+{
+    uint64_t g = shad_granule(a.shad);
+    uint64_t end = std::max(a.addr + a.size, b.addr + b.size);
+    if (a.shad != b.shad || b.addr > a.addr + a.size ||
+        b.addr + b.size < a.addr) {
+        return false;
+    }
+    uint64_t start = std::min(a.addr, b.addr);
+    if (g && start / g != (end - 1) / g) return false;
+    a.addr = start;
+    a.size = end - start;
+    return true;
+}
+
+/**
+ * @brief Delivers the taint changes of the block that just ran to the
+ * `on_taint_changes` PPP callbacks, sorted and merged into ranges.
+ */
+int taint_changes_after_block_exec(CPUState *cpu, TranslationBlock *tb,
+                                   uint8_t exitCode)
+{
+    if (pending_changes.empty()) return 0;
+
+    std::sort(pending_changes.begin(), pending_changes.end());
+    size_t n = 0;
+    for (size_t i = 1; i < pending_changes.size(); i++) {
+        if (!merge_change(pending_changes[n], pending_changes[i])) {
+            pending_changes[++n] = pending_changes[i];
+        }
+    }
+    pending_changes.resize(n + 1);
+
+    change_batch.clear();
+    for (auto &pc : pending_changes) {
+        TaintChange tc;
+        if (shad_to_addr(pc.shad, pc.addr, &tc.addr)) {
+            tc.size = pc.size;
+            change_batch.push_back(tc);
+        }
+    }
+    pending_changes.clear();
+
+    if (!change_batch.empty()) {
+        PPP_RUN_CB(on_taint_changes, change_batch.data(), change_batch.size());
+    }
+    return 0;
+}
+
+// Sets track_changes on the shadows someone wants to hear about, and starts
+// delivering batches once anyone subscribed to some.
+void update_taint_change_tracking(void)
+{
+    static bool batching = false;
+
+    if (!shadow) return;
+    for (Shad *shad : { &shadow->ram, &shadow->llv, &shadow->ret, &shadow->grv,
+                        &shadow->gsv, &shadow->hd, &shadow->io }) {
+        shad->track_changes = track_taint_state ||
+            (taint_change_kinds & (1u << shad_kind(shad)));
+    }
+    if (taint_change_kinds && !batching) {
+        panda_cb pcb;
+        pcb.after_block_exec = taint_changes_after_block_exec;
+        panda_register_callback(taint2_plugin, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
+        batching = true;
+    }
+}
+
+/**
+ * @brief Called by the shadow memory implementation whenever changes occur
+ * to it. Runs the registered `on_taint_change` PPP callbacks right away, and
+ * queues the change for `on_taint_changes` if its kind was subscribed to.
+ */
+void taint_state_changed(Shad *shad, uint64_t shad_addr, uint64_t size)
+{
+    if (taint_change_kinds & (1u << shad_kind(shad))) {
+        PendingChange change = { shad, shad_addr, size };
+        // Most changes extend or repeat the previous one.
+        if (pending_changes.empty() ||
+            !merge_change(pending_changes.back(), change)) {
+            pending_changes.push_back(change);
+        }
+    }
+
+    if (!PPP_CHECK_CB(on_taint_change)) return;
+
+    Addr addr;
+    if (!shad_to_addr(shad, shad_addr, &addr)) return;
 
     PPP_RUN_CB(on_taint_change, addr, size);
 }
@@ -561,12 +733,27 @@ bool init_plugin(void *self) {
     std::cerr << PANDA_MSG "taint debugging " << PANDA_FLAG_STATUS(debug_taint) << std::endl;
     detaint_cb0_bytes = panda_parse_bool_opt(args, "detaint_cb0", "detaint bytes whose control mask bits are 0");
     std::cerr << PANDA_MSG "detaint if control bits 0 " << PANDA_FLAG_STATUS(detaint_cb0_bytes) << std::endl;
+    labels_only = panda_parse_bool_opt(args, "labels_only", "track label sets only, without taint compute numbers or controlled bits");
+    std::cerr << PANDA_MSG "labels-only taint " << PANDA_FLAG_STATUS(labels_only) << std::endl;
+    if (labels_only && detaint_cb0_bytes) {
+        std::cerr << PANDA_MSG "detaint_cb0 needs controlled bits, ignoring it in labels-only mode" << std::endl;
+        detaint_cb0_bytes = false;
+    }
     max_tcn = panda_parse_uint32_opt(args, "max_taintset_compute_number", 0,
         "stop propagating taint after it goes through this number of computations (0=never stop)");
     std::cerr << PANDA_MSG "maximum taint compute number (0=unlimited) " << max_tcn << std::endl;
     max_taintset_card = panda_parse_uint32_opt(args, "max_taintset_card", 0,
         "maximum size a label set can reach before stop tracking taint on it (0=never stop)");
     std::cerr << PANDA_MSG "maximum taintset cardinality (0=unlimited) " << max_taintset_card << std::endl;
+    labelset_gc_threshold = panda_parse_uint32_opt(args, "labelset_gc", 1 << 20,
+        "garbage collect unreferenced label sets once this many exist (0=never)");
+    std::cerr << PANDA_MSG "label set gc threshold (0=never) " << labelset_gc_threshold << std::endl;
+    if (labelset_gc_threshold) {
+        labelset_gc_next = labelset_gc_threshold;
+        panda_cb pcb3;
+        pcb3.before_cpu_exec_exit = labelset_gc_before_cpu_exec_exit;
+        panda_register_callback(self, PANDA_CB_BEFORE_CPU_EXEC_EXIT, pcb3);
+    }
     
     // load dependencies
     panda_require("callstack_instr");
@@ -32,6 +32,13 @@ typedef const std::set<uint32_t> *LabelSetP;
 typedef void (*on_branch2_t) (Addr, uint64_t);
 typedef void (*on_indirect_jump_t) (Addr, uint64_t);
 typedef void (*on_taint_change_t) (Addr, uint64_t);
+
+// A merged range of shadow whose taint changed during the last block.
+struct TaintChange {
+    Addr addr;
+    uint64_t size;
+};
+typedef void (*on_taint_changes_t) (const TaintChange *, uint32_t);
 typedef void (*on_ptr_load_t) (Addr, uint64_t, uint64_t);
 typedef void (*on_ptr_store_t) (Addr, uint64_t, uint64_t);
 
@@ -39,21 +46,62 @@ typedef void (*on_ptr_store_t) (Addr, uint64_t, uint64_t);
 struct ShadowState {
     uint64_t prev_bb; // label for previous BB.
     uint32_t num_vals;
-    FastShad ram;
-    FastShad llv;  // LLVM registers, with multiple frames
-    FastShad ret;  // LLVM return value, also temp register
-    FastShad grv;  // guest general purpose registers
-    FastShad gsv;  // guest special values, like FP, and parts of CPUState
-    LazyShad hd;   // Hard Drive
-    LazyShad io;   // I/O Buffer
-
-    ShadowState()
-        : prev_bb(0), num_vals(MAXFRAMESIZE), ram("RAM", ram_size),
-          llv("LLVM", MAXFRAMESIZE * FUNCTIONFRAMES * MAXREGSIZE),
-          ret("Ret", MAXREGSIZE), grv("Reg", NUM_REGS * sizeof(target_ulong)),
-          gsv("CPUState", sizeof(CPUArchState)), hd("HD", UINT64_MAX),
-          io("IO", UINT64_MAX)
+    Shad &ram;
+    Shad &llv;  // LLVM registers, with multiple frames
+    Shad &ret;  // LLVM return value, also temp register
+    Shad &grv;  // guest general purpose registers
+    Shad &gsv;  // guest special values, like FP, and parts of CPUState
+    Shad &hd;   // Hard Drive
+    Shad &io;   // I/O Buffer
+
+    // labels_only selects the LabelsOnly shadow policy (see shad.h).
+    explicit ShadowState(bool labels_only)
+        : prev_bb(0), num_vals(MAXFRAMESIZE),
+          ram(new_fast(labels_only, "RAM", ram_size)),
+          llv(new_fast(labels_only, "LLVM", MAXFRAMESIZE * FUNCTIONFRAMES * MAXREGSIZE)),
+          ret(new_fast(labels_only, "Ret", MAXREGSIZE)),
+          grv(new_fast(labels_only, "Reg", NUM_REGS * sizeof(target_ulong))),
+          gsv(new_fast(labels_only, "CPUState", sizeof(CPUArchState))),
+          hd(new_lazy(labels_only, "HD", UINT64_MAX)),
+          io(new_lazy(labels_only, "IO", UINT64_MAX))
+    {
+    }
+
+    ~ShadowState()
+    {
+        delete &ram;
+        delete &llv;
+        delete &ret;
+        delete &grv;
+        delete &gsv;
+        delete &hd;
+        delete &io;
+    }
+
+    ShadowState(const ShadowState &) = delete;
+    ShadowState &operator=(const ShadowState &) = delete;
+
+    static Shad &new_fast(bool labels_only, std::string name, uint64_t size)
     {
+        if (labels_only) return *new FastShadT<LabelsOnly>(name, size);
+        return *new FastShadT<FullTaint>(name, size);
+    }
+
+    static Shad &new_lazy(bool labels_only, std::string name, uint64_t size)
+    {
+        if (labels_only) return *new LazyShadT<LabelsOnly>(name, size);
+        return *new LazyShadT<FullTaint>(name, size);
+    }
+
+    void mark_label_sets()
+    {
+        ram.mark_label_sets();
+        llv.mark_label_sets();
+        ret.mark_label_sets();
+        grv.mark_label_sets();
+        gsv.mark_label_sets();
+        hd.mark_label_sets();
+        io.mark_label_sets();
     }
 
     std::pair<Shad *, uint64_t> query_loc(const Addr &a)
@@ -88,6 +136,12 @@ Addr make_iaddr(uint64_t a);
 Addr make_maddr(uint64_t a);
 Addr make_laddr(uint64_t a, uint64_t o);
 Addr make_greg(uint64_t r, uint16_t off);
+
+extern bool track_taint_state;
+extern uint32_t taint_change_kinds;
 }
 
+// Applies track_taint_state and taint_change_kinds to the shadows.
+void update_taint_change_tracking(void);
+
 #endif
@@ -28,6 +28,7 @@ extern "C" {
 #define EAX ((CPUArchState*)cpu->env_ptr)->regs[R_EAX]
 #define EBX ((CPUArchState*)cpu->env_ptr)->regs[R_EBX]
 #define ECX ((CPUArchState*)cpu->env_ptr)->regs[R_ECX]
+#define EDX ((CPUArchState*)cpu->env_ptr)->regs[R_EDX]
 #define EDI ((CPUArchState*)cpu->env_ptr)->regs[R_EDI]
 #endif
 
@@ -161,26 +162,111 @@ void lava_attack_point(PandaHypercallStruct phs) {
     }
 }
 
+// Read or write the n ring slots starting at head; at most two accesses
+// since the range may wrap around the end of the ring.
+static int batch_cmds_rw(CPUState *cpu, target_ulong cmds_addr,
+                         PandaHypercallCmd *cmds, uint32_t size,
+                         uint32_t head, uint32_t n, bool is_write) {
+    uint32_t first = MIN(n, size - head);
+    if (panda_virtual_memory_rw(cpu, cmds_addr + head * sizeof(*cmds),
+                                (uint8_t *) &cmds[head],
+                                first * sizeof(*cmds), is_write) != 0) {
+        return -1;
+    }
+    if (n > first &&
+        panda_virtual_memory_rw(cpu, cmds_addr, (uint8_t *) &cmds[0],
+                                (n - first) * sizeof(*cmds), is_write) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+// Anything that doesn't look like a ring is ignored without a word, since
+// the hypercall register magic can still be hit by chance.
+void taint_batch_hypercall(CPUState *cpu, target_ulong batch_addr) {
+    PandaHypercallBatch hdr;
+    if (panda_virtual_memory_rw(cpu, batch_addr, (uint8_t *) &hdr,
+                                sizeof(hdr), false) != 0) {
+        return;
+    }
+    if (hdr.magic != TAINT2_BATCH_MAGIC || hdr.size == 0 ||
+        hdr.size > TAINT2_BATCH_MAX_CMDS ||
+        hdr.head >= hdr.size || hdr.tail >= hdr.size) {
+        return;
+    }
+
+    uint32_t n = (hdr.tail + hdr.size - hdr.head) % hdr.size;
+    if (n == 0) {
+        return;
+    }
+    target_ulong cmds_addr = batch_addr + sizeof(hdr);
+    std::vector<PandaHypercallCmd> cmds(hdr.size);
+    if (batch_cmds_rw(cpu, cmds_addr, cmds.data(), hdr.size, hdr.head, n,
+                      false) != 0) {
+        return;
+    }
+
+    for (uint32_t i = 0, slot = hdr.head; i < n; i++, slot = (slot + 1) % hdr.size) {
+        PandaHypercallCmd &cmd = cmds[slot];
+        switch (cmd.op) {
+        case TAINT2_BATCH_LABEL:
+        case TAINT2_BATCH_LABEL_POS:
+            cmd.result = taint2_label_ram_range(cpu, cmd.buf, cmd.len,
+                    cmd.label, cmd.op == TAINT2_BATCH_LABEL_POS);
+            break;
+        case TAINT2_BATCH_QUERY:
+            cmd.result = taint2_query_ram_range(cpu, cmd.buf, cmd.len);
+            break;
+        default:
+            cmd.result = TAINT2_BATCH_BAD_OP;
+            break;
+        }
+    }
+
+    // Results first, then head, so a guest polling head never sees
+    // stale results.
+    batch_cmds_rw(cpu, cmds_addr, cmds.data(), hdr.size, hdr.head, n, true);
+    hdr.head = hdr.tail;
+    panda_virtual_memory_rw(cpu, batch_addr + offsetof(PandaHypercallBatch, head),
+                            (uint8_t *) &hdr.head, sizeof(hdr.head), true);
+}
+
 int guest_hypercall_callback(CPUState *cpu) {
 #if defined(TARGET_I386)
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
+    if (!taintEnabled && (EAX == 7 || EAX == 8) &&
+        EDX == TAINT2_HYPERCALL_MAGIC) {
+        printf("Taint plugin: Label operation detected @ %lu\n", rr_get_guest_instr_count());
+        printf("Enabling taint processing\n");
+        taint2_enable_taint();
+    }
     if (taintEnabled) {
         if (EAX == 7 || EAX == 8) {
+            // real CPUID leaf 7/8 queries must not label anything
+            if (EDX != TAINT2_HYPERCALL_MAGIC) {
+                return 1;
+            }
             target_ulong buf_start = EBX;
             target_ulong buf_len = ECX;
             long label = EDI;
-            if (R_EAX == 7) {
+            if (EAX == 7) {
                 // Standard buffer label
                 printf("taint2: single taint label\n");
                 taint2_add_taint_ram_single_label(cpu, (uint64_t)buf_start,
                                                   (int)buf_len, label);
             }
-            else if (R_EAX == 8) {
+            else if (EAX == 8) {
                 // Positional buffer label
                 printf("taint2: positional taint label\n");
                 taint2_add_taint_ram_pos(cpu, (uint64_t)buf_start, (int)buf_len, label);
             }
         }
+        else if (EAX == TAINT2_HYPERCALL_BATCH) {
+            // CPUID leaf 0xA (performance monitoring) unless EDX says otherwise
+            if (EDX == TAINT2_HYPERCALL_MAGIC) {
+                taint_batch_hypercall(cpu, EBX);
+            }
+        }
         else {
             // LAVA Hypercall
             target_ulong addr = panda_virt_to_phys(cpu, env->regs[R_EAX]);
@@ -226,7 +312,8 @@ int guest_hypercall_callback(CPUState *cpu) {
     // R0 is command (label or query)
     // R1 is buf_start
     // R2 is length
-    // R3 is offset (not currently implemented)
+    // R3 is offset (not currently implemented), or TAINT2_HYPERCALL_MAGIC
+    // for a batch
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     if (env->regs[0] == 7 || env->regs[0] == 8) { //Taint label
         if (!taintEnabled) {
@@ -236,6 +323,11 @@ int guest_hypercall_callback(CPUState *cpu) {
         }
         // FIXME: do labeling here.
     }
+    else if (env->regs[0] == TAINT2_HYPERCALL_BATCH) { //Batched label/query
+        if (taintEnabled && env->regs[3] == TAINT2_HYPERCALL_MAGIC) {
+            taint_batch_hypercall(cpu, env->regs[1]);
+        }
+    }
     else if (env->regs[0] == 9) { //Query taint on label
         if (taintEnabled) {
             printf("Taint plugin: Query operation detected @ %lu\n", rr_get_guest_instr_count());
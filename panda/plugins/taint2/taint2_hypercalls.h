@@ -41,8 +41,46 @@ typedef struct panda_hypercall_struct {
     lavaint info;               // general info
     lavaint insertion_point;    // unused now.
 } PandaHypercallStruct;
+
+/* Batched hypercall. The guest keeps a ring of commands in its own memory,
+ * appends label/query commands at tail and issues a single hypercall with
+ * the ring address (EBX on x86, r1 on ARM) and TAINT2_HYPERCALL_MAGIC (EDX
+ * on x86, r3 on ARM). taint2 runs every command between head and tail,
+ * fills in result and sets head to tail. buf is 64 bits wide so that 64-bit
+ * guests can pass any address. */
+typedef struct panda_hypercall_cmd {
+    lavaint op;                 // TAINT2_BATCH_LABEL / _LABEL_POS / _QUERY
+    lavaint len;                // number of bytes
+    lavaint label;              // label, or first label if positional
+    lavaint result;             // bytes labeled, or tainted bytes found
+    uint64_t buf;               // ptr to memory to label or query
+} PandaHypercallCmd;
+
+typedef struct panda_hypercall_batch {
+    lavaint magic;              // TAINT2_BATCH_MAGIC
+    lavaint size;               // ring capacity, in commands
+    lavaint head;               // next command to run, advanced by taint2
+    lavaint tail;               // next free slot, advanced by the guest
+    // PandaHypercallCmd cmds[size] follows
+} PandaHypercallBatch;
 #pragma pack(pop)
 
+static_assert(sizeof(PandaHypercallCmd) == 24, "PandaHypercallCmd layout changed!");
+static_assert(sizeof(PandaHypercallBatch) == 16, "PandaHypercallBatch layout changed!");
+
+/* CPUID leaves 7, 8 and 0xA are also queried by ordinary guest code, so the
+ * x86 label and batch hypercalls are only taken when EDX holds this value. */
+#define TAINT2_HYPERCALL_MAGIC 0x7a1b7a1b
+
+#define TAINT2_HYPERCALL_BATCH 10
+// ring header magic, changed whenever the ring layout changes
+#define TAINT2_BATCH_MAGIC 0x7a1b0002
+#define TAINT2_BATCH_MAX_CMDS 4096
+#define TAINT2_BATCH_LABEL 1
+#define TAINT2_BATCH_LABEL_POS 2
+#define TAINT2_BATCH_QUERY 3
+#define TAINT2_BATCH_BAD_OP 0xffffffff
+
 #ifdef __cplusplus
 extern "C" {
 #endif
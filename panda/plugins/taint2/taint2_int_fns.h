@@ -89,12 +89,26 @@ void taint2_labelset_reg_iter(int reg_num, int offset, int (*app)(uint32_t el, v
 // fn should return 0 to continue iteration
 void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 
+// returns an id for the label set on this addr, 0 if untainted. two
+// addresses have the same id iff they have the same labels, as long as
+// taint2_labelset_epoch() hasn't changed in between.
+uint64_t taint2_query_labelset_id(Addr a);
+
+// changes whenever label set garbage collection frees sets, after which
+// an id may be reused for different labels
+uint64_t taint2_labelset_epoch(void);
+
 // just tells how big that labels_applied set will be
 uint32_t taint2_num_labels_applied(void);
 
 // Track whether taint state actually changed during a BB
 void taint2_track_taint_state(void);
 
+// Report taint changes to the shadows in kinds (a mask of 1 << AddrType,
+// e.g. 1 << MADDR for RAM only) through on_taint_changes, merged into
+// ranges and delivered once at the end of each block.
+void taint2_track_taint_changes(uint32_t kinds);
+
 
 // queries taint on this virtual addr and, if any taint there,
 // writes an entry to pandalog with lots of stuff like
@@ -0,0 +1,151 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+#ifndef __TAINT_AGGREGATE_H__
+#define __TAINT_AGGREGATE_H__
+
+// Aggregation of repeated taint events, for plugins such as tainted_instr
+// and tainted_branch that would otherwise log every dynamic occurrence.
+//
+// Events are keyed by (asid, pc, label sets) in an open-addressing table.
+// Each distinct key keeps its number of occurrences, the first and last
+// instruction counts it was seen at, and the labels and call stack of the
+// first occurrence. Once max_entries keys are held the plugin flushes the
+// table to its log and starts over, so memory stays bounded.
+//
+// The label sets are keyed by the ids taint2 gives them, together with the
+// label set epoch, since garbage collection can reuse an id for different
+// labels. The labels themselves are only gathered when a key is new.
+//
+// Include after taint2_ext.h.
+
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+struct TaintAggKey {
+    uint64_t asid;
+    uint64_t pc;
+    uint64_t labelsets_hash;
+    uint64_t labelset_epoch;
+
+    bool operator==(const TaintAggKey &other) const {
+        return asid == other.asid && pc == other.pc &&
+            labelsets_hash == other.labelsets_hash &&
+            labelset_epoch == other.labelset_epoch;
+    }
+};
+
+struct TaintAggEntry {
+    TaintAggKey key;
+    uint64_t count;
+    uint64_t first_instr;
+    uint64_t last_instr;
+    std::vector<uint32_t> labels;
+    std::vector<uint64_t> callers;
+    bool used;
+};
+
+static inline uint64_t taint_agg_hash(const void *data, size_t len,
+                                      uint64_t h = 0xcbf29ce484222325ULL) {
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Hash of the ids of the label sets on the bytes of [a, a+size).
+static inline uint64_t taint_agg_labelsets_hash(Addr a, uint64_t size) {
+    uint64_t h = taint_agg_hash(&size, sizeof(size));
+    for (uint64_t o = 0; o < size; o++) {
+        a.off = o;
+        uint64_t id = taint2_query_labelset_id(a);
+        h = taint_agg_hash(&id, sizeof(id), h);
+    }
+    return h;
+}
+
+static inline int taint_agg_collect_label(uint32_t el, void *labels) {
+    ((std::vector<uint32_t> *)labels)->push_back(el);
+    return 0;
+}
+
+// The labels on the bytes of [a, a+size), sorted and de-duplicated.
+static inline void taint_agg_labels(Addr a, uint64_t size,
+                                    std::vector<uint32_t> &labels) {
+    labels.clear();
+    for (uint64_t o = 0; o < size; o++) {
+        a.off = o;
+        taint2_labelset_addr_iter(a, taint_agg_collect_label, &labels);
+    }
+    std::sort(labels.begin(), labels.end());
+    labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+}
+
+class TaintAggregator {
+  public:
+    explicit TaintAggregator(size_t max_entries)
+        : slots(1), used(0), max_entries(std::max<size_t>(max_entries, 1)) {
+        // keep the load factor at or below 1/2
+        while (slots.size() < 2 * this->max_entries) slots.resize(slots.size() * 2);
+        slots.assign(slots.size(), TaintAggEntry());
+    }
+
+    // Counts one occurrence of key at instruction instr. Returns its entry;
+    // *created is set if this is the first occurrence since the last flush,
+    // in which case the caller fills in labels (see taint_agg_labels) and
+    // callers.
+    TaintAggEntry *add(const TaintAggKey &key, uint64_t instr, bool *created) {
+        size_t mask = slots.size() - 1;
+        size_t i = taint_agg_hash(&key, sizeof(key)) & mask;
+        while (slots[i].used && !(slots[i].key == key)) {
+            i = (i + 1) & mask;
+        }
+        TaintAggEntry &e = slots[i];
+        *created = !e.used;
+        if (!e.used) {
+            e.used = true;
+            e.key = key;
+            e.count = 0;
+            e.first_instr = instr;
+            used++;
+        }
+        e.count++;
+        e.last_instr = instr;
+        return &e;
+    }
+
+    bool full() const { return used >= max_entries; }
+
+    // Hands every entry to emit and empties the table.
+    template <typename F> void flush(F emit) {
+        if (!used) return;
+        for (auto &e : slots) {
+            if (!e.used) continue;
+            emit(e);
+            e.used = false;
+            e.labels.clear();
+            e.callers.clear();
+        }
+        used = 0;
+    }
+
+  private:
+    std::vector<TaintAggEntry> slots;
+    size_t used;
+    size_t max_entries;
+};
+
+#endif
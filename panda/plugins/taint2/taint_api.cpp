@@ -186,8 +186,7 @@ void taint2_label_io_additive(uint64_t ia, uint32_t l) {
     tp_label_additive(a, l);
 }
 
-void label_byte(CPUState *cpu, target_ulong virt_addr, uint32_t label_num) {
-    hwaddr pa = panda_virt_to_phys(cpu, virt_addr);
+static void label_byte_pa(target_ulong virt_addr, hwaddr pa, uint32_t label_num) {
     if (pandalog) {
         Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
         ple.has_taint_label_virtual_addr = 1;
@@ -201,6 +200,10 @@ void label_byte(CPUState *cpu, target_ulong virt_addr, uint32_t label_num) {
     taint2_label_ram(pa, label_num);
 }
 
+void label_byte(CPUState *cpu, target_ulong virt_addr, uint32_t label_num) {
+    label_byte_pa(virt_addr, panda_virt_to_phys(cpu, virt_addr), label_num);
+}
+
 
 // Apply positional taint to a buffer of memory
 void taint2_add_taint_ram_pos(CPUState *cpu, uint64_t addr, uint32_t length, uint32_t start_label){
@@ -233,6 +236,51 @@ void taint2_add_taint_ram_single_label(CPUState *cpu, uint64_t addr,
     }
 }
 
+// Label a buffer of guest memory, translating once per page rather than
+// once per byte. With positional set, byte i gets label + i. Returns the
+// number of bytes labeled; unmapped pages are skipped.
+uint32_t taint2_label_ram_range(CPUState *cpu, target_ulong addr,
+        uint32_t length, uint32_t label, bool positional) {
+    uint32_t labeled = 0;
+    uint32_t i = 0;
+    while (i < length) {
+        target_ulong va = addr + i;
+        uint32_t chunk = MIN(length - i,
+                             TARGET_PAGE_SIZE - (va & ~TARGET_PAGE_MASK));
+        hwaddr pa = panda_virt_to_phys(cpu, va);
+        if (pa != (hwaddr)(-1)) {
+            for (uint32_t j = 0; j < chunk; j++) {
+                label_byte_pa(va + j, pa + j, positional ? label + i + j : label);
+            }
+            labeled += chunk;
+        }
+        i += chunk;
+    }
+    return labeled;
+}
+
+// Returns the number of tainted bytes in a buffer of guest memory.
+uint32_t taint2_query_ram_range(CPUState *cpu, target_ulong addr,
+        uint32_t length) {
+    uint32_t num_tainted = 0;
+    uint32_t i = 0;
+    while (i < length) {
+        target_ulong va = addr + i;
+        uint32_t chunk = MIN(length - i,
+                             TARGET_PAGE_SIZE - (va & ~TARGET_PAGE_MASK));
+        hwaddr pa = panda_virt_to_phys(cpu, va);
+        if (pa != (hwaddr)(-1)) {
+            for (uint32_t j = 0; j < chunk; j++) {
+                if (tp_labelset_get(make_maddr(pa + j))) {
+                    num_tainted++;
+                }
+            }
+        }
+        i += chunk;
+    }
+    return num_tainted;
+}
+
 uint32_t taint2_query(Addr a) {
     LabelSetP ls = tp_labelset_get(a);
     return ls ? ls->size() : 0;
@@ -397,8 +445,22 @@ void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1),
     tp_ls_iter(tp_labelset_get(make_iaddr(ia)), app, stuff2);
 }
 
+uint64_t taint2_query_labelset_id(Addr a) {
+    return (uintptr_t)tp_labelset_get(a);
+}
+
+uint64_t taint2_labelset_epoch(void) {
+    return label_set_epoch();
+}
+
 void taint2_track_taint_state(void) {
     track_taint_state = true;
+    update_taint_change_tracking();
+}
+
+void taint2_track_taint_changes(uint32_t kinds) {
+    taint_change_kinds |= kinds;
+    update_taint_change_tracking();
 }
 
 #define MAX_EL_ARR_IND 1000000
@@ -429,10 +491,24 @@ static int collect_query_labels_pandalog(uint32_t el, void *stuff) {
   ugh.
 */
 
-Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
-    // used to ensure that we only write a label sets to pandalog once
-    static std::set <LabelSetP> ls_returned;
+// used to ensure that we only write a label sets to pandalog once
+static std::set <LabelSetP> ls_returned;
+
+// Called during label set gc, after marking. Label sets are identified in
+// the pandalog by address, and a set about to be freed may have its address
+// reused for different contents, so forget it here; the new set then gets
+// its own unique_label_set entry the first time it is queried.
+void taint2_prune_pandalog_label_sets(void) {
+    for (auto it = ls_returned.begin(); it != ls_returned.end();) {
+        if (label_set_marked(*it)) {
+            ++it;
+        } else {
+            it = ls_returned.erase(it);
+        }
+    }
+}
 
+Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
     LabelSetP ls = tp_labelset_get(a);
     if (ls) {
         Panda__TaintQuery *tq = (Panda__TaintQuery *) malloc(sizeof(Panda__TaintQuery));
@@ -16,10 +16,15 @@ void taint2_label_io_additive(uint64_t ia, uint32_t l);
 void taint2_add_taint_ram_pos(CPUState *cpu, uint64_t addr, uint32_t length, uint32_t start_label);
 void taint2_add_taint_ram_single_label(CPUState *cpu, uint64_t addr,
     uint32_t length, long label);
+uint32_t taint2_label_ram_range(CPUState *cpu, target_ulong addr,
+    uint32_t length, uint32_t label, bool positional);
+uint32_t taint2_query_ram_range(CPUState *cpu, target_ulong addr,
+    uint32_t length);
 void taint2_delete_ram(uint64_t pa);
 void taint2_delete_reg(int reg_num, int offset);
 void taint2_delete_io(uint64_t ia);
 
+void taint2_prune_pandalog_label_sets(void);
 Panda__TaintQuery *taint2_query_pandalog (Addr addr, uint32_t offset);
 void pandalog_taint_query_free(Panda__TaintQuery *tq);
 
@@ -50,8 +55,12 @@ void taint2_labelset_reg_iter(int reg_num, int offset, int (*app)(uint32_t el, v
 void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 void taint2_labelset_llvm_iter(int reg_num, int offset, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 
+uint64_t taint2_query_labelset_id(Addr a);
+uint64_t taint2_labelset_epoch(void);
+
 uint32_t taint2_num_labels_applied(void);
 
 void taint2_track_taint_state(void);
+void taint2_track_taint_changes(uint32_t kinds);
 }
 
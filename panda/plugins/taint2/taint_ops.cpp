@@ -129,9 +129,25 @@ static inline CBMasks compile_cb_masks(Shad *shad, uint64_t addr,
 static inline void write_cb_masks(Shad *shad, uint64_t addr, uint64_t size,
                                   CBMasks value);
 
+// Label-set-only union for the LabelsOnly policy, the full TaintData union
+// (tcn and destroyed controlled bits) otherwise.
+template <typename P>
+static inline TaintData union_td(const TaintData &td1, const TaintData &td2,
+                                 bool increment_tcn)
+{
+    if (!P::track_tcn_cb) return TaintData(label_set_union(td1.ls, td2.ls));
+    return TaintData::make_union(td1, td2, increment_tcn);
+}
+
 // Taint operations
-void taint_copy(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
-                uint64_t size, llvm::Instruction *I)
+//
+// The ops that compute taint are templates on the shadow policy (see shad.h);
+// the extern "C" entry points are the FullTaint instantiations, and
+// llvm_taint_lib.cpp maps the LabelsOnly ones in when taint2 runs with
+// labels_only.
+template <typename P>
+void taint_copy_t(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
+                  uint64_t size, llvm::Instruction *I)
 {
     if (unlikely(src >= shad_src->get_size() || dest >= shad_dest->get_size())) {
         taint_log("  Ignoring IO RW\n");
@@ -144,12 +160,14 @@ void taint_copy(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
 
     Shad::copy(shad_dest, dest, shad_src, src, size);
 
-    if (I) update_cb(shad_dest, dest, shad_src, src, size, I);
+    if (P::track_tcn_cb && I)
+        update_cb(shad_dest, dest, shad_src, src, size, I);
 }
 
-void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
-                            uint64_t src1, uint64_t src2, uint64_t src_size,
-                            llvm::Instruction *I)
+template <typename P>
+void taint_parallel_compute_t(Shad *shad, uint64_t dest, uint64_t ignored,
+                              uint64_t src1, uint64_t src2, uint64_t src_size,
+                              llvm::Instruction *I)
 {
     uint64_t shad_size = shad->get_size();
     if (unlikely(dest >= shad_size || src1 >= shad_size || src2 >= shad_size)) {
@@ -161,12 +179,14 @@ void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
             shad->name(), dest, src_size, src1, src2);
     uint64_t i;
     for (i = 0; i < src_size; ++i) {
-        TaintData td = TaintData::make_union(
+        TaintData td = union_td<P>(
                 shad->query_full(src1 + i),
                 shad->query_full(src2 + i), true);
         shad->set_full(dest + i, td);
     }
 
+    if (!P::track_tcn_cb) return;
+
     // Unlike mixed computes, parallel computes guaranteed to be bitwise.
     // This means we can honestly compute CB masks; in fact we have to because
     // of the way e.g. the deposit TCG op is lifted to LLVM.
@@ -201,15 +221,16 @@ void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
     }
 }
 
+template <typename P>
 static inline TaintData mixed_labels(Shad *shad, uint64_t addr, uint64_t size,
                                      bool increment_tcn)
 {
     TaintData td(shad->query_full(addr));
     for (uint64_t i = 1; i < size; ++i) {
-        td = TaintData::make_union(td, shad->query_full(addr + i), false);
+        td = union_td<P>(td, shad->query_full(addr + i), false);
     }
 
-    if (increment_tcn) td.increment_tcn();
+    if (P::track_tcn_cb && increment_tcn) td.increment_tcn();
     return td;
 }
 
@@ -222,13 +243,14 @@ static inline void bulk_set(Shad *shad, uint64_t addr, uint64_t size,
     }
 }
 
-void taint_mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
-                       uint64_t src1, uint64_t src2, uint64_t src_size,
-                       llvm::Instruction *ignored)
+template <typename P>
+void taint_mix_compute_t(Shad *shad, uint64_t dest, uint64_t dest_size,
+                         uint64_t src1, uint64_t src2, uint64_t src_size,
+                         llvm::Instruction *ignored)
 {
-    TaintData td = TaintData::make_union(
-            mixed_labels(shad, src1, src_size, false),
-            mixed_labels(shad, src2, src_size, false),
+    TaintData td = union_td<P>(
+            mixed_labels<P>(shad, src1, src_size, false),
+            mixed_labels<P>(shad, src2, src_size, false),
             true);
     bulk_set(shad, dest, dest_size, td);
     taint_log("mcompute: %s[%lx+%lx] <- %lx + %lx ",
@@ -236,9 +258,10 @@ void taint_mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
     taint_log_labels(shad, dest, dest_size);
 }
 
-void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
-                       uint64_t src1, uint64_t src2, uint64_t src_size,
-                       llvm::Instruction *inst, uint64_t arg1, uint64_t arg2)
+template <typename P>
+void taint_mul_compute_t(Shad *shad, uint64_t dest, uint64_t dest_size,
+                         uint64_t src1, uint64_t src2, uint64_t src_size,
+                         llvm::Instruction *inst, uint64_t arg1, uint64_t arg2)
 {
     bool isTainted1 = false;
     bool isTainted2 = false;
@@ -254,12 +277,12 @@ void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
         taint_log("mul_com: one untainted arg %lu \n", cleanArg);
         if (cleanArg == 0) return ; // mul X untainted 0 -> no taint prop
         else if (cleanArg == 1) { //mul X untainted 1(one) should be a parallel taint
-            taint_parallel_compute(shad, dest, dest_size, src1, src2,  src_size, inst);
+            taint_parallel_compute_t<P>(shad, dest, dest_size, src1, src2,  src_size, inst);
             taint_log("mul_com: mul X 1\n");
             return;
         }
     }
-    taint_mix_compute(shad, dest, dest_size, src1, src2,  src_size, inst);
+    taint_mix_compute_t<P>(shad, dest, dest_size, src1, src2,  src_size, inst);
 }
 
 void taint_delete(Shad *shad, uint64_t dest, uint64_t size)
@@ -278,16 +301,17 @@ void taint_set(Shad *shad_dest, uint64_t dest, uint64_t dest_size,
     bulk_set(shad_dest, dest, dest_size, shad_src->query_full(src));
 }
 
-void taint_mix(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
-               uint64_t src_size, llvm::Instruction *I)
+template <typename P>
+void taint_mix_t(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
+                 uint64_t src_size, llvm::Instruction *I)
 {
-    TaintData td = mixed_labels(shad, src, src_size, true);
+    TaintData td = mixed_labels<P>(shad, src, src_size, true);
     bulk_set(shad, dest, dest_size, td);
     taint_log("mix: %s[%lx+%lx] <- %lx+%lx ",
             shad->name(), dest, dest_size, src, src_size);
     taint_log_labels(shad, dest, dest_size);
 
-    if (I) update_cb(shad, dest, shad, src, dest_size, I);
+    if (P::track_tcn_cb && I) update_cb(shad, dest, shad, src, dest_size, I);
 }
 
 static const uint64_t ones = ~0UL;
@@ -298,9 +322,10 @@ void taint_pointer_run(uint64_t src, uint64_t ptr, uint64_t dest, bool is_store,
 // union that mix with each byte of the actual copied data. So if the pointer
 // is labeled [1], [2], [3], [4], and the bytes are labeled [5], [6], [7], [8],
 // we get [12345], [12346], [12347], [12348] as output taint of the load/store.
-void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
-                   uint64_t ptr_size, Shad *shad_src, uint64_t src,
-                   uint64_t size, uint64_t is_store)
+template <typename P>
+void taint_pointer_t(Shad *shad_dest, uint64_t dest, Shad *shad_ptr,
+                     uint64_t ptr, uint64_t ptr_size, Shad *shad_src,
+                     uint64_t src, uint64_t size, uint64_t is_store)
 {
     taint_log("ptr: %s[%lx+%lx] <- %s[%lx] @ %s[%lx+%lx]\n",
             shad_dest->name(), dest, size,
@@ -320,9 +345,14 @@ void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
     }
 
     // this is [1234] in our example
-    TaintData ptr_td = mixed_labels(shad_ptr, ptr, ptr_size, false);
+    TaintData ptr_td = mixed_labels<P>(shad_ptr, ptr, ptr_size, false);
     if (src == ones) {
         bulk_set(shad_dest, dest, size, ptr_td);
+    } else if (!P::track_tcn_cb) {
+        for (unsigned i = 0; i < size; i++) {
+            shad_dest->set_full(dest + i,
+                    union_td<P>(ptr_td, shad_src->query_full(src + i), false));
+        }
     } else {
         for (unsigned i = 0; i < size; i++) {
             TaintData byte_td = shad_src->query_full(src + i);
@@ -346,6 +376,69 @@ void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
     }
 }
 
+template void taint_copy_t<LabelsOnly>(Shad *, uint64_t, Shad *, uint64_t,
+                                       uint64_t, llvm::Instruction *);
+template void taint_parallel_compute_t<LabelsOnly>(Shad *, uint64_t, uint64_t,
+                                                   uint64_t, uint64_t,
+                                                   uint64_t,
+                                                   llvm::Instruction *);
+template void taint_mix_compute_t<LabelsOnly>(Shad *, uint64_t, uint64_t,
+                                              uint64_t, uint64_t, uint64_t,
+                                              llvm::Instruction *);
+template void taint_mul_compute_t<LabelsOnly>(Shad *, uint64_t, uint64_t,
+                                              uint64_t, uint64_t, uint64_t,
+                                              llvm::Instruction *, uint64_t,
+                                              uint64_t);
+template void taint_mix_t<LabelsOnly>(Shad *, uint64_t, uint64_t, uint64_t,
+                                      uint64_t, llvm::Instruction *);
+template void taint_pointer_t<LabelsOnly>(Shad *, uint64_t, Shad *, uint64_t,
+                                          uint64_t, Shad *, uint64_t,
+                                          uint64_t, uint64_t);
+
+void taint_copy(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
+                uint64_t size, llvm::Instruction *I)
+{
+    taint_copy_t<FullTaint>(shad_dest, dest, shad_src, src, size, I);
+}
+
+void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
+                            uint64_t src1, uint64_t src2, uint64_t src_size,
+                            llvm::Instruction *I)
+{
+    taint_parallel_compute_t<FullTaint>(shad, dest, ignored, src1, src2,
+                                        src_size, I);
+}
+
+void taint_mix_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
+                       uint64_t src1, uint64_t src2, uint64_t src_size,
+                       llvm::Instruction *ignored)
+{
+    taint_mix_compute_t<FullTaint>(shad, dest, dest_size, src1, src2,
+                                   src_size, ignored);
+}
+
+void taint_mul_compute(Shad *shad, uint64_t dest, uint64_t dest_size,
+                       uint64_t src1, uint64_t src2, uint64_t src_size,
+                       llvm::Instruction *inst, uint64_t arg1, uint64_t arg2)
+{
+    taint_mul_compute_t<FullTaint>(shad, dest, dest_size, src1, src2,
+                                   src_size, inst, arg1, arg2);
+}
+
+void taint_mix(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
+               uint64_t src_size, llvm::Instruction *I)
+{
+    taint_mix_t<FullTaint>(shad, dest, dest_size, src, src_size, I);
+}
+
+void taint_pointer(Shad *shad_dest, uint64_t dest, Shad *shad_ptr, uint64_t ptr,
+                   uint64_t ptr_size, Shad *shad_src, uint64_t src,
+                   uint64_t size, uint64_t is_store)
+{
+    taint_pointer_t<FullTaint>(shad_dest, dest, shad_ptr, ptr, ptr_size,
+                               shad_src, src, size, is_store);
+}
+
 void taint_sext(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
                 uint64_t src_size)
 {
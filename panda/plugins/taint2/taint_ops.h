@@ -120,6 +120,39 @@ void taint_host_delete(uint64_t env_ptr, uint64_t dest_addr, Shad *greg,
 
 } // extern "C"
 
+// Policy-specialized versions of the ops above (see FullTaint and LabelsOnly
+// in shad.h). The extern "C" ops are the FullTaint instantiations.
+struct FullTaint;
+struct LabelsOnly;
+
+template <typename P>
+void taint_copy_t(Shad *shad_dest, uint64_t dest, Shad *shad_src, uint64_t src,
+                  uint64_t size, llvm::Instruction *I);
+
+template <typename P>
+void taint_parallel_compute_t(Shad *shad, uint64_t dest, uint64_t ignored,
+                              uint64_t src1, uint64_t src2, uint64_t src_size,
+                              llvm::Instruction *I);
+
+template <typename P>
+void taint_mix_compute_t(Shad *shad, uint64_t dest, uint64_t dest_size,
+                         uint64_t src1, uint64_t src2, uint64_t src_size,
+                         llvm::Instruction *ignored);
+
+template <typename P>
+void taint_mul_compute_t(Shad *shad, uint64_t dest, uint64_t dest_size,
+                         uint64_t src1, uint64_t src2, uint64_t src_size,
+                         llvm::Instruction *inst, uint64_t arg1, uint64_t arg2);
+
+template <typename P>
+void taint_mix_t(Shad *shad, uint64_t dest, uint64_t dest_size, uint64_t src,
+                 uint64_t src_size, llvm::Instruction *I);
+
+template <typename P>
+void taint_pointer_t(Shad *shad_dest, uint64_t dest, Shad *shad_ptr,
+                     uint64_t ptr, uint64_t ptr_size, Shad *shad_src,
+                     uint64_t src, uint64_t size, uint64_t is_store);
+
 
 #define TAINT_POINTER_MODE_CHECK 2
 
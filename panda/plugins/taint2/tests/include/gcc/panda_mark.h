@@ -8,6 +8,34 @@
 const int LABEL_BUFFER = 7;
 const int LABEL_BUFFER_POS = 8;
 const int QUERY_BUFFER = 9;
+const int BATCH_BUFFER = 10;
+
+/* Must be in EDX (r3 on ARM) for taint2 to act on a hypercall; see
+ * taint2_hypercalls.h */
+#define HYPERCALL_MAGIC 0x7a1b7a1b
+
+/* Batched label/query commands, see taint2_hypercalls.h */
+#define BATCH_MAGIC 0x7a1b0002
+#define BATCH_SIZE 64
+#define BATCH_LABEL 1
+#define BATCH_LABEL_POS 2
+#define BATCH_QUERY 3
+
+struct batch_cmd {
+  unsigned int op;
+  unsigned int len;
+  unsigned int label;
+  unsigned int result;
+  unsigned long long buf;
+} __attribute__((packed));
+
+struct batch {
+  unsigned int magic;
+  unsigned int size;
+  unsigned int head;
+  unsigned int tail;
+  struct batch_cmd cmds[BATCH_SIZE];
+} __attribute__((packed));
 
 #ifdef TARGET_I386
 inline
@@ -17,24 +45,30 @@ void hypercall(unsigned long buf, unsigned long len, unsigned long off, int acti
   unsigned long ecx = len;
   unsigned long edx = off;
 
+  /* cpuid overwrites all four registers */
   asm __volatile__
-      ("push %%eax \t\n\
-        push %%ebx \t\n\
-        push %%ecx \t\n\
-        push %%edx \t\n\
-        mov  %0, %%eax \t\n\
-        mov  %1, %%ebx \t\n\
-        mov  %2, %%ecx \t\n\
-        mov  %3, %%edx \t\n\
-        cpuid \t\n\
-        pop  %%edx \t\n\
-        pop  %%ecx \t\n\
-        pop  %%ebx \t\n\
-        pop  %%eax \t\n\
-       "
-      : /* no output registers */
-      : "r" (eax), "r" (ebx), "r" (ecx), "r" (edx) /* input operands */
-      : "eax", "ebx", "ecx", "edx" /* clobbered registers */
+      ("cpuid \t\n"
+      : "+a" (eax), "+b" (ebx), "+c" (ecx), "+d" (edx)
+      : /* no other input operands */
+      : "memory"
+      );
+  return;
+}
+
+/* The label hypercalls (LABEL_BUFFER, LABEL_BUFFER_POS) also take the label,
+ * or the first label for LABEL_BUFFER_POS, in EDI. */
+inline
+void label_hypercall(unsigned long buf, unsigned long len, unsigned long label, int action) {
+  unsigned long eax = action;
+  unsigned long ebx = buf;
+  unsigned long ecx = len;
+  unsigned long edx = HYPERCALL_MAGIC;
+
+  asm __volatile__
+      ("cpuid \t\n"
+      : "+a" (eax), "+b" (ebx), "+c" (ecx), "+d" (edx)
+      : "D" (label) /* input operands */
+      : "memory"
       );
   return;
 }
@@ -67,23 +101,74 @@ void hypercall(unsigned long buf, unsigned long len, unsigned long off, int acti
 #endif // TARGET_ARM
 
 /* buf is the address of the buffer to be labeled
- * len is the length of the buffer to be labeled */
+ * len is the length of the buffer to be labeled
+ * label is the label every byte gets (x86 only, ARM doesn't label yet) */
 inline
-void label_buffer(unsigned long buf, unsigned long len) {
+void label_buffer_with(unsigned long buf, unsigned long len, unsigned long label) {
   printf("Address to be labeled: 0x%lx\n", buf);
   printf("Size in bytes: %lu\n", len);
-  hypercall(buf, len, 0, LABEL_BUFFER);
+#ifdef TARGET_I386
+  label_hypercall(buf, len, label, LABEL_BUFFER);
+#else
+  hypercall(buf, len, HYPERCALL_MAGIC, LABEL_BUFFER);
+#endif
   return;
 }
 
+inline
+void label_buffer(unsigned long buf, unsigned long len) {
+  label_buffer_with(buf, len, 0);
+}
+
 /* buf is the address of the buffer to be queried
  * len is the length of the buffer to be queried */
 inline
 void query_buffer(unsigned long buf, unsigned long len) {
   printf("Address to be queried: 0x%lx\n", buf);
   printf("Size in bytes: %lu\n", len);
-  hypercall(buf, len, 0, QUERY_BUFFER);
+  hypercall(buf, len, HYPERCALL_MAGIC, QUERY_BUFFER);
   return;
 }
 
+inline
+void batch_init(struct batch *b) {
+  b->magic = BATCH_MAGIC;
+  b->size = BATCH_SIZE;
+  b->head = 0;
+  b->tail = 0;
+}
+
+/* Run every queued command with a single hypercall, then empty the ring.
+ * taint2 stores the number of bytes labeled or found tainted in each
+ * command's result, but only when it runs: if it is loaded on the replay
+ * only, reading a result (or head) makes the replay diverge from the
+ * recording. So the ring is emptied here rather than by watching head. */
+inline
+void batch_flush(struct batch *b) {
+  asm __volatile__("" ::: "memory");
+  hypercall((unsigned long)b, 0, HYPERCALL_MAGIC, BATCH_BUFFER);
+  asm __volatile__("" ::: "memory");
+  b->head = b->tail;
+}
+
+/* Queue a command, flushing first if the ring is full. The returned
+ * command is valid until its slot is reused. */
+inline
+struct batch_cmd *batch_add(struct batch *b, unsigned int op,
+                            unsigned long buf, unsigned long len,
+                            unsigned int label) {
+  unsigned int next = (b->tail + 1) % b->size;
+  if (next == b->head) {
+    batch_flush(b);
+  }
+  struct batch_cmd *c = &b->cmds[b->tail];
+  c->op = op;
+  c->buf = buf;
+  c->len = len;
+  c->label = label;
+  c->result = 0;
+  b->tail = next;
+  return c;
+}
+
 #endif
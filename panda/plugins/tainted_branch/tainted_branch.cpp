@@ -32,6 +32,8 @@ extern "C" {
 #include "taint2/taint2_ext.h"
 }
 
+#include "taint2/taint_aggregate.h"
+
 // NB: callstack_instr_ext needs this, sadly
 #include "callstack_instr/callstack_instr.h"
 #include "callstack_instr/callstack_instr_ext.h"
@@ -58,9 +60,13 @@ void uninit_plugin(void *);
 
 bool summary = false;
 bool liveness = false;
+bool aggregate = false;
 
+#include <algorithm>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 // map from asid -> pc
 std::map<uint64_t,std::set<uint64_t>> tainted_branch;
@@ -70,7 +76,7 @@ std::map<uint64_t,std::set<uint64_t>> tainted_branch;
 typedef uint32_t Tlabel;
 
 // liveness[pos] is # of branches byte pos in file was used to decide up to this point
-std::map <Tlabel, uint64_t> liveness_map;
+std::unordered_map <Tlabel, uint64_t> liveness_map;
 
 uint64_t get_liveness(Tlabel l) {
     return liveness_map[l];
@@ -83,6 +89,44 @@ int taint_branch_aux(Tlabel ln, void *stuff) {
 }
 
 
+// aggregate mode
+TaintAggregator *agg = nullptr;
+
+void emit_aggregate(TaintAggEntry &e) {
+    Panda__CallStack cs = PANDA__CALL_STACK__INIT;
+    cs.n_addr = e.callers.size();
+    cs.addr = e.callers.data();
+    Panda__TaintedBranchAggregate tba = PANDA__TAINTED_BRANCH_AGGREGATE__INIT;
+    tba.asid = e.key.asid;
+    tba.pc = e.key.pc;
+    tba.call_stack = &cs;
+    tba.n_label = e.labels.size();
+    tba.label = e.labels.data();
+    tba.count = e.count;
+    tba.first_instr = e.first_instr;
+    tba.last_instr = e.last_instr;
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.tainted_branch_aggregate = &tba;
+    pandalog_write_entry(&ple);
+}
+
+void aggregate_tainted_branch(Addr a, uint64_t size) {
+    CPUState *cpu = first_cpu;
+    TaintAggKey key = {
+        panda_current_asid(cpu), panda_current_pc(cpu),
+        taint_agg_labelsets_hash(a, size), taint2_labelset_epoch()
+    };
+    bool created;
+    TaintAggEntry *e = agg->add(key, rr_get_guest_instr_count(), &created);
+    if (created) {
+        target_ulong callers[16];
+        uint32_t ncallers = get_callers(callers, 16, cpu);
+        taint_agg_labels(a, size, e->labels);
+        e->callers.assign(callers, callers + ncallers);
+    }
+    if (agg->full()) agg->flush(emit_aggregate);
+}
+
 void tbranch_on_branch_taint2(Addr a, uint64_t size) {
     if (pandalog) {
         // a is an llvm reg
@@ -102,7 +146,10 @@ void tbranch_on_branch_taint2(Addr a, uint64_t size) {
                     taint2_labelset_addr_iter(a, taint_branch_aux, NULL);
                 }        
             }
-            if (summary) {
+            if (aggregate) {
+                aggregate_tainted_branch(a, size);
+            }
+            else if (summary) {
                 CPUState *cpu = first_cpu;
                 target_ulong asid = panda_current_asid(cpu);
                 tainted_branch[asid].insert(panda_current_pc(cpu));
@@ -146,7 +193,13 @@ bool init_plugin(void *self) {
     summary = panda_parse_bool_opt(args, "summary", "only print out a summary of tainted instructions");
     bool indirect_jumps = panda_parse_bool_opt(args, "indirect_jumps", "also query taint on indirect jumps and calls");
     liveness = panda_parse_bool_opt(args, "liveness", "track liveness of input bytes");
-    if (summary) printf ("tainted_instr summary mode\n"); else printf ("tainted_instr full mode\n");
+    aggregate = panda_parse_bool_opt(args, "aggregate", "log each distinct (asid, pc, labels, callers) once, with counts");
+    uint64_t max_entries = panda_parse_uint64_opt(args, "max_entries", 1 << 16, "number of distinct aggregates to hold before flushing them to the log");
+    if (aggregate) {
+        printf ("tainted_branch aggregate mode\n");
+        agg = new TaintAggregator(max_entries);
+    }
+    else if (summary) printf ("tainted_instr summary mode\n"); else printf ("tainted_instr full mode\n");
     /*
     panda_cb pcb;
     pcb.after_block_exec = tbranch_after_block_exec;
@@ -160,6 +213,11 @@ bool init_plugin(void *self) {
 
 
 void uninit_plugin(void *self) {
+    if (agg) {
+        agg->flush(emit_aggregate);
+        delete agg;
+        agg = nullptr;
+    }
     if (summary) {
         Panda__TaintedBranchSummary *tbs = (Panda__TaintedBranchSummary *) malloc(sizeof(Panda__TaintedBranchSummary));
         for (auto kvp : tainted_branch) {
@@ -177,8 +235,11 @@ void uninit_plugin(void *self) {
     }
 
     if (liveness) {
+        // log in label order
+        std::vector<std::pair<Tlabel, uint64_t>> labels(liveness_map.begin(), liveness_map.end());
+        std::sort(labels.begin(), labels.end());
         Panda__LabelLiveness *ll = (Panda__LabelLiveness *)malloc(sizeof(*ll));
-        for (auto kvp : liveness_map) {
+        for (auto kvp : labels) {
             *ll = PANDA__LABEL_LIVENESS__INIT;
             ll->label = kvp.first;
             ll->count = kvp.second;
@@ -27,12 +27,15 @@ extern "C" {
 #include "taint2/taint2_ext.h"
 }
 
+#include "taint2/taint_aggregate.h"
+
 // NB: callstack_instr_ext needs this, sadly
 #include "callstack_instr/callstack_instr.h"
 #include "callstack_instr/callstack_instr_ext.h"
 
 #include <map>
 #include <set>
+#include <vector>
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -46,6 +49,7 @@ void taint_change(void);
 
 
 bool summary = false;
+bool aggregate = false;
 uint64_t num_tainted_instr = 0;
 uint64_t num_tainted_instr_observed = 0;
 bool replay_ended = false;
@@ -59,6 +63,50 @@ std::map<uint64_t,std::set<uint64_t>> tainted_instr;
 target_ulong last_asid = 0;
 target_ulong last_pc = 0;
 
+// aggregate mode
+TaintAggregator *agg = nullptr;
+
+void emit_aggregate(TaintAggEntry &e) {
+    if (!pandalog) {
+        printf ("  asid=0x%" PRIx64 " pc=0x%" PRIx64 " count=%" PRIu64
+                " instr=%" PRIu64 "..%" PRIu64 " labels=%zu\n",
+                e.key.asid, e.key.pc, e.count, e.first_instr, e.last_instr,
+                e.labels.size());
+        return;
+    }
+    Panda__CallStack cs = PANDA__CALL_STACK__INIT;
+    cs.n_addr = e.callers.size();
+    cs.addr = e.callers.data();
+    Panda__TaintedInstrAggregate tia = PANDA__TAINTED_INSTR_AGGREGATE__INIT;
+    tia.asid = e.key.asid;
+    tia.pc = e.key.pc;
+    tia.call_stack = &cs;
+    tia.n_label = e.labels.size();
+    tia.label = e.labels.data();
+    tia.count = e.count;
+    tia.first_instr = e.first_instr;
+    tia.last_instr = e.last_instr;
+    Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+    ple.tainted_instr_aggregate = &tia;
+    pandalog_write_entry(&ple);
+}
+
+void aggregate_tainted_instr(CPUState *env, Addr a, uint64_t size,
+                             target_ulong asid, target_ulong pc) {
+    TaintAggKey key = {
+        asid, pc, taint_agg_labelsets_hash(a, size), taint2_labelset_epoch()
+    };
+    bool created;
+    TaintAggEntry *e = agg->add(key, rr_get_guest_instr_count(), &created);
+    if (created) {
+        target_ulong callers[16];
+        uint32_t ncallers = get_callers(callers, 16, env);
+        taint_agg_labels(a, size, e->labels);
+        e->callers.assign(callers, callers + ncallers);
+    }
+    if (agg->full()) agg->flush(emit_aggregate);
+}
+
 void taint_change(Addr a, uint64_t size) {
     if (replay_ended) return;
     if (!replay_ended 
@@ -79,7 +127,10 @@ void taint_change(Addr a, uint64_t size) {
         num_tainted += (taint2_query(a) != 0);
     }
     if (num_tainted > 0) {            
-        if (summary) {
+        if (aggregate) {
+            aggregate_tainted_instr(env, a, size, asid, pc);
+        }
+        else if (summary) {
             tainted_instr[asid].insert(pc);
         }
         else {
@@ -112,7 +163,8 @@ void taint_change(Addr a, uint64_t size) {
             }
         }
         if (asid != last_asid) {
-            if (pandalog) {
+            // aggregates carry their asid
+            if (pandalog && !aggregate) {
                 Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
                 ple.has_asid = 1;
                 ple.asid = asid;
@@ -143,8 +195,14 @@ bool init_plugin(void *self) {
     assert (init_callstack_instr_api());
     panda_arg_list *args = panda_get_args("tainted_instr");
     summary = panda_parse_bool_opt(args, "summary", "summary tainted instruction info");
+    aggregate = panda_parse_bool_opt(args, "aggregate", "log each distinct (asid, pc, labels, callers) once, with counts");
+    uint64_t max_entries = panda_parse_uint64_opt(args, "max_entries", 1 << 16, "number of distinct aggregates to hold before flushing them to the log");
     num_tainted_instr = panda_parse_uint64_opt(args, "num", 0, "number of tainted instructions to log or summarize");
-    if (summary) printf ("tainted_instr summary mode\n");
+    if (aggregate) {
+        printf ("tainted_instr aggregate mode\n");
+        agg = new TaintAggregator(max_entries);
+    }
+    else if (summary) printf ("tainted_instr summary mode\n");
     else printf ("tainted_instr full mode\n");
     PPP_REG_CB("taint2", on_taint_change, taint_change);
     // this tells taint system to enable extra instrumentation
@@ -154,6 +212,11 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
+    if (agg) {
+        agg->flush(emit_aggregate);
+        delete agg;
+        agg = nullptr;
+    }
     if (summary) {
         Panda__TaintedInstrSummary *tis = (Panda__TaintedInstrSummary *) malloc (sizeof (Panda__TaintedInstrSummary));
         for (auto kvp : tainted_instr) {
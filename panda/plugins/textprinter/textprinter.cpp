@@ -32,7 +32,9 @@ PANDAENDCOMMENT */
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
+#include <stdarg.h>
 #include <set>
+#include <bitset>
 #include <iostream>
 #include <fstream>
 
@@ -55,11 +57,50 @@ int write_mem_callback(CPUState *env, target_ulong pc, target_ulong addr, target
 uint64_t mem_counter;
 
 std::set<prog_point> tap_points;
-gzFile read_tap_buffers;
-gzFile write_tap_buffers;
+
+// Nearly every memory access is at a PC that isn't a tap point, so the
+// accesses are first checked against a bitmap hashed from the tap point PCs.
+// Only for PCs that hit do we ask callstack_instr for the caller and look
+// up the full prog_point.
+#define TAP_PC_BITS 16
+static std::bitset<1 << TAP_PC_BITS> tap_pcs;
+
+static inline size_t tap_pc_hash(target_ulong pc) {
+    uint64_t h = (uint64_t)pc * 0x9e3779b97f4a7c15ULL;
+    return h >> (64 - TAP_PC_BITS);
+}
+
+// Tapped bytes are formatted into a buffer that's handed to zlib in large
+// writes, rather than a gzprintf per field.
+struct TapWriter {
+    gzFile f;
+    char buf[1 << 16];
+    size_t used;
+
+    void flush() {
+        if (used) gzwrite(f, buf, used);
+        used = 0;
+    }
+
+    __attribute__((format(printf, 2, 3)))
+    void append(const char *fmt, ...) {
+        if (used > sizeof(buf) - 512) flush();
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf + used, sizeof(buf) - used, fmt, ap);
+        va_end(ap);
+        if (n > 0 && (size_t)n < sizeof(buf) - used) used += n;
+    }
+};
+
+TapWriter read_tap_buffers;
+TapWriter write_tap_buffers;
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, gzFile f) {
+                       target_ulong size, void *buf, TapWriter &w) {
+    mem_counter++;
+    if (!tap_pcs[tap_pc_hash(pc)]) return 1;
+
     prog_point p = {};
     get_prog_point(env, &p);
 
@@ -68,13 +109,12 @@ int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
         int nret = get_callers(callers, 16, env);
         for (unsigned int i = 0; i < size; i++) {
             for (int j = nret-1; j > 0; j--) {
-                gzprintf(f, TARGET_FMT_lx " ", callers[j]);
+                w.append(TARGET_FMT_lx " ", callers[j]);
             }
-            gzprintf(f, TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %ld %02x\n",
-                    p.caller, p.pc, p.cr3, addr+i, mem_counter, ((unsigned char *)buf)[i]);
+            w.append(TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %" PRIu64 " %02x\n",
+                    p.caller, p.pc, p.cr3, addr+i, mem_counter - 1, ((unsigned char *)buf)[i]);
         }
     }
-    mem_counter++;
 
     return 1;
 }
@@ -105,16 +145,17 @@ bool init_plugin(void *self) {
         printf("Adding tap point (" TARGET_FMT_lx "," TARGET_FMT_lx "," TARGET_FMT_lx ")\n",
                p.caller, p.pc, p.cr3);
         tap_points.insert(p);
+        tap_pcs.set(tap_pc_hash(p.pc));
     }
     taps.close();
 
-    write_tap_buffers = gzopen("write_tap_buffers.txt.gz", "w");
-    if(!write_tap_buffers) {
+    write_tap_buffers.f = gzopen("write_tap_buffers.txt.gz", "w");
+    if(!write_tap_buffers.f) {
         printf("Couldn't open write_tap_buffers.txt for writing. Exiting.\n");
         return false;
     }
-    read_tap_buffers = gzopen("read_tap_buffers.txt.gz", "w");
-    if(!read_tap_buffers) {
+    read_tap_buffers.f = gzopen("read_tap_buffers.txt.gz", "w");
+    if(!read_tap_buffers.f) {
         printf("Couldn't open read_tap_buffers.txt for writing. Exiting.\n");
         return false;
     }
@@ -122,7 +163,6 @@ bool init_plugin(void *self) {
     panda_require("callstack_instr");
     if(!init_callstack_instr_api()) return false;
 
-    panda_enable_precise_pc();
     panda_enable_memcb();    
 
     pcb.virt_mem_after_read = mem_read_callback;
@@ -134,6 +174,8 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    gzclose(read_tap_buffers);
-    gzclose(write_tap_buffers);
+    read_tap_buffers.flush();
+    write_tap_buffers.flush();
+    gzclose(read_tap_buffers.f);
+    gzclose(write_tap_buffers.f);
 }
@@ -77,8 +77,6 @@ bool init_plugin(void *self) {
     panda_require("callstack_instr");
     if (!init_callstack_instr_api()) return false;
 
-    // Need this to get EIP with our callbacks
-    panda_enable_precise_pc();
     // Enable memory logging
     panda_enable_memcb();
 
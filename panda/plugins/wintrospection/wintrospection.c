@@ -87,6 +87,31 @@ static PTR(*get_kpcr)(CPUState *cpu);
 // Function pointer, returns handle table entry.  OS-specific.
 static HandleObject *(*get_handle_object)(CPUState *cpu, PTR eproc, uint32_t handle);
 
+// Handle cache, enabled by the handle_cache option.  Resolving a handle walks
+// the process handle table and reads the object header and name out of
+// guest memory, and callers like file_taint ask for the same handles over
+// and over.  Entries are dropped when syscalls2 sees the handle closed or
+// returned by any system call, and a process' cache is dropped when it exits
+// or its EPROCESS gets reused by another process.
+typedef struct {
+    HandleObject ho;
+    char *name;     // NULL until first asked for
+} HandleCacheEntry;
+
+typedef struct {
+    PTR objtable;           // _EPROCESS.ObjectTable when the cache was made
+    GHashTable *handles;    // handle -> HandleCacheEntry
+} ProcHandleCache;
+
+static bool handle_cache_enabled;
+static GHashTable *handle_caches; // eproc -> ProcHandleCache
+
+// The low two bits of a handle are ignored by the object manager.
+#define HANDLE_KEY(h) GUINT_TO_POINTER((h) & ~3U)
+
+#define NT_CURRENT_PROCESS    0xffffffff
+#define DUPLICATE_CLOSE_SOURCE 0x1
+
 
 char *make_pagedstr(void) {
     char *m = g_strdup("(paged)");
@@ -483,17 +508,210 @@ char *get_handle_object_name(CPUState *cpu, HandleObject *ho) {
 }
 
 
+static void free_handle_cache_entry(gpointer p) {
+    HandleCacheEntry *e = (HandleCacheEntry *)p;
+    g_free(e->name);
+    g_free(e);
+}
+
+static void free_proc_handle_cache(gpointer p) {
+    ProcHandleCache *pc = (ProcHandleCache *)p;
+    g_hash_table_destroy(pc->handles);
+    g_free(pc);
+}
+
+// Returns the handle cache of eproc, creating it if needed, or NULL if the
+// process' object table can't be read.
+static GHashTable *get_proc_handle_cache(CPUState *cpu, PTR eproc) {
+    PTR objtable = 0;
+    if (-1 == panda_virtual_memory_rw(cpu, eproc+eproc_objtable_off, (uint8_t *)&objtable, sizeof(PTR), false) || objtable == 0) {
+        return NULL;
+    }
+
+    ProcHandleCache *pc = (ProcHandleCache *)g_hash_table_lookup(handle_caches, GUINT_TO_POINTER(eproc));
+    if (pc && pc->objtable != objtable) {
+        // Same EPROCESS address, different process.
+        g_hash_table_remove(handle_caches, GUINT_TO_POINTER(eproc));
+        pc = NULL;
+    }
+    if (!pc) {
+        pc = g_new0(ProcHandleCache, 1);
+        pc->objtable = objtable;
+        pc->handles = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                            NULL, free_handle_cache_entry);
+        g_hash_table_insert(handle_caches, GUINT_TO_POINTER(eproc), pc);
+    }
+    return pc->handles;
+}
+
+// Looks a handle up in the cache, resolving and caching it on a miss.
+// Returns NULL if caching is off or the handle doesn't resolve.
+static HandleCacheEntry *get_cached_handle(CPUState *cpu, PTR eproc, uint32_t handle) {
+    if (!handle_cache_enabled) return NULL;
+
+    GHashTable *handles = get_proc_handle_cache(cpu, eproc);
+    if (!handles) return NULL;
+
+    HandleCacheEntry *e = (HandleCacheEntry *)g_hash_table_lookup(handles, HANDLE_KEY(handle));
+    if (e) return e;
+
+    HandleObject *ho = get_handle_object(cpu, eproc, handle);
+    if (!ho) return NULL;
+    e = g_new0(HandleCacheEntry, 1);
+    e->ho = *ho;
+    g_free(ho);
+    g_hash_table_insert(handles, HANDLE_KEY(handle), e);
+    return e;
+}
+
+static void forget_handle(PTR eproc, uint32_t handle) {
+    if (eproc == 0) {
+        g_hash_table_remove_all(handle_caches);
+        return;
+    }
+    ProcHandleCache *pc = (ProcHandleCache *)g_hash_table_lookup(handle_caches, GUINT_TO_POINTER(eproc));
+    if (pc) g_hash_table_remove(pc->handles, HANDLE_KEY(handle));
+}
+
+// Returns the EPROCESS a process handle of eproc refers to, or 0.
+static PTR get_handle_process(CPUState *cpu, PTR eproc, uint32_t handle) {
+    if (handle == NT_CURRENT_PROCESS) return eproc;
+    HandleObject *ho = get_handle_object(cpu, eproc, handle);
+    PTR proc = (ho && ho->objType == obj_type_process) ? ho->pObj : 0;
+    g_free(ho);
+    return proc;
+}
+
 char *get_handle_name(CPUState *cpu, PTR eproc, uint32_t handle) {
+    HandleCacheEntry *e = get_cached_handle(cpu, eproc, handle);
+    if (e) {
+        if (!e->name) {
+            char *name = get_handle_object_name(cpu, &e->ho);
+            // Don't hang on to names we couldn't read yet.
+            if (0 == strcmp(name, "(paged)")) return name;
+            e->name = name;
+        }
+        return g_strdup(e->name);
+    }
+
     HandleObject *ho = get_handle_object(cpu, eproc, handle);
-    return get_handle_object_name(cpu, ho);
+    char *name = get_handle_object_name(cpu, ho);
+    g_free(ho);
+    return name;
 }
 
 int64_t get_file_handle_pos(CPUState *cpu, PTR eproc, uint32_t handle) {
+    HandleCacheEntry *e = get_cached_handle(cpu, eproc, handle);
+    if (e) {
+        return get_file_obj_pos(cpu, e->ho.pObj);
+    }
+
     HandleObject *ho = get_handle_object(cpu, eproc, handle);
     if (!ho) {
         return -1;
     } else {
-        return get_file_obj_pos(cpu, ho->pObj);
+        int64_t pos = get_file_obj_pos(cpu, ho->pObj);
+        g_free(ho);
+        return pos;
+    }
+}
+
+// syscalls2 callbacks that keep the handle cache coherent.
+static void handle_cache_NtClose_enter(CPUState *cpu, target_ulong pc, uint32_t Handle) {
+    forget_handle(get_current_proc(cpu), Handle);
+}
+
+// A handle returned through a PHANDLE may reuse the value of one we missed
+// being closed (e.g. closed from kernel mode).
+static void forget_returned_handle(CPUState *cpu, PTR eproc, uint32_t pHandle) {
+    uint32_t handle;
+    if (pHandle == 0) return;
+    if (-1 == panda_virtual_memory_rw(cpu, pHandle, (uint8_t *)&handle, 4, false)) {
+        forget_handle(0, 0);
+        return;
+    }
+    forget_handle(eproc, handle);
+}
+
+// Where system calls return new handles.  NtCreate* and NtOpen* calls not
+// listed here return one through their first argument; arg -1 means the
+// call returns none.  NtDuplicateObject has its own callback.
+static const struct {
+    const char *name;
+    int arg;
+} handle_out_args[] = {
+    { "NtAcceptConnectPort", 0 },
+    { "NtAllocateReserveObject", 0 },
+    { "NtAlpcAcceptConnectPort", 0 },
+    { "NtAlpcConnectPort", 0 },
+    { "NtAlpcCreatePort", 0 },
+    { "NtAlpcOpenSenderProcess", 0 },
+    { "NtAlpcOpenSenderThread", 0 },
+    { "NtConnectPort", 0 },
+    { "NtCreateJobSet", -1 },
+    { "NtCreatePagingFile", -1 },
+    { "NtCreateUserProcess", 0 },
+    { "NtCreateUserProcess", 1 },
+    { "NtDuplicateToken", 5 },
+    { "NtFilterToken", 5 },
+    { "NtGetNextProcess", 4 },
+    { "NtGetNextThread", 5 },
+    { "NtOpenObjectAuditAlarm", -1 },
+    { "NtOpenProcessToken", 2 },
+    { "NtOpenProcessTokenEx", 3 },
+    { "NtOpenThreadToken", 3 },
+    { "NtOpenThreadTokenEx", 4 },
+    { "NtSecureConnectPort", 0 },
+};
+
+static void handle_cache_all_sys_return(CPUState *cpu, target_ulong pc, const syscall_info_t *call, const syscall_ctx_t *ctx) {
+    PTR eproc = get_current_proc(cpu);
+    uint32_t pHandle;
+    bool listed = false;
+    size_t i;
+
+    if (call == NULL) {
+        // syscalls2 was loaded without load-info, so we can't tell which
+        // calls return handles.
+        if (eproc) g_hash_table_remove(handle_caches, GUINT_TO_POINTER(eproc));
+        return;
+    }
+    for (i = 0; i < ARRAY_SIZE(handle_out_args); i++) {
+        if (strcmp(call->name, handle_out_args[i].name)) continue;
+        listed = true;
+        if (handle_out_args[i].arg < 0) continue;
+        memcpy(&pHandle, ctx->args[handle_out_args[i].arg], sizeof(pHandle));
+        forget_returned_handle(cpu, eproc, pHandle);
+    }
+    if (!listed && (g_str_has_prefix(call->name, "NtCreate") ||
+                    g_str_has_prefix(call->name, "NtOpen"))) {
+        memcpy(&pHandle, ctx->args[0], sizeof(pHandle));
+        forget_returned_handle(cpu, eproc, pHandle);
+    }
+}
+
+static void handle_cache_NtDuplicateObject_return(CPUState *cpu, target_ulong pc, uint32_t SourceProcessHandle, uint32_t SourceHandle, uint32_t TargetProcessHandle, uint32_t TargetHandle, uint32_t DesiredAccess, uint32_t HandleAttributes, uint32_t Options) {
+    PTR eproc = get_current_proc(cpu);
+    if (Options & DUPLICATE_CLOSE_SOURCE) {
+        forget_handle(get_handle_process(cpu, eproc, SourceProcessHandle), SourceHandle);
+    }
+    // TargetHandle lives in the caller, the handle value in the target.
+    uint32_t handle;
+    if (TargetHandle == 0) return;
+    if (-1 == panda_virtual_memory_rw(cpu, TargetHandle, (uint8_t *)&handle, 4, false)) {
+        forget_handle(0, 0);
+        return;
+    }
+    forget_handle(get_handle_process(cpu, eproc, TargetProcessHandle), handle);
+}
+
+static void handle_cache_NtTerminateProcess_enter(CPUState *cpu, target_ulong pc, uint32_t ProcessHandle, uint32_t ExitStatus) {
+    PTR eproc = get_current_proc(cpu);
+    PTR proc = ProcessHandle ? get_handle_process(cpu, eproc, ProcessHandle) : eproc;
+    if (proc == 0) {
+        g_hash_table_remove_all(handle_caches);
+    } else {
+        g_hash_table_remove(handle_caches, GUINT_TO_POINTER(proc));
     }
 }
 
@@ -569,6 +787,21 @@ bool init_plugin(void *self) {
     PPP_REG_CB("osi", on_get_processes, on_get_processes);
     PPP_REG_CB("osi", on_get_current_thread, on_get_current_thread);
 
+    panda_arg_list *args = panda_get_args("wintrospection");
+    handle_cache_enabled = panda_parse_bool_opt(args, "handle_cache", "cache handle lookups (loads syscalls2)");
+    panda_free_args(args);
+    if (handle_cache_enabled) {
+        handle_caches = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                              NULL, free_proc_handle_cache);
+        // Telling handle-returning calls apart needs their names.
+        panda_add_arg("syscalls2", "load-info=true");
+        panda_require("syscalls2");
+        PPP_REG_CB("syscalls2", on_NtClose_enter, handle_cache_NtClose_enter);
+        PPP_REG_CB("syscalls2", on_all_sys_return2, handle_cache_all_sys_return);
+        PPP_REG_CB("syscalls2", on_NtDuplicateObject_return, handle_cache_NtDuplicateObject_return);
+        PPP_REG_CB("syscalls2", on_NtTerminateProcess_enter, handle_cache_NtTerminateProcess_enter);
+    }
+
     return true;
 #else
     fprintf(stderr, "Plugin is not supported on this platform.\n");
@@ -579,6 +812,12 @@ bool init_plugin(void *self) {
 
 void uninit_plugin(void *self) {
     printf("Unloading wintrospection plugin\n");
+#ifdef TARGET_I386
+    if (handle_caches) {
+        g_hash_table_destroy(handle_caches);
+        handle_caches = NULL;
+    }
+#endif
 }
 
 /* vim: set tabstop=4 softtabstop=4 expandtab: */
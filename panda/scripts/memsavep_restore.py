@@ -0,0 +1,59 @@
+#!/usr/bin/env python2.7
+
+# Rebuilds a raw memory image from an incremental memsavep dump
+# (memsavep:incremental=1), suitable for Volatility or Rekall.
+#
+# <file>.idx holds one record per dump (all integers little-endian):
+#   header: uint32 magic "PSMV", uint32 page_size, uint64 dump,
+#           uint64 instr_count, uint64 ram_pages, uint64 npages
+#   npages entries: uint64 page, uint64 offset in <file>, uint32 length
+# length 0 is a zero page, length == page_size a raw page, anything else a
+# zlib-compressed page. Dump n is dumps 0..n applied in order.
+
+import sys
+import struct
+import zlib
+
+MEMSAVEP_IDX_MAGIC = 0x564d5350
+HEADER = struct.Struct("<IIQQQQ")
+ENTRY = struct.Struct("<QQI")
+
+if len(sys.argv) not in (3, 4):
+    print >>sys.stderr, "usage: %s <file> <out.raw> [dump number, default last]" % sys.argv[0]
+    sys.exit(1)
+
+data_name, out_name = sys.argv[1], sys.argv[2]
+want = int(sys.argv[3]) if len(sys.argv) == 4 else None
+
+with open(data_name + ".idx", 'rb') as idx, open(data_name, 'rb') as data, \
+        open(out_name, 'wb') as out:
+    created = False
+    while True:
+        raw = idx.read(HEADER.size)
+        if len(raw) < HEADER.size: break
+        magic, page_size, dump, instr_count, ram_pages, npages = HEADER.unpack(raw)
+        if magic != MEMSAVEP_IDX_MAGIC:
+            print >>sys.stderr, data_name + ".idx", "is not a memsavep index"
+            sys.exit(1)
+        if want is not None and dump > want: break
+        if not created:
+            out.truncate(ram_pages * page_size)
+            created = True
+
+        zero = '\0' * page_size
+        for _ in xrange(npages):
+            page, offset, length = ENTRY.unpack(idx.read(ENTRY.size))
+            if length == 0:
+                buf = zero
+            else:
+                data.seek(offset)
+                buf = data.read(length)
+                if length != page_size:
+                    buf = zlib.decompress(buf)
+            out.seek(page * page_size)
+            out.write(buf)
+        print "Applied dump %d (instr %d): %d pages." % (dump, instr_count, npages)
+
+    if not created:
+        print >>sys.stderr, "No dumps found."
+        sys.exit(1)
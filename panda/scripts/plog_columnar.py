@@ -0,0 +1,161 @@
+#!/usr/bin/env python2.7
+
+# Reads columnar pandalogs, as written by plog_to_columnar or
+# -pandalog-columnar. The format is described in panda/src/plog-columnar.cpp.
+#
+# List the tables and their columns:
+#   plog_columnar.py <file>
+# Print columns of a table, one row per line:
+#   plog_columnar.py <file> <table> [column ...] [--from instr] [--to instr]
+# e.g. plog_columnar.py foo.plc tainted_branch instr tainted_branch.pc
+#
+# Only the requested columns are decompressed, and row groups whose
+# instruction range falls outside --from/--to are skipped. Columns below a
+# repeated field have one value per element rather than per row; read them
+# along with their "#len" column through ColumnarPandalog.read().
+
+import sys
+import struct
+import zlib
+
+MAGIC = b"PANDACOL"
+
+I32, I64, U32, U64, F32, F64, BOOL, STRING, BYTES = range(1, 10)
+FORMATS = {I32: 'i', I64: 'q', U32: 'I', U64: 'Q', F32: 'f', F64: 'd',
+           BOOL: 'B', STRING: 'I'}
+
+class Reader(object):
+    def __init__(self, buf, pos=0):
+        self.buf = buf
+        self.pos = pos
+
+    def get(self, fmt):
+        vals = struct.unpack_from("<" + fmt, self.buf, self.pos)
+        self.pos += struct.calcsize("<" + fmt)
+        return vals if len(vals) > 1 else vals[0]
+
+    def get_str(self):
+        n = self.get("I")
+        s = self.buf[self.pos:self.pos + n]
+        self.pos += n
+        return s.decode("utf-8", "replace")
+
+class Table(object):
+    def __init__(self, name):
+        self.name = name
+        self.columns = []       # (name, type)
+        self.row_groups = []    # (num_rows, min_instr, max_instr, [chunk per column])
+
+    def num_rows(self):
+        return sum(rg[0] for rg in self.row_groups)
+
+class ColumnarPandalog(object):
+    def __init__(self, path):
+        self.f = open(path, "rb")
+        self.f.seek(-16, 2)
+        catalog_pos, magic = struct.unpack("<Q8s", self.f.read(16))
+        if magic != MAGIC:
+            raise ValueError(path + " is not a columnar pandalog")
+        end = self.f.tell() - 16
+        self.f.seek(catalog_pos)
+        r = Reader(self.f.read(end - catalog_pos))
+
+        self.tables = {}
+        for _ in range(r.get("I")):
+            t = Table(r.get_str())
+            for _ in range(r.get("I")):
+                name = r.get_str()
+                t.columns.append((name, r.get("B")))
+            for _ in range(r.get("I")):
+                num_rows, min_instr, max_instr = r.get("QQQ")
+                chunks = []
+                for _ in t.columns:
+                    num_values = r.get("Q")
+                    streams = [r.get("QII") for _ in range(3)]
+                    dict_size = r.get("I")
+                    chunks.append((num_values, streams, dict_size))
+                t.row_groups.append((num_rows, min_instr, max_instr, chunks))
+            self.tables[t.name] = t
+
+    def stream(self, s):
+        offset, zsize, size = s
+        if zsize == 0:
+            return b""
+        self.f.seek(offset)
+        return zlib.decompress(self.f.read(zsize))
+
+    def decode(self, ctype, chunk):
+        num_values, (values, nulls, dictionary), dict_size = chunk
+        buf = self.stream(values)
+        if ctype == BYTES:
+            r = Reader(buf)
+            vals = []
+            for _ in range(num_values):
+                n = r.get("I")
+                vals.append(buf[r.pos:r.pos + n])
+                r.pos += n
+        else:
+            vals = list(struct.unpack("<%d%s" % (num_values, FORMATS[ctype]), buf))
+        if ctype == STRING:
+            r = Reader(self.stream(dictionary))
+            strings = [r.get_str() for _ in range(dict_size)]
+            vals = [strings[v] for v in vals]
+        if nulls[1]:
+            bitmap = bytearray(self.stream(nulls))
+            for i in range(num_values):
+                if bitmap[i // 8] & (1 << (i % 8)):
+                    vals[i] = None
+        return vals
+
+    def read(self, table, columns, instr_from=0, instr_to=(1 << 64) - 1):
+        """ Returns {column: [values]} for the row groups of table that may
+            hold instructions instr_from..instr_to (absent values are None). """
+        t = self.tables[table]
+        index = dict((name, i) for (i, (name, _)) in enumerate(t.columns))
+        out = dict((c, []) for c in columns)
+        for (num_rows, min_instr, max_instr, chunks) in t.row_groups:
+            if num_rows and (max_instr < instr_from or min_instr > instr_to):
+                continue
+            for c in columns:
+                i = index[c]
+                out[c].extend(self.decode(t.columns[i][1], chunks[i]))
+        return out
+
+def main():
+    args = sys.argv[1:]
+    instr_from, instr_to = 0, (1 << 64) - 1
+    if "--from" in args:
+        i = args.index("--from")
+        instr_from = int(args[i + 1], 0)
+        del args[i:i + 2]
+    if "--to" in args:
+        i = args.index("--to")
+        instr_to = int(args[i + 1], 0)
+        del args[i:i + 2]
+    if not args:
+        sys.stderr.write("usage: %s <file> [table [column ...]] [--from instr] [--to instr]\n" % sys.argv[0])
+        sys.exit(1)
+
+    plog = ColumnarPandalog(args[0])
+    if len(args) == 1:
+        for name in sorted(plog.tables):
+            t = plog.tables[name]
+            print("%s: %d rows, %d row groups" % (name, t.num_rows(), len(t.row_groups)))
+            for (cname, ctype) in t.columns:
+                print("    %s" % cname)
+        return
+
+    table = args[1]
+    t = plog.tables[table]
+    repeated = [c[:-len("#len")] for (c, _) in t.columns if c.endswith("#len")]
+    per_row = [c for (c, _) in t.columns
+               if not any(c == r or c.startswith(r + ".") for r in repeated)]
+    columns = args[2:] or per_row
+    vals = plog.read(table, set(columns) | set(["instr"]), instr_from, instr_to)
+    print("\t".join(columns))
+    for i, instr in enumerate(vals["instr"]):
+        if instr_from <= instr <= instr_to:
+            print("\t".join(str(vals[c][i]) for c in columns))
+
+if __name__ == "__main__":
+    main()
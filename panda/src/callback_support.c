@@ -9,37 +9,44 @@
 #include "panda/rr/rr_log.h"
 #include "exec/cpu-common.h"
 #include "exec/ram_addr.h"
+#include "qemu/main-loop.h"
 
 void panda_callbacks_hd_transfer(CPUState *cpu, Hd_transfer_type type, uint64_t src_addr, uint64_t dest_addr, uint32_t num_bytes)
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_HD_TRANSFER);
         for (plist = panda_cbs[PANDA_CB_REPLAY_HD_TRANSFER];
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
                  plist->entry.replay_hd_transfer(cpu, type, src_addr, dest_addr, num_bytes);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
 void panda_callbacks_handle_packet(CPUState *cpu, uint8_t *buf, size_t size, uint8_t direction, uint64_t old_buf_addr) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_HANDLE_PACKET);
         for (plist = panda_cbs[PANDA_CB_REPLAY_HANDLE_PACKET];
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
                  plist->entry.replay_handle_packet(cpu, buf, size, direction, old_buf_addr);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_t src_addr, uint64_t dst_addr, uint32_t num_bytes) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_NET_TRANSFER);
         for (plist = panda_cbs[PANDA_CB_REPLAY_NET_TRANSFER];
              plist != NULL;
              plist = panda_cb_list_next(plist)) {
                  plist->entry.replay_net_transfer(cpu, type, src_addr, dst_addr, num_bytes);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -47,68 +54,96 @@ void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_
 void panda_callbacks_before_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_BEFORE_DMA);
         for (plist = panda_cbs[PANDA_CB_REPLAY_BEFORE_DMA];
              plist != NULL; plist = panda_cb_list_next(plist)) {
             plist->entry.replay_before_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
 void panda_callbacks_after_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+       bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_AFTER_DMA);
        for (plist = panda_cbs[PANDA_CB_REPLAY_AFTER_DMA];
             plist != NULL; plist = panda_cb_list_next(plist)) {
             plist->entry.replay_after_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
         }
+       panda_cb_serialize_end(serialized);
     }
 }
 
 // These are used in cpu-exec.c
 void panda_callbacks_before_block_exec(CPUState *cpu, TranslationBlock *tb) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_BEFORE_BLOCK_EXEC);
     for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.before_block_exec(cpu, tb);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 
 void panda_callbacks_after_block_exec(CPUState *cpu, TranslationBlock *tb, uint8_t exitCode) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_BLOCK_EXEC);
     for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.after_block_exec(cpu, tb, exitCode);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 
 void panda_callbacks_before_block_translate(CPUState *cpu, target_ulong pc) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_BEFORE_BLOCK_TRANSLATE);
     for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.before_block_translate(cpu, pc);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 
 void panda_callbacks_after_block_translate(CPUState *cpu, TranslationBlock *tb) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_BLOCK_TRANSLATE);
     for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.after_block_translate(cpu, tb);
     }
+    panda_cb_serialize_end(serialized);
+}
+
+static void panda_unload_requested_plugins(void) {
+    int i;
+    for (i = 0; i < MAX_PANDA_PLUGINS; i++){
+        if (panda_plugins_to_unload[i]){
+            panda_do_unload_plugin(i);
+            panda_plugins_to_unload[i] = false;
+        }
+    }
+}
+
+// With MTTCG other vCPUs may be inside plugin code, so the plugin is
+// only unloaded once all of them have left cpu_exec().
+static void panda_unload_requested_plugins_work(CPUState *cpu, run_on_cpu_data data) {
+    qemu_mutex_lock_iothread();
+    panda_unload_requested_plugins();
+    qemu_mutex_unlock_iothread();
 }
 
 void panda_before_find_fast(void) {
-    if (panda_plugin_to_unload){
-        panda_plugin_to_unload = false;
-        int i;
-        for (i = 0; i < MAX_PANDA_PLUGINS; i++){
-            if (panda_plugins_to_unload[i]){
-                panda_do_unload_plugin(i);
-                panda_plugins_to_unload[i] = false;
-            }
+    if (atomic_xchg(&panda_plugin_to_unload, false)){
+        if (qemu_tcg_mttcg_enabled()) {
+            async_safe_run_on_cpu(current_cpu, panda_unload_requested_plugins_work,
+                                  RUN_ON_CPU_NULL);
+        } else {
+            panda_unload_requested_plugins();
         }
     }
     if (panda_flush_tb()) {
@@ -120,11 +155,13 @@ void panda_before_find_fast(void) {
 bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool bb_invalidate_done, bool *invalidate) {
     panda_cb_list *plist;
     if (!bb_invalidate_done) {
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT);
         for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
             plist != NULL; plist = panda_cb_list_next(plist)) {
             *invalidate |=
                 plist->entry.before_block_exec_invalidate_opt(cpu, tb);
         }
+        panda_cb_serialize_end(serialized);
         return true;
     }
     return false;
@@ -132,41 +169,55 @@ bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool b
 
 void panda_callbacks_after_cpu_exec_enter(CPUState *cpu) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_CPU_EXEC_ENTER);
     for (plist = panda_cbs[PANDA_CB_AFTER_CPU_EXEC_ENTER];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.after_cpu_exec_enter(cpu);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 void panda_callbacks_before_cpu_exec_exit(CPUState *cpu, bool ranBlock) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_BEFORE_CPU_EXEC_EXIT);
     for (plist = panda_cbs[PANDA_CB_BEFORE_CPU_EXEC_EXIT];
          plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.before_cpu_exec_exit(cpu, ranBlock);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 // These are used in target-i386/translate.c
 bool panda_callbacks_insn_translate(CPUState *env, target_ulong pc) {
     panda_cb_list *plist;
     bool panda_exec_cb = false;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_INSN_TRANSLATE);
     for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         panda_exec_cb |= plist->entry.insn_translate(env, pc);
     }
+    panda_cb_serialize_end(serialized);
     return panda_exec_cb;
 }
 
 bool panda_callbacks_after_insn_translate(CPUState *env, target_ulong pc) {
     panda_cb_list *plist;
     bool panda_exec_cb = false;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_INSN_TRANSLATE);
     for(plist = panda_cbs[PANDA_CB_AFTER_INSN_TRANSLATE]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         panda_exec_cb |= plist->entry.after_insn_translate(env, pc);
     }
+    panda_cb_serialize_end(serialized);
     return panda_exec_cb;
 }
 
+// translate-all.c
+bool panda_has_insn_translate_callbacks(void) {
+    return panda_cbs[PANDA_CB_INSN_TRANSLATE] != NULL
+        || panda_cbs[PANDA_CB_AFTER_INSN_TRANSLATE] != NULL;
+}
+
 static inline hwaddr get_paddr(CPUState *cpu, target_ulong addr, void *ram_ptr) {
     if (!ram_ptr) {
         return panda_virt_to_phys(cpu, addr);
@@ -188,18 +239,22 @@ void panda_callbacks_before_mem_read(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      void *ram_ptr) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_VIRT_MEM_BEFORE_READ);
     for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_READ]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
                                           data_size);
     }
+    panda_cb_serialize_end(serialized);
     if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
+        serialized = panda_cb_serialize_begin(PANDA_CB_PHYS_MEM_BEFORE_READ);
         for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]; plist != NULL;
             plist = panda_cb_list_next(plist)) {
             plist->entry.phys_mem_before_read(env, env->panda_guest_pc, paddr,
                                               data_size);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -208,18 +263,22 @@ void panda_callbacks_after_mem_read(CPUState *env, target_ulong pc,
                                     target_ulong addr, uint32_t data_size,
                                     uint64_t result, void *ram_ptr) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_VIRT_MEM_AFTER_READ);
     for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
                                          data_size, &result);
     }
+    panda_cb_serialize_end(serialized);
     if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
+        serialized = panda_cb_serialize_begin(PANDA_CB_PHYS_MEM_AFTER_READ);
         for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]; plist != NULL;
             plist = panda_cb_list_next(plist)) {
             plist->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr,
                                              data_size, &result);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -228,18 +287,22 @@ void panda_callbacks_before_mem_write(CPUState *env, target_ulong pc,
                                       target_ulong addr, uint32_t data_size,
                                       uint64_t val, void *ram_ptr) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_VIRT_MEM_BEFORE_WRITE);
     for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_WRITE]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
                                            data_size, &val);
     }
+    panda_cb_serialize_end(serialized);
     if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
+        serialized = panda_cb_serialize_begin(PANDA_CB_PHYS_MEM_BEFORE_WRITE);
         for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]; plist != NULL;
             plist = panda_cb_list_next(plist)) {
             plist->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr,
                                                data_size, &val);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -248,18 +311,22 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      uint64_t val, void *ram_ptr) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_VIRT_MEM_AFTER_WRITE);
     for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
                                           data_size, &val);
     }
+    panda_cb_serialize_end(serialized);
     if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
+        serialized = panda_cb_serialize_begin(PANDA_CB_PHYS_MEM_AFTER_WRITE);
         for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]; plist != NULL;
             plist = panda_cb_list_next(plist)) {
             plist->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr,
                                               data_size, &val);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -267,44 +334,79 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
 // vl.c
 void panda_callbacks_after_machine_init(void) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_AFTER_MACHINE_INIT);
     for(plist = panda_cbs[PANDA_CB_AFTER_MACHINE_INIT]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.after_machine_init(first_cpu);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 void panda_callbacks_top_loop(void) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_TOP_LOOP);
     for(plist = panda_cbs[PANDA_CB_TOP_LOOP]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.top_loop(first_cpu);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 
 // target-i386/misc_helpers.c
 void panda_callbacks_cpuid(CPUState *env) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_GUEST_HYPERCALL);
     for(plist = panda_cbs[PANDA_CB_GUEST_HYPERCALL]; plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.guest_hypercall(env);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 
 void panda_callbacks_cpu_restore_state(CPUState *env, TranslationBlock *tb) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_CPU_RESTORE_STATE);
     for(plist = panda_cbs[PANDA_CB_CPU_RESTORE_STATE]; plist != NULL;
         plist = panda_cb_list_next(plist)) {
         plist->entry.cb_cpu_restore_state(env, tb);
     }
+    panda_cb_serialize_end(serialized);
+}
+
+// The callbacks above run under tb_lock, while exec and memory callbacks
+// may take tb_lock with the serialization lock held (e.g. a guest memory
+// write that invalidates TBs). So that both orders agree, tb_lock() takes
+// the serialization lock first on vCPU threads whenever a plugin that is
+// not MT-safe has a translation-time callback; the dispatchers then only
+// re-enter it.
+bool panda_cb_serialize_translate_begin(void) {
+    static const panda_cb_type types[] = {
+        PANDA_CB_BEFORE_BLOCK_TRANSLATE, PANDA_CB_AFTER_BLOCK_TRANSLATE,
+        PANDA_CB_INSN_TRANSLATE, PANDA_CB_AFTER_INSN_TRANSLATE,
+        PANDA_CB_CPU_RESTORE_STATE,
+    };
+    int i;
+
+    if (!current_cpu) {
+        return false;
+    }
+    for (i = 0; i < ARRAY_SIZE(types); i++) {
+        if (panda_cb_serialize_begin(types[i])) {
+            return true;
+        }
+    }
+    return false;
 }
 
 
 void panda_callbacks_asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid) {
     panda_cb_list *plist;
+    bool serialized = panda_cb_serialize_begin(PANDA_CB_ASID_CHANGED);
     for(plist = panda_cbs[PANDA_CB_ASID_CHANGED]; plist != NULL; plist = panda_cb_list_next(plist)) {
         plist->entry.asid_changed(env, old_asid, new_asid);
     }
+    panda_cb_serialize_end(serialized);
 }
 
 void panda_callbacks_serial_receive(CPUState *cpu, uint64_t fifo_addr,
@@ -312,10 +414,12 @@ void panda_callbacks_serial_receive(CPUState *cpu, uint64_t fifo_addr,
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_SERIAL_RECEIVE);
         for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_RECEIVE]; plist != NULL;
              plist = panda_cb_list_next(plist)) {
             plist->entry.replay_serial_receive(cpu, fifo_addr, value);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -324,10 +428,12 @@ void panda_callbacks_serial_read(CPUState *cpu, uint64_t fifo_addr,
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_SERIAL_READ);
         for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_READ]; plist != NULL;
              plist = panda_cb_list_next(plist)) {
             plist->entry.replay_serial_read(cpu, fifo_addr, port_addr, value);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -336,10 +442,12 @@ void panda_callbacks_serial_send(CPUState *cpu, uint64_t fifo_addr,
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_SERIAL_SEND);
         for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_SEND]; plist != NULL;
              plist = panda_cb_list_next(plist)) {
             plist->entry.replay_serial_send(cpu, fifo_addr, value);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -348,10 +456,12 @@ void panda_callbacks_serial_write(CPUState *cpu, uint64_t fifo_addr,
 {
     if (rr_mode == RR_REPLAY) {
         panda_cb_list *plist;
+        bool serialized = panda_cb_serialize_begin(PANDA_CB_REPLAY_SERIAL_WRITE);
         for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_WRITE]; plist != NULL;
              plist = panda_cb_list_next(plist)) {
             plist->entry.replay_serial_write(cpu, fifo_addr, port_addr, value);
         }
+        panda_cb_serialize_end(serialized);
     }
 }
 
@@ -22,6 +22,7 @@ PANDAENDCOMMENT */
 #include "hmp.h"
 #include "qapi/error.h"
 #include "monitor/monitor.h"
+#include "qemu/main-loop.h"
 
 #ifdef CONFIG_LLVM
 //#include "panda/panda_helper_call_morph.h"
@@ -31,18 +32,34 @@ PANDAENDCOMMENT */
 #endif
 
 #include "panda/common.h"
+#ifdef CONFIG_SOFTMMU
+#include "exec/ram_addr.h"
+#endif
 
 const gchar *panda_bool_true_strings[] =  {"y", "yes", "true", "1", NULL};
 const gchar *panda_bool_false_strings[] = {"n", "no", "false", "0", NULL};
 
-#if 0
-###########################################################
-WARNING: This is all gloriously thread-unsafe!!!
-###########################################################
-#endif
-
-// Array of pointers to PANDA callback lists, one per callback type
+// Array of pointers to PANDA callback lists, one per callback type.
+// The lists are walked without locks by every vCPU thread. Writers hold
+// panda_cbs_lock; unlinked entries are freed after an RCU grace period,
+// cpu_exec() being an RCU read-side critical section.
 panda_cb_list *panda_cbs[PANDA_CB_LAST];
+static QemuMutex panda_cbs_lock;
+
+// Number of callbacks of each type whose owner is not MT-safe
+static int panda_cbs_unsafe[PANDA_CB_LAST];
+
+// Serializes callbacks of plugins that are not MT-safe under MTTCG.
+// Always taken before the BQL.
+static QemuRecMutex panda_serial_lock;
+
+// CPUState.panda_plugin_ctx slots handed out to loaded plugins
+static unsigned long panda_ctx_slots_used;
+
+static void __attribute__((__constructor__)) panda_callbacks_init(void) {
+    qemu_mutex_init(&panda_cbs_lock);
+    qemu_rec_mutex_init(&panda_serial_lock);
+}
 
 // Storage for command line options
 const gchar *panda_argv[MAX_PANDA_PLUGIN_ARGS];
@@ -109,7 +126,11 @@ bool panda_load_plugin(const char *filename, const char *plugin_name) {
     // This allows plugins accessing handles of other plugins before
     // initialization completes. E.g. osi does a panda_require("win7x86intro"),
     // and then win7x86intro does a PPP_REG_CB("osi", ...) while initializing.
+    QEMU_BUILD_BUG_ON(ARRAY_SIZE(((CPUState *)NULL)->panda_plugin_ctx) != MAX_PANDA_PLUGINS);
     panda_plugins[nb_panda_plugins].plugin = plugin;
+    panda_plugins[nb_panda_plugins].mt_safe = false;
+    panda_plugins[nb_panda_plugins].ctx_slot = find_first_zero_bit(&panda_ctx_slots_used, MAX_PANDA_PLUGINS);
+    set_bit(panda_plugins[nb_panda_plugins].ctx_slot, &panda_ctx_slots_used);
     if (plugin_name) {
         strncpy(panda_plugins[nb_panda_plugins].name, plugin_name, 256);
     } else {
@@ -173,8 +194,23 @@ void panda_require(const char *plugin_name) {
 
     
 
+// Internal: find the metadata of a loaded plugin
+static panda_plugin *panda_find_plugin(void *plugin) {
+    for (int i = 0; i < nb_panda_plugins; i++) {
+        if (panda_plugins[i].plugin == plugin) {
+            return &panda_plugins[i];
+        }
+    }
+    return NULL;
+}
+
 // Internal: remove a plugin from the global array
 static void panda_delete_plugin(int i) {
+    CPUState *cpu;
+    CPU_FOREACH(cpu) {
+        cpu->panda_plugin_ctx[panda_plugins[i].ctx_slot] = NULL;
+    }
+    clear_bit(panda_plugins[i].ctx_slot, &panda_ctx_slots_used);
     if (i != nb_panda_plugins - 1) { // not the last element
         memmove(&panda_plugins[i], &panda_plugins[i+1], (nb_panda_plugins - i - 1)*sizeof(panda_plugin));
     }
@@ -240,24 +276,31 @@ void *panda_get_plugin_by_name(const char *plugin_name) {
  */
 void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     panda_cb_list *plist_last = NULL;
+    panda_plugin *p = panda_find_plugin(plugin);
 
     panda_cb_list *new_list = g_new0(panda_cb_list, 1);
     new_list->entry = cb;
     new_list->owner = plugin;
     new_list->enabled = true;
+    new_list->mt_safe = p && p->mt_safe;
 
+    qemu_mutex_lock(&panda_cbs_lock);
+    if (!new_list->mt_safe) {
+        atomic_inc(&panda_cbs_unsafe[type]);
+    }
     if(panda_cbs[type] != NULL) {
         for(panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
             // the same plugin can register the same callback function only once
             assert(!(plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr));
             plist_last = plist;
         }
-        plist_last->next = new_list;
         new_list->prev = plist_last;
+        atomic_rcu_set(&plist_last->next, new_list);
     }
     else {
-        panda_cbs[type] = new_list;
+        atomic_rcu_set(&panda_cbs[type], new_list);
     }
+    qemu_mutex_unlock(&panda_cbs_lock);
 }
 
 /**
@@ -271,17 +314,19 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  */
 void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     bool found = false;
+    qemu_mutex_lock(&panda_cbs_lock);
     if (panda_cbs[type] != NULL) {
         for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
             if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
                 found = true;
-                plist->enabled = false;
+                atomic_set(&plist->enabled, false);
 
                 // break out of the loop - the same plugin can register the same callback only once
                 break;
             }
         }
     }
+    qemu_mutex_unlock(&panda_cbs_lock);
     // no callback found to disable
     assert(found);
 }
@@ -297,17 +342,19 @@ void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  */
 void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     bool found = false;
+    qemu_mutex_lock(&panda_cbs_lock);
     if (panda_cbs[type] != NULL) {
         for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
             if (plist->owner == plugin && (plist->entry.cbaddr) == cb.cbaddr) {
                 found = true;
-                plist->enabled = true;
+                atomic_set(&plist->enabled, true);
 
                 // break out of the loop - the same plugin can register the same callback only once
                 break;
             }
         }
     }
+    qemu_mutex_unlock(&panda_cbs_lock);
     // no callback found to enable
     assert(found);
 }
@@ -320,6 +367,7 @@ void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
  * different.
  */
 void panda_unregister_callbacks(void *plugin) {
+    qemu_mutex_lock(&panda_cbs_lock);
     for (int i = 0; i < PANDA_CB_LAST; i++) {
         panda_cb_list *plist;
         plist = panda_cbs[i];
@@ -336,21 +384,25 @@ void panda_unregister_callbacks(void *plugin) {
                 }
                 else {
                     // Unlink this entry
-                    if (plist->prev) plist->prev->next = plist->next;
+                    if (plist->prev) atomic_rcu_set(&plist->prev->next, plist->next);
                     if (plist->next) plist->next->prev = plist->prev;
                     // new head
                     if (plist == plist_head) plist_head = plist->next;
                 }
-                // Free the entry we just unlinked
-                g_free(del_plist);
+                if (!del_plist->mt_safe) {
+                    atomic_dec(&panda_cbs_unsafe[i]);
+                }
+                // Free the entry we just unlinked once no vCPU can see it
+                g_free_rcu(del_plist, rcu);
                 // there should only be one callback in list for this plugin so done
                 done = true;
             }
             plist = plist_next;
         }
         // update head
-        panda_cbs[i] = plist_head;
+        atomic_rcu_set(&panda_cbs[i], plist_head);
     }
+    qemu_mutex_unlock(&panda_cbs_lock);
 }
 
 /**
@@ -366,7 +418,7 @@ void panda_enable_plugin(void *plugin) {
         plist = panda_cbs[i];
         while(plist != NULL) {
             if (plist->owner == plugin) {
-                plist->enabled = true;
+                atomic_set(&plist->enabled, true);
             }
             plist = plist->next;
         }
@@ -386,7 +438,7 @@ void panda_disable_plugin(void *plugin) {
         plist = panda_cbs[i];
         while(plist != NULL) {
             if (plist->owner == plugin) {
-                plist->enabled = false;
+                atomic_set(&plist->enabled, false);
             }
             plist = plist->next;
         }
@@ -397,18 +449,92 @@ void panda_disable_plugin(void *plugin) {
  * @brief Allows to navigate the callback linked list skipping disabled callbacks.
  */
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist) {
-    for (panda_cb_list* node = plist->next; plist != NULL; plist = plist->next) {
-        if (!node || node->enabled) return node;
+    for (panda_cb_list* node = atomic_rcu_read(&plist->next); node != NULL;
+         node = atomic_rcu_read(&node->next)) {
+        if (atomic_read(&node->enabled)) return node;
     }
     return NULL;
 }
 
-bool panda_flush_tb(void) {
-    if(panda_please_flush_tb) {
-        panda_please_flush_tb = false;
-        return true;
+/**
+ * @brief Declares that the callbacks of this plugin may run concurrently.
+ *
+ * A plugin calls this from init_plugin() once it keeps no unprotected
+ * global state, e.g. by using panda_get_cpu_ctx() for per-vCPU data and
+ * atomics for shared counters. Callbacks of plugins that don't are
+ * serialized when running with multi-threaded TCG.
+ */
+void panda_declare_mt_safe(void *plugin) {
+    panda_plugin *p = panda_find_plugin(plugin);
+    assert(p);
+
+    qemu_mutex_lock(&panda_cbs_lock);
+    p->mt_safe = true;
+    for (int i = 0; i < PANDA_CB_LAST; i++) {
+        for (panda_cb_list *plist = panda_cbs[i]; plist != NULL; plist = plist->next) {
+            if (plist->owner == plugin && !plist->mt_safe) {
+                plist->mt_safe = true;
+                atomic_dec(&panda_cbs_unsafe[i]);
+            }
+        }
+    }
+    qemu_mutex_unlock(&panda_cbs_lock);
+}
+
+/**
+ * @brief Enters the dispatch of callbacks of the given type.
+ *
+ * Returns true if the dispatch had to be serialized because a plugin that
+ * is not MT-safe registered a callback of this type; the result must be
+ * passed to panda_cb_serialize_end(). Outside of multi-threaded TCG this
+ * never takes a lock.
+ *
+ * The serialization lock ranks above the BQL, so a thread holding the BQL
+ * drops it while waiting. Translation-time callbacks run under tb_lock,
+ * which already serializes them with each other.
+ */
+bool panda_cb_serialize_begin(panda_cb_type type) {
+    if (!qemu_tcg_mttcg_enabled() || !atomic_read(&panda_cbs_unsafe[type])) {
+        return false;
+    }
+    if (qemu_mutex_iothread_locked()) {
+        if (qemu_rec_mutex_trylock(&panda_serial_lock)) {
+            qemu_mutex_unlock_iothread();
+            qemu_rec_mutex_lock(&panda_serial_lock);
+            qemu_mutex_lock_iothread();
+        }
+    } else {
+        qemu_rec_mutex_lock(&panda_serial_lock);
+    }
+    return true;
+}
+
+void panda_cb_serialize_end(bool serialized) {
+    if (serialized) {
+        qemu_rec_mutex_unlock(&panda_serial_lock);
     }
-    else return false;
+}
+
+/**
+ * @brief Returns the per-vCPU context pointer of a plugin.
+ *
+ * Plugins keep per-vCPU state here instead of in globals so that their
+ * callbacks can run on several vCPUs at once. The pointer is NULL until
+ * set with panda_set_cpu_ctx(); freeing it is up to the plugin.
+ */
+void *panda_get_cpu_ctx(CPUState *cpu, void *plugin) {
+    panda_plugin *p = panda_find_plugin(plugin);
+    return p ? atomic_read(&cpu->panda_plugin_ctx[p->ctx_slot]) : NULL;
+}
+
+void panda_set_cpu_ctx(CPUState *cpu, void *plugin, void *ctx) {
+    panda_plugin *p = panda_find_plugin(plugin);
+    assert(p);
+    atomic_set(&cpu->panda_plugin_ctx[p->ctx_slot], ctx);
+}
+
+bool panda_flush_tb(void) {
+    return atomic_xchg(&panda_please_flush_tb, false);
 }
 
 void panda_do_flush_tb(void) {
@@ -439,8 +565,26 @@ void panda_disable_tb_chaining(void){
     panda_tb_chaining = false;
 }
 
+void panda_enable_superblocks(uint32_t threshold) {
+    panda_do_flush_tb();
+    superblock_threshold = threshold;
+}
+
+void panda_disable_superblocks(void) {
+    panda_do_flush_tb();
+    superblock_threshold = 0;
+}
+
 #ifdef CONFIG_LLVM
 void panda_enable_llvm(void) {
+    if (qemu_tcg_mttcg_enabled()) {
+        fprintf(stderr, "PANDA: LLVM mode is not supported with multi-threaded TCG\n");
+        abort();
+    }
+    if (tiered_llvm) {
+        /* Full LLVM mode replaces tiered mode, e.g. for taint. */
+        panda_disable_tiered_llvm();
+    }
     panda_do_flush_tb();
     execute_llvm = 1;
     generate_llvm = 1;
@@ -455,6 +599,28 @@ void panda_disable_llvm(void) {
     tcg_llvm_ctx = NULL;
 }
 
+void panda_enable_tiered_llvm(uint32_t threshold) {
+    if (qemu_tcg_mttcg_enabled()) {
+        fprintf(stderr, "PANDA: LLVM mode is not supported with multi-threaded TCG\n");
+        abort();
+    }
+    if (execute_llvm || generate_llvm) {
+        fprintf(stderr, "PANDA: tiered LLVM mode is not available while LLVM mode is on\n");
+        return;
+    }
+    panda_do_flush_tb();
+    tiered_llvm = 1;
+    tiered_llvm_threshold = threshold;
+    tcg_llvm_initialize_tiered();
+}
+
+void panda_disable_tiered_llvm(void) {
+    panda_do_flush_tb();
+    tiered_llvm = 0;
+    tcg_llvm_destroy();
+    tcg_llvm_ctx = NULL;
+}
+
 void panda_enable_llvm_helpers(void) {
     init_llvm_helpers();
 }
@@ -484,6 +650,79 @@ void panda_memsavep(FILE *f) {
 #endif
 }
 
+#ifdef CONFIG_SOFTMMU
+static int panda_dirty_tracking;
+
+static void panda_dirty_lock(bool *locked) {
+    *locked = !qemu_mutex_iothread_locked();
+    if (*locked) qemu_mutex_lock_iothread();
+}
+
+static void panda_dirty_unlock(bool locked) {
+    if (locked) qemu_mutex_unlock_iothread();
+}
+#endif
+
+// Turns on the migration dirty log so panda_sync_dirty_pages() can tell which
+// pages of guest RAM have been written, by the CPU or by DMA. Calls nest.
+void panda_enable_dirty_tracking(void) {
+#ifdef CONFIG_SOFTMMU
+    bool locked;
+    if (panda_dirty_tracking++) return;
+    panda_dirty_lock(&locked);
+    memory_global_dirty_log_start();
+    panda_dirty_unlock(locked);
+#endif
+}
+
+void panda_disable_dirty_tracking(void) {
+#ifdef CONFIG_SOFTMMU
+    bool locked;
+    assert(panda_dirty_tracking > 0);
+    if (--panda_dirty_tracking) return;
+    panda_dirty_lock(&locked);
+    memory_global_dirty_log_stop();
+    panda_dirty_unlock(locked);
+#endif
+}
+
+// Sets bit n of bitmap (ram_size / TARGET_PAGE_SIZE bits) for every guest
+// physical page n below ram_size written since the previous call, and resets
+// the log. The first call after panda_enable_dirty_tracking() reports every
+// page. Returns the number of dirty pages. Must be called with the vCPUs
+// stopped, e.g. from a callback.
+uint64_t panda_sync_dirty_pages(unsigned long *bitmap) {
+    uint64_t ndirty = 0;
+#ifdef CONFIG_SOFTMMU
+    hwaddr addr = 0;
+    assert(panda_dirty_tracking);
+    rcu_read_lock();
+    while (addr < ram_size) {
+        // Work a whole RAM-contiguous run at a time so the TLBs are only
+        // reset once per run rather than once per page.
+        hwaddr xlat, l = ram_size - addr, off;
+        MemoryRegion *mr = address_space_translate(&address_space_memory,
+                                                   addr, &xlat, &l, false);
+        l = MAX(l & TARGET_PAGE_MASK, TARGET_PAGE_SIZE);
+        if (memory_region_is_ram(mr)) {
+            ram_addr_t start = memory_region_get_ram_addr(mr) + xlat;
+            for (off = 0; off < l; off += TARGET_PAGE_SIZE) {
+                if (cpu_physical_memory_get_dirty_flag(start + off,
+                            DIRTY_MEMORY_MIGRATION)) {
+                    set_bit((addr + off) >> TARGET_PAGE_BITS, bitmap);
+                    ndirty++;
+                }
+            }
+            cpu_physical_memory_test_and_clear_dirty(start, l,
+                                                     DIRTY_MEMORY_MIGRATION);
+        }
+        addr += l;
+    }
+    rcu_read_unlock();
+#endif
+    return ndirty;
+}
+
 // Parse out arguments and return them to caller
 static panda_arg_list *panda_get_args_internal(const char *plugin_name, bool check_only) {
     panda_arg_list *ret = NULL;
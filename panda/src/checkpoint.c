@@ -182,6 +182,8 @@ void panda_restore(void *opaque) {
     migration_incoming_state_destroy();
 
     first_cpu->rr_guest_instr_count = checkpoint->guest_instr_count;
+    // blocks translated before the restore don't count as current
+    first_cpu->rr_translated_instr = 0;
     first_cpu->panda_guest_pc = panda_current_pc(first_cpu);
     rr_nondet_log->bytes_read = checkpoint->nondet_log_position;
     fseek(rr_nondet_log->fp, checkpoint->nondet_log_position, SEEK_SET);
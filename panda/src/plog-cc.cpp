@@ -130,6 +130,16 @@ void PandaLog::open_write(const char* filepath, uint32_t chunk_size){
     write_entry(std::move(ple));
 }
 
+void PandaLog::open_write_columnar(const char* filepath){
+    this->columnar = new PandaLogColumnar();
+    if (!this->columnar->open(filepath)) {
+        printf("Pandalog open for write failed\n");
+        exit(1);
+    }
+    this->mode = PL_MODE_WRITE;
+    this->filename = strdup(filepath);
+}
+
 void PandaLog::open_read_bwd(const char *fname){
     open_read(fname, PL_MODE_READ_BWD);
 }
@@ -240,6 +250,13 @@ void PandaLog::add_dir_entry(){
 
 int PandaLog::close(){
 
+    if (this->columnar) {
+        int ret = this->columnar->close();
+        delete this->columnar;
+        this->columnar = NULL;
+        return ret;
+    }
+
     if (this->mode == PL_MODE_WRITE){
         write_current_chunk();
         add_dir_entry();
@@ -306,6 +323,11 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
         entry->set_instr(-1);
     }
 
+    if (this->columnar) {
+        this->columnar->write_entry(*entry);
+        return;
+    }
+
     size_t n = entry->ByteSize();
 
     // invariant: all log entries for an instruction belong in a single chunk
@@ -482,6 +504,10 @@ void pandalog_cc_init_write(const char * fname){
     globalLog.open(fname, "w");
 }
 
+void pandalog_cc_init_write_columnar(const char * fname){
+    globalLog.open_write_columnar(fname);
+}
+
 void pandalog_cc_init_read(const char * fname){
     globalLog.open(fname, "r");
 }
@@ -0,0 +1,471 @@
+/*
+  Columnar pandalog. All integers little-endian.
+
+  Header
+  ------
+  char magic[8]       "PANDACOL"
+  u32 version
+  u32 reserved
+
+  Data
+  ----
+  The compressed streams of each row group, one after another. A table's
+  row group is written once it has PLC_ROWGROUP_ROWS rows, and all of them
+  are written on close.
+
+  Catalog
+  -------
+  u32 num_tables
+  per table:
+    str name                          (u32 length, then the bytes)
+    u32 num_columns
+    per column: str name, u8 type     (see PlcType)
+    u32 num_row_groups
+    per row group:
+      u64 num_rows, u64 min_instr, u64 max_instr
+      per column:
+        u64 num_values
+        stream values, stream nulls, stream dict   (u64 offset, u32 zsize, u32 size)
+        u32 dict_size
+
+  Trailer
+  -------
+  u64 catalog position
+  char magic[8]       "PANDACOL"
+
+  Every stream is zlib-compressed. A nulls stream is a bitmap with a set bit
+  for each value that wasn't present in the entry; it is left out (zsize 0)
+  if all were. min_instr and max_instr leave out entries logged outside the
+  main loop, whose instr is -1.
+
+  Columns
+  -------
+  Every table starts with the "instr" and "pc" columns. Then come the fields
+  of each LogEntry field the table's entries set, in declaration order, with
+  submessages flattened into dotted names ("tainted_branch.call_stack.addr").
+  A value is stored for each row, except below a repeated field: that has a
+  "<name>#len" column with its number of elements, and the columns below it
+  hold one value (or nested group) per element.
+*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "panda/plog-columnar.hpp"
+
+using namespace google::protobuf;
+
+static size_t plc_type_size(PlcType type) {
+    switch (type) {
+        case PLC_I64:
+        case PLC_U64:
+        case PLC_F64:
+            return 8;
+        case PLC_BOOL:
+            return 1;
+        default:
+            return 4;
+    }
+}
+
+static PlcType plc_type(const FieldDescriptor *f) {
+    switch (f->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32:  return PLC_I32;
+        case FieldDescriptor::CPPTYPE_INT64:  return PLC_I64;
+        case FieldDescriptor::CPPTYPE_UINT32: return PLC_U32;
+        case FieldDescriptor::CPPTYPE_UINT64: return PLC_U64;
+        case FieldDescriptor::CPPTYPE_FLOAT:  return PLC_F32;
+        case FieldDescriptor::CPPTYPE_DOUBLE: return PLC_F64;
+        case FieldDescriptor::CPPTYPE_BOOL:   return PLC_BOOL;
+        case FieldDescriptor::CPPTYPE_ENUM:   return PLC_I32;
+        case FieldDescriptor::CPPTYPE_STRING:
+            return f->type() == FieldDescriptor::TYPE_BYTES ? PLC_BYTES : PLC_STRING;
+        default:
+            break;
+    }
+    assert(false && "not a scalar field");
+    abort();
+}
+
+void PlcColumn::put(const void *v, size_t n) {
+    if (num_values % 8 == 0) nulls.push_back(0);
+    values.append((const char *) v, n);
+    num_values++;
+}
+
+void PlcColumn::put_null(size_t n) {
+    if (num_values % 8 == 0) nulls.push_back(0);
+    nulls.back() |= 1 << (num_values % 8);
+    any_null = true;
+    values.append(n, '\0');
+    num_values++;
+}
+
+void PlcColumn::put_string(const std::string &s) {
+    auto it = dict_index.find(s);
+    uint32_t ind;
+    if (it == dict_index.end()) {
+        ind = dict_index.size();
+        dict_index[s] = ind;
+        uint32_t len = s.size();
+        dict.append((const char *) &len, sizeof(len));
+        dict.append(s);
+    } else {
+        ind = it->second;
+    }
+    put(&ind, sizeof(ind));
+}
+
+void PlcColumn::put_bytes(const std::string &s) {
+    uint32_t len = s.size();
+    put(&len, sizeof(len));
+    values.append(s);
+}
+
+void PlcColumn::reset() {
+    values.clear();
+    nulls.clear();
+    any_null = false;
+    num_values = 0;
+    dict_index.clear();
+    dict.clear();
+}
+
+bool PandaLogColumnar::open(const char *path, uint64_t rowgroup_rows) {
+    this->file = fopen(path, "wb");
+    if (!this->file) {
+        perror(path);
+        return false;
+    }
+    this->filename = path;
+    this->rowgroup_rows = rowgroup_rows ? rowgroup_rows : PLC_ROWGROUP_ROWS;
+
+    uint32_t version = PLC_VERSION, reserved = 0;
+    fwrite(PLC_MAGIC, 8, 1, this->file);
+    fwrite(&version, sizeof(version), 1, this->file);
+    fwrite(&reserved, sizeof(reserved), 1, this->file);
+    return true;
+}
+
+size_t PandaLogColumnar::width(const Descriptor *d) {
+    auto it = this->widths.find(d);
+    if (it != this->widths.end()) return it->second;
+
+    size_t w = 0;
+    for (int i = 0; i < d->field_count(); i++) {
+        w += width(d->field(i));
+    }
+    this->widths[d] = w;
+    return w;
+}
+
+size_t PandaLogColumnar::width(const FieldDescriptor *f) {
+    size_t w = f->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE ? width(f->message_type()) : 1;
+    return f->is_repeated() ? w + 1 : w;
+}
+
+void PandaLogColumnar::add_columns(PlcTable *t, const FieldDescriptor *f,
+        const std::string &prefix, std::vector<const Descriptor *> &path) {
+    std::string name = prefix + f->name();
+
+    if (f->is_repeated()) {
+        PlcColumn len = {};
+        len.name = name + "#len";
+        len.type = PLC_U32;
+        t->columns.push_back(len);
+    }
+
+    if (f->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+        PlcColumn c = {};
+        c.name = name;
+        c.type = plc_type(f);
+        t->columns.push_back(c);
+        return;
+    }
+
+    const Descriptor *d = f->message_type();
+    for (const Descriptor *p : path) {
+        if (p == d) {
+            fprintf(stderr, "plog-columnar: message %s is recursive, can't flatten it\n",
+                    d->full_name().c_str());
+            abort();
+        }
+    }
+    path.push_back(d);
+    for (int i = 0; i < d->field_count(); i++) {
+        add_columns(t, d->field(i), name + ".", path);
+    }
+    path.pop_back();
+}
+
+PlcTable *PandaLogColumnar::get_table(const panda::LogEntry &entry,
+        std::vector<const FieldDescriptor *> &set) {
+    std::vector<const FieldDescriptor *> fields;
+    entry.GetReflection()->ListFields(entry, &fields);
+
+    std::string name;
+    set.clear();
+    for (const FieldDescriptor *f : fields) {
+        if (f->name() == "pc" || f->name() == "instr") continue;
+        if (!name.empty()) name += "+";
+        name += f->name();
+        set.push_back(f);
+    }
+    if (set.empty()) return NULL;
+
+    auto it = this->tables_by_name.find(name);
+    if (it != this->tables_by_name.end()) return it->second;
+
+    PlcTable *t = new PlcTable();
+    t->name = name;
+    t->fields = set;
+    t->cur = { 0, UINT64_MAX, 0 };
+    PlcColumn instr = {}, pc = {};
+    instr.name = "instr";
+    instr.type = PLC_U64;
+    pc.name = "pc";
+    pc.type = PLC_U64;
+    t->columns.push_back(instr);
+    t->columns.push_back(pc);
+
+    std::vector<const Descriptor *> path;
+    for (const FieldDescriptor *f : set) {
+        add_columns(t, f, "", path);
+    }
+
+    this->tables.push_back(std::unique_ptr<PlcTable>(t));
+    this->tables_by_name[name] = t;
+    return t;
+}
+
+void PandaLogColumnar::put_scalar(PlcColumn &c, const Message &m,
+        const FieldDescriptor *f, int index) {
+    const Reflection *r = m.GetReflection();
+    bool rep = index >= 0;
+
+    switch (f->cpp_type()) {
+        case FieldDescriptor::CPPTYPE_INT32: {
+            int32_t v = rep ? r->GetRepeatedInt32(m, f, index) : r->GetInt32(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_INT64: {
+            int64_t v = rep ? r->GetRepeatedInt64(m, f, index) : r->GetInt64(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_UINT32: {
+            uint32_t v = rep ? r->GetRepeatedUInt32(m, f, index) : r->GetUInt32(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_UINT64: {
+            uint64_t v = rep ? r->GetRepeatedUInt64(m, f, index) : r->GetUInt64(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_FLOAT: {
+            float v = rep ? r->GetRepeatedFloat(m, f, index) : r->GetFloat(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_DOUBLE: {
+            double v = rep ? r->GetRepeatedDouble(m, f, index) : r->GetDouble(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_BOOL: {
+            uint8_t v = rep ? r->GetRepeatedBool(m, f, index) : r->GetBool(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_ENUM: {
+            int32_t v = rep ? r->GetRepeatedEnumValue(m, f, index) : r->GetEnumValue(m, f);
+            c.put(&v, sizeof(v));
+            break;
+        }
+        case FieldDescriptor::CPPTYPE_STRING: {
+            std::string s = rep ? r->GetRepeatedString(m, f, index) : r->GetString(m, f);
+            if (c.type == PLC_BYTES) {
+                c.put_bytes(s);
+            } else {
+                c.put_string(s);
+            }
+            break;
+        }
+        default:
+            assert(false && "not a scalar field");
+    }
+}
+
+// Puts the values of field f of m (NULL if m itself is absent) into the
+// columns starting at col. Returns the column after them.
+size_t PandaLogColumnar::put_field(PlcTable *t, const Message *m,
+        const FieldDescriptor *f, size_t col) {
+    const Reflection *r = m ? m->GetReflection() : NULL;
+    bool is_message = f->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE;
+
+    if (f->is_repeated()) {
+        PlcColumn &len = t->columns[col];
+        if (!m) {
+            len.put_null(sizeof(uint32_t));
+            return col + width(f);
+        }
+        uint32_t n = r->FieldSize(*m, f);
+        len.put(&n, sizeof(n));
+        for (uint32_t i = 0; i < n; i++) {
+            if (is_message) {
+                put_message(t, &r->GetRepeatedMessage(*m, f, i), f->message_type(), col + 1);
+            } else {
+                put_scalar(t->columns[col + 1], *m, f, i);
+            }
+        }
+        return col + width(f);
+    }
+
+    if (is_message) {
+        const Message *sub = (m && r->HasField(*m, f)) ? &r->GetMessage(*m, f) : NULL;
+        put_message(t, sub, f->message_type(), col);
+        return col + width(f);
+    }
+
+    PlcColumn &c = t->columns[col];
+    if (m && r->HasField(*m, f)) {
+        put_scalar(c, *m, f, -1);
+    } else {
+        c.put_null(plc_type_size(c.type));
+    }
+    return col + 1;
+}
+
+void PandaLogColumnar::put_message(PlcTable *t, const Message *m,
+        const Descriptor *d, size_t col) {
+    for (int i = 0; i < d->field_count(); i++) {
+        col = put_field(t, m, d->field(i), col);
+    }
+}
+
+void PandaLogColumnar::write_entry(const panda::LogEntry &entry) {
+    std::vector<const FieldDescriptor *> set;
+    PlcTable *t = get_table(entry, set);
+    // entries that set nothing, like the empty one every pandalog starts with
+    if (!t) return;
+
+    uint64_t instr = entry.instr(), pc = entry.pc();
+    t->columns[0].put(&instr, sizeof(instr));
+    t->columns[1].put(&pc, sizeof(pc));
+    size_t col = 2;
+    for (const FieldDescriptor *f : t->fields) {
+        col = put_field(t, &entry, f, col);
+    }
+    assert(col == t->columns.size());
+
+    if (instr != UINT64_MAX) {
+        if (instr < t->cur.min_instr) t->cur.min_instr = instr;
+        if (instr > t->cur.max_instr) t->cur.max_instr = instr;
+    }
+    if (++t->cur.num_rows >= this->rowgroup_rows) {
+        flush_row_group(t);
+    }
+}
+
+PlcStream PandaLogColumnar::write_stream(const void *buf, size_t size) {
+    PlcStream s = { (uint64_t) ftell(this->file), 0, (uint32_t) size };
+    if (size == 0) return s;
+
+    uLongf zsize = compressBound(size);
+    std::vector<Bytef> zbuf(zsize);
+    int ret = compress2(zbuf.data(), &zsize, (const Bytef *) buf, size, Z_DEFAULT_COMPRESSION);
+    assert(ret == Z_OK);
+    fwrite(zbuf.data(), zsize, 1, this->file);
+    s.zsize = zsize;
+    return s;
+}
+
+void PandaLogColumnar::flush_row_group(PlcTable *t) {
+    if (t->cur.num_rows == 0) return;
+
+    for (PlcColumn &c : t->columns) {
+        PlcColumnChunk chunk = {};
+        chunk.num_values = c.num_values;
+        chunk.values = write_stream(c.values.data(), c.values.size());
+        if (c.any_null) {
+            chunk.nulls = write_stream(c.nulls.data(), c.nulls.size());
+        }
+        if (c.type == PLC_STRING) {
+            chunk.dict = write_stream(c.dict.data(), c.dict.size());
+            chunk.dict_size = c.dict_index.size();
+        }
+        c.chunks.push_back(chunk);
+        c.reset();
+    }
+    t->row_groups.push_back(t->cur);
+    t->cur = { 0, UINT64_MAX, 0 };
+}
+
+static void plc_put_u8(FILE *f, uint8_t v) { fwrite(&v, sizeof(v), 1, f); }
+static void plc_put_u32(FILE *f, uint32_t v) { fwrite(&v, sizeof(v), 1, f); }
+static void plc_put_u64(FILE *f, uint64_t v) { fwrite(&v, sizeof(v), 1, f); }
+
+static void plc_put_str(FILE *f, const std::string &s) {
+    plc_put_u32(f, s.size());
+    fwrite(s.data(), s.size(), 1, f);
+}
+
+static void plc_put_stream(FILE *f, const PlcStream &s) {
+    plc_put_u64(f, s.offset);
+    plc_put_u32(f, s.zsize);
+    plc_put_u32(f, s.size);
+}
+
+void PandaLogColumnar::write_catalog() {
+    FILE *f = this->file;
+
+    plc_put_u32(f, this->tables.size());
+    for (auto &t : this->tables) {
+        plc_put_str(f, t->name);
+        plc_put_u32(f, t->columns.size());
+        for (PlcColumn &c : t->columns) {
+            plc_put_str(f, c.name);
+            plc_put_u8(f, c.type);
+        }
+        plc_put_u32(f, t->row_groups.size());
+        for (size_t i = 0; i < t->row_groups.size(); i++) {
+            PlcRowGroup &rg = t->row_groups[i];
+            plc_put_u64(f, rg.num_rows);
+            plc_put_u64(f, rg.min_instr);
+            plc_put_u64(f, rg.max_instr);
+            for (PlcColumn &c : t->columns) {
+                PlcColumnChunk &chunk = c.chunks[i];
+                plc_put_u64(f, chunk.num_values);
+                plc_put_stream(f, chunk.values);
+                plc_put_stream(f, chunk.nulls);
+                plc_put_stream(f, chunk.dict);
+                plc_put_u32(f, chunk.dict_size);
+            }
+        }
+    }
+}
+
+int PandaLogColumnar::close() {
+    if (!this->file) return -1;
+
+    uint64_t rows = 0;
+    for (auto &t : this->tables) {
+        flush_row_group(t.get());
+        for (PlcRowGroup &rg : t->row_groups) rows += rg.num_rows;
+    }
+
+    uint64_t catalog_pos = ftell(this->file);
+    write_catalog();
+    plc_put_u64(this->file, catalog_pos);
+    fwrite(PLC_MAGIC, 8, 1, this->file);
+
+    printf("columnar pandalog %s: %zu tables, %lu rows\n",
+            this->filename.c_str(), this->tables.size(), rows);
+
+    int ret = fclose(this->file);
+    this->file = NULL;
+    return ret;
+}
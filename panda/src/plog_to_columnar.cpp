@@ -0,0 +1,52 @@
+
+/*
+ * Converts a pandalog to the columnar format (see plog-columnar.cpp), so
+ * that analyses can read just the tables and columns they need, e.g. with
+ * panda/scripts/plog_columnar.py.
+ *
+ * USAGE: plog_to_columnar <plog> <columnar plog> [rows per row group]
+ *
+ * To write the columnar format directly during a replay, use
+ * -pandalog-columnar instead of -pandalog.
+ *
+*/
+
+#include <fstream>
+#include "panda/plog-cc.hpp"
+
+/* plog-cc.cpp dependencies, as in plog_reader.cpp. */
+
+int panda_in_main_loop = 0;
+struct CPUTailQ cpus;
+
+target_ulong panda_current_pc(CPUState *env) {
+    assert(false);
+}
+
+/* *** */
+
+int main (int argc, char **argv) {
+
+    memset(&cpus, 0, sizeof(cpus));
+
+    if (argc < 3) {
+         printf("USAGE: %s <plog> <columnar plog> [rows per row group]\n", argv[0]);
+         exit(1);
+    }
+    uint64_t rowgroup_rows = argc > 3 ? strtoull(argv[3], NULL, 0) : PLC_ROWGROUP_ROWS;
+
+    PandaLogColumnar out;
+    if (!out.open(argv[2], rowgroup_rows)) {
+        exit(1);
+    }
+
+    PandaLog p;
+    p.open_read_fwd((const char *) argv[1]);
+    std::unique_ptr<panda::LogEntry> ple;
+    while ((ple = p.read_entry()) != NULL) {
+        out.write_entry(*ple);
+    }
+    p.close();
+
+    return out.close() ? 1 : 0;
+}
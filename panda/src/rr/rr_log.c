@@ -34,6 +34,7 @@
 #include <sys/stat.h>
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include <libgen.h>
@@ -54,6 +55,8 @@
 #include "panda/callback_support.h"
 #include "exec/gdbstub.h"
 #include "sysemu/cpus.h"
+#include "qemu/cutils.h"
+#include "exec/cpu-common.h"
 
 /******************************************************************************************/
 /* GLOBALS */
@@ -111,6 +114,10 @@ volatile sig_atomic_t rr_end_replay_requested = 0;
 char* rr_requested_name = NULL;
 char* rr_snapshot_name = NULL;
 
+// Set by -replay-shared: replays map the guest RAM image and the nondet log
+// read-only from files shared by every replay of the same recording.
+int rr_replay_shared = 0;
+
 unsigned rr_next_progress = 1;
 
 //
@@ -529,32 +536,111 @@ void rr_device_mem_unmap_call_record(hwaddr addr, const uint8_t* buf,
     });
 }
 
-
-static inline uint32_t rr_chunked_crc32(void *ptr, size_t len) {
-    uint32_t crc = crc32(0, Z_NULL, 0);
-    target_ulong offset = 0;
-    size_t remaining = len;
-    while (remaining > 0) {
-        uint32_t sz = remaining >= UINT32_MAX ? UINT32_MAX : (uint32_t)remaining;
-        crc = crc32(crc, ptr+offset, sz);
-        remaining -= sz;
-        offset += sz;
+// DMA mappings that devices write into (address_space_map with is_write)
+// are tracked while recording, keyed by host pointer. Devices may write
+// through the mapping before unmapping it, and those writes never reach
+// the dirty memory bitmap, so at the end of each main loop iteration every
+// page is compared against a copy taken when it was last logged, and only
+// the runs of pages that changed are logged. Mappings that devices only
+// read from can't change guest memory and aren't tracked at all.
+typedef struct RR_MapList {
+    void* ptr;
+    hwaddr addr;
+    hwaddr len;
+    uint8_t* shadow; // contents as of the last time the region was logged
+    struct RR_MapList* next; // another mapping of the same host pointer
+} RR_MapList;
+
+static GHashTable* rr_tracked_regions = NULL;
+
+void rr_tracked_mem_region_add(hwaddr addr, void* ptr, hwaddr len) {
+    RR_MapList* region = g_new0(RR_MapList, 1);
+    if (!rr_tracked_regions) {
+        rr_tracked_regions = g_hash_table_new(g_direct_hash, g_direct_equal);
+    }
+    region->addr = addr;
+    region->len = len;
+    region->ptr = ptr;
+    region->shadow = g_memdup(ptr, len);
+    region->next = g_hash_table_lookup(rr_tracked_regions, ptr);
+    g_hash_table_insert(rr_tracked_regions, ptr, region);
+}
+
+static void rr_tracked_mem_region_free(RR_MapList* region) {
+    g_free(region->shadow);
+    g_free(region);
+}
+
+void rr_tracked_mem_region_remove(void* ptr, hwaddr len) {
+    RR_MapList *head, *region, **prev;
+    if (!rr_tracked_regions) return;
+    head = g_hash_table_lookup(rr_tracked_regions, ptr);
+    for (prev = &head; (region = *prev); prev = &region->next) {
+        if (region->len == len) {
+            *prev = region->next;
+            rr_tracked_mem_region_free(region);
+            break;
+        }
+    }
+    if (head) {
+        g_hash_table_insert(rr_tracked_regions, ptr, head);
+    } else {
+        g_hash_table_remove(rr_tracked_regions, ptr);
     }
-    return crc;
 }
 
-extern QLIST_HEAD(rr_map_list, RR_MapList) rr_map_list;
+static void rr_tracked_mem_regions_clear(void) {
+    GHashTableIter it;
+    gpointer value;
+    if (!rr_tracked_regions) return;
+    g_hash_table_iter_init(&it, rr_tracked_regions);
+    while (g_hash_table_iter_next(&it, NULL, &value)) {
+        RR_MapList* region = value;
+        while (region) {
+            RR_MapList* next = region->next;
+            rr_tracked_mem_region_free(region);
+            region = next;
+        }
+    }
+    g_hash_table_remove_all(rr_tracked_regions);
+}
+
+// Logs the runs of guest pages in region that changed since last time.
+static void rr_tracked_mem_region_record(RR_MapList* region) {
+    hwaddr off = 0, run = 0, run_len = 0;
+    while (off < region->len) {
+        // chunks end on guest page boundaries
+        hwaddr sz = TARGET_PAGE_SIZE - ((region->addr + off) & ~TARGET_PAGE_MASK);
+        sz = MIN(sz, region->len - off);
+        if (memcmp(region->shadow + off, (uint8_t*)region->ptr + off, sz)) {
+            if (!run_len) run = off;
+            run_len += sz;
+        } else if (run_len) {
+            // Pretend this is just a mem_rw call
+            rr_device_mem_rw_call_record(region->addr + run,
+                                         (uint8_t*)region->ptr + run, run_len, 1);
+            memcpy(region->shadow + run, (uint8_t*)region->ptr + run, run_len);
+            run_len = 0;
+        }
+        off += sz;
+    }
+    if (run_len) {
+        rr_device_mem_rw_call_record(region->addr + run,
+                                     (uint8_t*)region->ptr + run, run_len, 1);
+        memcpy(region->shadow + run, (uint8_t*)region->ptr + run, run_len);
+    }
+}
 
 void rr_tracked_mem_regions_record(void) {
-    RR_MapList *region;
-    QLIST_FOREACH(region, &rr_map_list, link) {
-        uint32_t crc = rr_chunked_crc32(region->ptr, region->len);
-        if (crc != region->crc) {
-            // Pretend this is just a mem_rw call
-            rr_device_mem_rw_call_record(region->addr, region->ptr, region->len, 1);
+    GHashTableIter it;
+    gpointer value;
+    if (!rr_tracked_regions || !g_hash_table_size(rr_tracked_regions)) return;
+    g_hash_table_iter_init(&it, rr_tracked_regions);
+    while (g_hash_table_iter_next(&it, NULL, &value)) {
+        RR_MapList* region;
+        for (region = value; region; region = region->next) {
+            rr_tracked_mem_region_record(region);
         }
-        // Update it so we don't keep recording it
-        region->crc = crc;
     }
 }
 
@@ -699,7 +785,15 @@ static inline void free_entry_params(RR_log_entry* entry)
 }
 
 static inline size_t rr_fread(void *ptr, size_t size, size_t nmemb) {
-    size_t result = fread(ptr, size, nmemb, rr_nondet_log->fp);
+    size_t result;
+    if (rr_nondet_log->map) {
+        size_t len = size * nmemb;
+        rr_assert(rr_nondet_log->bytes_read + len <= rr_nondet_log->size);
+        memcpy(ptr, rr_nondet_log->map + rr_nondet_log->bytes_read, len);
+        rr_nondet_log->bytes_read += len;
+        return nmemb;
+    }
+    result = fread(ptr, size, nmemb, rr_nondet_log->fp);
     rr_nondet_log->bytes_read += nmemb * size;
     rr_assert(result == nmemb);
     return result;
@@ -1247,6 +1341,19 @@ void rr_create_replay_log(const char* filename)
         qemu_log("opened %s for read.  len=%llu bytes.\n", rr_nondet_log->name,
                  rr_nondet_log->size);
     }
+    // With -replay-shared the log is read through a read-only mapping, so
+    // concurrent replays of one recording share its page cache pages instead
+    // of each buffering a copy.
+    if (rr_replay_shared && rr_nondet_log->size > 0) {
+        void *map = mmap(NULL, rr_nondet_log->size, PROT_READ, MAP_SHARED,
+                         fileno(rr_nondet_log->fp), 0);
+        if (map == MAP_FAILED) {
+            perror("mmap nondet log");
+        } else {
+            madvise(map, rr_nondet_log->size, MADV_SEQUENTIAL);
+            rr_nondet_log->map = map;
+        }
+    }
     // mz read the last program point from the log header.
     rr_fread(&(rr_nondet_log->last_prog_point.guest_instr_count),
             sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
@@ -1265,6 +1372,10 @@ void rr_destroy_log(void)
         fclose(rr_nondet_log->fp);
         rr_nondet_log->fp = NULL;
     }
+    if (rr_nondet_log->map) {
+        munmap((void *)rr_nondet_log->map, rr_nondet_log->size);
+        rr_nondet_log->map = NULL;
+    }
     g_free(rr_nondet_log->name);
     g_free(rr_nondet_log);
     rr_nondet_log = NULL;
@@ -1363,7 +1474,15 @@ static inline void rr_get_nondet_log_file_name_for_replay(char* rr_name, char* r
 
 void rr_reset_state(CPUState* cpu)
 {
+    CPUState* c;
+
     tb_flush(cpu);
+    // Replay starts from a freshly loaded snapshot; give the recording the
+    // same empty, default-sized TLBs so that TLB fills (which set guest
+    // page table A/D bits) happen at the same points in both.
+    CPU_FOREACH(c) {
+        tlb_reset(c);
+    }
     // clear flags
     rr_record_in_progress = 0;
     rr_skipped_callsite_location = 0;
@@ -1377,8 +1496,23 @@ void rr_reset_state(CPUState* cpu)
 #ifdef CONFIG_SOFTMMU
 
 #include "qapi/error.h"
+#include "qemu/error-report.h"
+
+// Recordings need a single, deterministic instruction stream
+static bool rr_check_single_threaded(Error **errp)
+{
+    if (qemu_tcg_mttcg_enabled()) {
+        error_setg(errp, "record/replay is not supported with multi-threaded TCG");
+        return false;
+    }
+    return true;
+}
+
 void qmp_begin_record(const char* file_name, Error** errp)
 {
+    if (!rr_check_single_threaded(errp)) {
+        return;
+    }
     rr_record_requested = RR_RECORD_REQUEST;
     rr_requested_name = g_strdup(file_name);
 }
@@ -1386,6 +1520,9 @@ void qmp_begin_record(const char* file_name, Error** errp)
 void qmp_begin_record_from(const char* snapshot, const char* file_name,
                                   Error** errp)
 {
+    if (!rr_check_single_threaded(errp)) {
+        return;
+    }
     rr_record_requested = RR_RECORD_FROM_REQUEST;
     rr_snapshot_name = g_strdup(snapshot);
     rr_requested_name = g_strdup(file_name);
@@ -1398,6 +1535,9 @@ void qmp_end_record(Error** errp)
 }
 
 void qmp_begin_replay(const char *file_name, Error **errp) {
+  if (!rr_check_single_threaded(errp)) {
+      return;
+  }
   rr_replay_requested = 1;
   rr_requested_name = g_strdup(file_name);
   gettimeofday(&replay_start_time, 0);
@@ -1417,18 +1557,24 @@ void panda_end_replay(void) { rr_end_replay_requested = 1; }
 // HMP commands (the "monitor")
 void hmp_begin_record(Monitor* mon, const QDict* qdict)
 {
-    Error* err;
+    Error* err = NULL;
     const char* file_name = qdict_get_try_str(qdict, "file_name");
     qmp_begin_record(file_name, &err);
+    if (err) {
+        error_report_err(err);
+    }
 }
 
 // HMP commands (the "monitor")
 void hmp_begin_record_from(Monitor* mon, const QDict* qdict)
 {
-    Error* err;
+    Error* err = NULL;
     const char* snapshot = qdict_get_try_str(qdict, "snapshot");
     const char* file_name = qdict_get_try_str(qdict, "file_name");
     qmp_begin_record_from(snapshot, file_name, &err);
+    if (err) {
+        error_report_err(err);
+    }
 }
 
 void hmp_end_record(Monitor* mon, const QDict* qdict)
@@ -1439,9 +1585,12 @@ void hmp_end_record(Monitor* mon, const QDict* qdict)
 
 void hmp_begin_replay(Monitor *mon, const QDict *qdict)
 {
-  Error *err;
+  Error *err = NULL;
   const char *file_name = qdict_get_try_str(qdict, "file_name");
   qmp_begin_replay(file_name, &err);
+  if (err) {
+      error_report_err(err);
+  }
 }
 
 void hmp_end_replay(Monitor* mon, const QDict* qdict)
@@ -1532,6 +1681,7 @@ void rr_do_end_record(void)
     // log_all_cpu_states();
 
     rr_destroy_log();
+    rr_tracked_mem_regions_clear();
 
     g_free(rr_path_base);
     g_free(rr_name_base);
@@ -1543,6 +1693,191 @@ void rr_do_end_record(void)
 
 extern void panda_cleanup(void);
 
+/******************************************************************************************/
+/* SHARED REPLAY RAM IMAGE */
+/******************************************************************************************/
+// With -replay-shared, the guest RAM restored from the snapshot is also kept
+// as a raw image in <name>-rr-ram, written by the first replay that needs it.
+// Each replay maps the image MAP_PRIVATE over its RAM blocks: pages the guest
+// never writes stay in the page cache, shared by every replay of the
+// recording, and only pages a replay dirties become private copies.
+
+#define RR_RAM_MAGIC "PANDARAM"
+#define RR_RAM_ALIGN (2 * 1024 * 1024)
+#define RR_RAM_MAX_BLOCKS 64
+
+typedef struct {
+    char idstr[256];
+    uint64_t offset; // in the image file, RR_RAM_ALIGN aligned
+    uint64_t length;
+} RR_ram_block;
+
+typedef struct {
+    char magic[8];
+    // identifies the snapshot the image was made from
+    uint64_t snapshot_size;
+    int64_t snapshot_mtime;
+    uint32_t nblocks;
+    RR_ram_block blocks[RR_RAM_MAX_BLOCKS];
+} RR_ram_header;
+
+typedef struct {
+    RR_ram_header hdr;
+    void* host[RR_RAM_MAX_BLOCKS];
+    uint64_t end;
+} RR_ram_layout;
+
+static int rr_ram_layout_add(const char* block_name, void* host_addr,
+                             ram_addr_t offset, ram_addr_t length, void* opaque)
+{
+    RR_ram_layout* l = opaque;
+    RR_ram_block* b;
+
+    if (l->hdr.nblocks == RR_RAM_MAX_BLOCKS) {
+        return 1;
+    }
+    b = &l->hdr.blocks[l->hdr.nblocks];
+    pstrcpy(b->idstr, sizeof(b->idstr), block_name);
+    b->offset = l->end;
+    b->length = length;
+    l->host[l->hdr.nblocks++] = host_addr;
+    l->end = ROUND_UP(b->offset + length, RR_RAM_ALIGN);
+    return 0;
+}
+
+static bool rr_ram_image_matches(int fd, const RR_ram_header* want)
+{
+    RR_ram_header hdr;
+    uint32_t i;
+
+    if (pread(fd, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr) ||
+        memcmp(hdr.magic, want->magic, sizeof(hdr.magic)) ||
+        hdr.snapshot_size != want->snapshot_size ||
+        hdr.snapshot_mtime != want->snapshot_mtime ||
+        hdr.nblocks != want->nblocks) {
+        return false;
+    }
+    for (i = 0; i < hdr.nblocks; i++) {
+        if (strcmp(hdr.blocks[i].idstr, want->blocks[i].idstr) ||
+            hdr.blocks[i].offset != want->blocks[i].offset ||
+            hdr.blocks[i].length != want->blocks[i].length) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the image under a private name and renames it into place, so a
+// concurrent replay never maps a half-written image. Zero pages are left as
+// holes.
+static bool rr_write_ram_image(const char* fname, RR_ram_layout* l)
+{
+    gchar* tmp = g_strdup_printf("%s.%d", fname, (int)getpid());
+    size_t psize = qemu_real_host_page_size;
+    bool ok = false;
+    uint32_t i;
+    uint64_t o;
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        perror(tmp);
+        g_free(tmp);
+        return false;
+    }
+    if (pwrite(fd, &l->hdr, sizeof(l->hdr), 0) != (ssize_t)sizeof(l->hdr)) {
+        goto out;
+    }
+    for (i = 0; i < l->hdr.nblocks; i++) {
+        RR_ram_block* b = &l->hdr.blocks[i];
+        for (o = 0; o < b->length; o += psize) {
+            uint8_t* page = (uint8_t*)l->host[i] + o;
+            if (buffer_is_zero(page, psize)) {
+                continue;
+            }
+            if (pwrite(fd, page, psize, b->offset + o) != (ssize_t)psize) {
+                goto out;
+            }
+        }
+    }
+    ok = ftruncate(fd, l->end) == 0;
+out:
+    if (!ok) {
+        perror(tmp);
+    }
+    close(fd);
+    if (ok && rename(tmp, fname) != 0) {
+        perror(fname);
+        ok = false;
+    }
+    if (!ok) {
+        unlink(tmp);
+    }
+    g_free(tmp);
+    return ok;
+}
+
+// Called once the snapshot has been loaded, so guest RAM already holds what
+// the image does (or is about to be written from).
+static void rr_share_ram(const char* snapshot_name, const char* image_name)
+{
+    RR_ram_layout* l = g_new0(RR_ram_layout, 1);
+    struct stat st;
+    uint32_t i;
+    int fd = -1;
+
+    memcpy(l->hdr.magic, RR_RAM_MAGIC, sizeof(l->hdr.magic));
+    l->end = RR_RAM_ALIGN;
+    if (stat(snapshot_name, &st) != 0) {
+        goto out;
+    }
+    l->hdr.snapshot_size = st.st_size;
+    l->hdr.snapshot_mtime = st.st_mtime;
+    if (qemu_ram_foreach_block(rr_ram_layout_add, l)) {
+        printf("replay-shared: more than %d RAM blocks, not sharing RAM\n",
+               RR_RAM_MAX_BLOCKS);
+        goto out;
+    }
+
+    fd = open(image_name, O_RDONLY);
+    if (fd < 0 || !rr_ram_image_matches(fd, &l->hdr)) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        printf("writing shared RAM image %s\n", image_name);
+        if (!rr_write_ram_image(image_name, l)) {
+            goto out;
+        }
+        fd = open(image_name, O_RDONLY);
+        if (fd < 0) {
+            perror(image_name);
+            goto out;
+        }
+    }
+
+    for (i = 0; i < l->hdr.nblocks; i++) {
+        RR_ram_block* b = &l->hdr.blocks[i];
+        // On failure the block keeps its private copy, which holds the
+        // same contents.
+        void* p = mmap(l->host[i], b->length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_FIXED, fd, b->offset);
+        if (p == MAP_FAILED) {
+            fprintf(stderr, "replay-shared: can't map RAM block %s: %s\n",
+                    b->idstr, strerror(errno));
+            continue;
+        }
+        // The old pages are gone: restore the RAM block's madvise flags
+        // and make io_uring re-register its fixed buffers.
+        qemu_ram_remapped(p, b->length);
+    }
+    printf("mapped shared RAM image %s\n", image_name);
+
+out:
+    if (fd >= 0) {
+        close(fd);
+    }
+    g_free(l);
+}
+
 // file_name_full should be full path to the record/replay log
 int rr_do_begin_replay(const char* file_name_full, CPUState* cpu_state)
 {
@@ -1591,6 +1926,13 @@ int rr_do_begin_replay(const char* file_name_full, CPUState* cpu_state)
     printf("... done.\n");
     // log_all_cpu_states();
 
+    if (rr_replay_shared) {
+        char image_buf[1024];
+        snprintf(image_buf, sizeof(image_buf), "%s/%s/%s-rr-ram", rr_path,
+                 rr_name, rr_name);
+        rr_share_ram(name_buf, image_buf);
+    }
+
     // save the time so we can report how long replay takes
     time(&rr_start_time);
 
@@ -1702,8 +2044,16 @@ void rr_end_main_loop_wait(void) {
 static uint32_t rr_checksum_memory_internal(void) {
     MemoryRegion *ram = memory_region_find(get_system_memory(), 0x2000000, 1).mr;
     rcu_read_lock();
-    void *ptr = qemu_map_ram_ptr(ram->ram_block, 0);
-    uint32_t crc = rr_chunked_crc32(ptr, ram_size);
+    uint8_t *ptr = qemu_map_ram_ptr(ram->ram_block, 0);
+    uint32_t crc = crc32(0, Z_NULL, 0);
+    size_t remaining = ram_size;
+    // crc32() takes a 32-bit length
+    while (remaining > 0) {
+        uint32_t sz = MIN(remaining, UINT32_MAX);
+        crc = crc32(crc, ptr, sz);
+        ptr += sz;
+        remaining -= sz;
+    }
     rcu_read_unlock();
 
     return crc;
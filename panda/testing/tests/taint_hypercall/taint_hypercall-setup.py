@@ -0,0 +1,23 @@
+#!/usr/bin/python
+
+import os
+import sys
+import subprocess as sp
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+# static and non-PIE, so it runs on the guest's libc and its code sits
+# where the test looks for it
+include = pandadir + "/panda/plugins/taint2/tests/include/gcc"
+binary = miscdir + "/taint_hypercall"
+if not dir_exists(miscdir):
+    os.makedirs(miscdir)
+sp.check_call(["g++", "-m32", "-static", "-O0", "-DTARGET_I386",
+               "-I" + include, "-o", binary,
+               testingscriptsdir + "/tests/taint_hypercall/taint_hypercall.cpp"])
+
+record_debian(binary, "taint_hypercall", "i386")
@@ -0,0 +1,46 @@
+#!/usr/bin/python
+
+# Replays a program that labels buffers with the x86 single-label hypercall
+# and the batch ring, and writes out the label sets of the tainted branches
+# it then takes over those buffers, in order.
+
+import os
+import sys
+import shutil
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+sys.path.append(pandascriptsdir)
+
+from plog_reader import plogiter
+
+run_test_debian("-panda taint2 -panda tainted_branch -pandalog taint.plog",
+                "taint_hypercall", "i386")
+
+ulsm = {}
+
+with open("%s/taint_hypercall.labels" % tmpoutdir, "w") as out:
+    for entry in plogiter(tmpoutdir + "/taint.plog"):
+        if not entry.HasField("tainted_branch"):
+            continue
+        for tqe in entry.tainted_branch.taint_query:
+            if tqe.HasField("unique_label_set"):
+                uls = tqe.unique_label_set
+                ulsm[uls.ptr] = uls.label
+        # only the test program, not the kernel or libc start-up
+        if entry.pc < 0x8000000 or entry.pc >= 0x9000000:
+            continue
+        labels = []
+        for tqe in entry.tainted_branch.taint_query:
+            labels.extend(ulsm[tqe.ptr])
+        out.write("tainted_branch %s\n" % " ".join(str(l) for l in sorted(set(labels))))
+
+os.chdir(tmpoutdir)
+with open(tmpoutfile, "a") as out:
+    out.write("\n")
+    with open("taint_hypercall.labels") as labels:
+        out.write(labels.read())
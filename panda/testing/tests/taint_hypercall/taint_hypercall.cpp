@@ -0,0 +1,68 @@
+// Labels buffers through the x86 single-label hypercall and the batch ring,
+// then branches on every byte so that tainted_branch reports the labels each
+// buffer ended up with.
+//
+// taint2 only runs on the replay, so nothing here may look at what it writes
+// back (command results, ring head): the recording never saw those values.
+
+#include <stdio.h>
+#include <string.h>
+#include "panda_mark.h"
+
+#define N 8
+
+static unsigned char single[N];
+static unsigned char batch_single[N];
+static unsigned char batch_pos[N];
+static unsigned char wrapped_single[N];
+static unsigned char wrapped_pos[N];
+static unsigned char unlabeled[N];
+static struct batch ring;
+
+static int branch_on(const unsigned char *buf) {
+  int hits = 0;
+  for (int i = 0; i < N; i++) {
+    if (buf[i] == 'a') hits++;
+  }
+  return hits;
+}
+
+int main(int argc, char* argv[]) {
+  // touch every buffer so it is mapped when taint2 translates it
+  memset(single, 'x', N);
+  memset(batch_single, 'x', N);
+  memset(batch_pos, 'x', N);
+  memset(wrapped_single, 'x', N);
+  memset(wrapped_pos, 'x', N);
+  memset(unlabeled, 'x', N);
+
+  // single-label hypercall; also turns taint on
+  label_buffer_with((unsigned long)single, N, 1);
+
+  batch_init(&ring);
+  batch_add(&ring, BATCH_LABEL, (unsigned long)batch_single, N, 2);
+  batch_add(&ring, BATCH_LABEL_POS, (unsigned long)batch_pos, N, 100);
+  batch_add(&ring, BATCH_QUERY, (unsigned long)batch_single, N, 0);
+  batch_add(&ring, BATCH_QUERY, (unsigned long)unlabeled, N, 0);
+  batch_flush(&ring);
+
+  // commands that wrap around the end of the ring
+  ring.head = ring.tail = BATCH_SIZE - 2;
+  batch_add(&ring, BATCH_QUERY, (unsigned long)single, N, 0);
+  batch_add(&ring, BATCH_LABEL, (unsigned long)wrapped_single, N, 3);
+  batch_add(&ring, BATCH_LABEL_POS, (unsigned long)wrapped_pos, N, 200);
+  batch_add(&ring, BATCH_QUERY, (unsigned long)wrapped_pos, N, 0);
+  batch_flush(&ring);
+
+  int hits = 0;
+  hits += branch_on(single);
+  hits += branch_on(batch_single);
+  hits += branch_on(batch_pos);
+  hits += branch_on(wrapped_single);
+  hits += branch_on(wrapped_pos);
+  hits += branch_on(unlabeled);
+
+  printf("Completed successfully, %d hits\n", hits);
+
+  return 0;
+}
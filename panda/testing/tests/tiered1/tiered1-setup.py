@@ -0,0 +1,20 @@
+#!/usr/bin/python
+
+import os
+import subprocess as sp
+import sys
+import re
+import shutil 
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+record_debian("guest:/usr/bin/md5sum guest:/bin/bash", "md5sum", "i386")
+
+ss_filename = miscdir + "/md5sum_search_strings.txt"
+ssf = open(ss_filename, "w")
+ssf.write("/bin/bash\n")
+ssf.close()
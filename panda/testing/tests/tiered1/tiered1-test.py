@@ -0,0 +1,35 @@
+#!/usr/bin/python
+
+# Replays the same recording with and without -tiered-llvm. The hot loop
+# of md5sum gets moved to LLVM code, which must not change what plugins
+# see or the replay itself.
+
+import os
+import sys
+import shutil
+import filecmp
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+ss_filename = miscdir + "/md5sum"
+matches = miscdir + "/md5sum_string_matches.txt"
+
+run_test_debian("-panda stringsearch:name=" + ss_filename, "md5sum", "i386")
+shutil.move(matches, tmpoutdir + "/tcg_matches.txt")
+
+run_test_debian("-tiered-llvm 50 -panda stringsearch:name=" + ss_filename,
+                "md5sum", "i386", clear_tmpout=False)
+shutil.move(matches, tmpoutdir + "/tiered_matches.txt")
+
+os.chdir(tmpoutdir)
+with open(tmpoutfile, "w") as out:
+    if filecmp.cmp("tcg_matches.txt", "tiered_matches.txt", shallow=False):
+        out.write("tiered matches are the same as tcg matches\n")
+    else:
+        out.write("tiered matches differ from tcg matches\n")
+    with open("tiered_matches.txt") as m:
+        out.write(m.read())
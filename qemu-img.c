@@ -1519,6 +1519,7 @@ typedef struct ImgConvertState {
     bool compressed;
     bool target_has_backing;
     bool wr_in_order;
+    bool early_wr_release;
     int min_sparse;
     size_t cluster_sectors;
     size_t buf_sectors;
@@ -1735,6 +1736,32 @@ static int coroutine_fn convert_co_write(ImgConvertState *s, int64_t sector_num,
     return 0;
 }
 
+/* Mark everything before @wr_offs as written and restart the coroutine
+ * that waits to write from there. With @defer, the coroutine only runs
+ * once the caller has yielded. */
+static void coroutine_fn convert_co_release_wr(ImgConvertState *s,
+                                               int64_t wr_offs, bool defer)
+{
+    int i;
+
+    s->wr_offs = wr_offs;
+    for (i = 0; i < s->num_coroutines; i++) {
+        if (s->co[i] && s->wait_sector_num[i] == s->wr_offs) {
+            /*
+             * A -> B -> A cannot occur because A has
+             * s->wait_sector_num[i] == -1 during A -> B.  Therefore
+             * B will never enter A during this time window.
+             */
+            if (defer) {
+                aio_co_schedule(qemu_get_aio_context(), s->co[i]);
+            } else {
+                qemu_coroutine_enter(s->co[i]);
+            }
+            break;
+        }
+    }
+}
+
 static void coroutine_fn convert_co_do_copy(void *opaque)
 {
     ImgConvertState *s = opaque;
@@ -1757,6 +1784,7 @@ static void coroutine_fn convert_co_do_copy(void *opaque)
         int n;
         int64_t sector_num;
         enum ImgConvertBlockStatus status;
+        bool wr_released = false;
 
         qemu_co_mutex_lock(&s->lock);
         if (s->ret != -EINPROGRESS || s->sector_num >= s->total_sectors) {
@@ -1808,6 +1836,14 @@ static void coroutine_fn convert_co_do_copy(void *opaque)
         }
 
         if (s->ret == -EINPROGRESS) {
+            if (s->wr_in_order && s->early_wr_release) {
+                /* The target keeps compressed writes in submission order by
+                 * itself, so the next request may be issued as soon as this
+                 * one has entered the driver. The clusters of both are then
+                 * compressed concurrently. */
+                convert_co_release_wr(s, sector_num + n, true);
+                wr_released = true;
+            }
             ret = convert_co_write(s, sector_num, n, buf, status);
             if (ret < 0) {
                 error_report("error while writing sector %" PRId64
@@ -1816,21 +1852,10 @@ static void coroutine_fn convert_co_do_copy(void *opaque)
             }
         }
 
-        if (s->wr_in_order) {
+        if (s->wr_in_order && !wr_released) {
             /* reenter the coroutine that might have waited
              * for this write to complete */
-            s->wr_offs = sector_num + n;
-            for (i = 0; i < s->num_coroutines; i++) {
-                if (s->co[i] && s->wait_sector_num[i] == s->wr_offs) {
-                    /*
-                     * A -> B -> A cannot occur because A has
-                     * s->wait_sector_num[i] == -1 during A -> B.  Therefore
-                     * B will never enter A during this time window.
-                     */
-                    qemu_coroutine_enter(s->co[i]);
-                    break;
-                }
-            }
+            convert_co_release_wr(s, sector_num + n, false);
         }
     }
 
@@ -2308,6 +2333,7 @@ static int img_convert(int argc, char **argv)
     }
 
     cluster_sectors = 0;
+    memset(&bdi, 0, sizeof(bdi));
     ret = bdrv_get_info(out_bs, &bdi);
     if (ret < 0) {
         if (compress) {
@@ -2331,6 +2357,7 @@ static int img_convert(int argc, char **argv)
         .cluster_sectors    = cluster_sectors,
         .buf_sectors        = bufsectors,
         .wr_in_order        = wr_in_order,
+        .early_wr_release   = compress && bdi.ordered_compressed_writes,
         .num_coroutines     = num_coroutines,
     };
     ret = convert_do_copy(&state);
@@ -565,7 +565,7 @@ DEF("drive", HAS_ARG, QEMU_OPTION_drive,
     "       [,cyls=c,heads=h,secs=s[,trans=t]][,snapshot=on|off]\n"
     "       [,cache=writethrough|writeback|none|directsync|unsafe][,format=f]\n"
     "       [,serial=s][,addr=A][,rerror=ignore|stop|report]\n"
-    "       [,werror=ignore|stop|report|enospc][,id=name][,aio=threads|native]\n"
+    "       [,werror=ignore|stop|report|enospc][,id=name][,aio=threads|native|io_uring]\n"
     "       [,readonly=on|off][,copy-on-read=on|off]\n"
     "       [,discard=ignore|unmap][,detect-zeroes=on|off|unmap]\n"
     "       [[,bps=b]|[[,bps_rd=r][,bps_wr=w]]]\n"
@@ -608,7 +608,7 @@ These options have the same definition as they have in @option{-hdachs}.
 @item cache=@var{cache}
 @var{cache} is "none", "writeback", "unsafe", "directsync" or "writethrough" and controls how the host cache is used to access block data.
 @item aio=@var{aio}
-@var{aio} is "threads", or "native" and selects between pthread based disk I/O and native Linux AIO.
+@var{aio} is "threads", "native" or "io_uring" and selects between pthread based disk I/O, native Linux AIO and Linux io_uring.
 @item discard=@var{discard}
 @var{discard} is one of "ignore" (or "off") or "unmap" (or "on") and controls whether @dfn{discard} (also known as @dfn{trim} or @dfn{unmap}) requests are ignored or passed to the filesystem.  Some machine types may not support discard requests.
 @item format=@var{format}
@@ -4157,8 +4157,15 @@ DEF("llvm", 0, QEMU_OPTION_execute_llvm,
     "-llvm           execute code using LLVM JIT\n", QEMU_ARCH_ALL)
 DEF("generate-llvm", 0, QEMU_OPTION_generate_llvm,
     "-generate-llvm  translate code into LLVM but don't execute it\n", QEMU_ARCH_ALL)
+DEF("tiered-llvm", HAS_ARG, QEMU_OPTION_tiered_llvm,
+    "-tiered-llvm n  execute code using TCG, moving blocks executed n times\n"
+    "                to optimized LLVM code compiled in the background\n", QEMU_ARCH_ALL)
 #endif
 
+DEF("superblocks", HAS_ARG, QEMU_OPTION_superblocks,
+    "-superblocks n  retranslate blocks along their hot path once their exits\n"
+    "                have been taken n times\n", QEMU_ARCH_ALL)
+
 DEF("record-from", HAS_ARG, QEMU_OPTION_record_from,
     "-record-from <snapshot>:<record-name>\n"
     "                load snapshot <snapshot> and begin recording\n", QEMU_ARCH_ALL)
@@ -4167,10 +4174,18 @@ DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay </path/to/snapshot-prefix>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
 
+DEF("replay-shared", 0, QEMU_OPTION_replay_shared,
+    "-replay-shared  map guest RAM and the nondet log of the replay from files\n"
+    "                shared copy-on-write with other replays of the recording\n", QEMU_ARCH_ALL)
+
 DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
 
+DEF("pandalog-columnar", HAS_ARG, QEMU_OPTION_pandalog_columnar,
+    "-pandalog-columnar <filename>\n"
+    "                enable panda logging to file, in the columnar format\n", QEMU_ARCH_ALL)
+
 DEF("panda-plugin", HAS_ARG, QEMU_OPTION_panda_plugin,
     "-panda-plugin <file>\n"
     "                load PANDA plugin from <file>\n", QEMU_ARCH_ALL)
@@ -385,6 +385,7 @@ static void cpu_common_initfn(Object *obj)
     qemu_mutex_init(&cpu->work_mutex);
     QTAILQ_INIT(&cpu->breakpoints);
     QTAILQ_INIT(&cpu->watchpoints);
+    cpu->rr_breakpoints = g_array_new(false, false, sizeof(CPUBreakpoint *));
 
     cpu->trace_dstate = bitmap_new(trace_get_vcpu_event_count());
 
@@ -395,6 +396,7 @@ static void cpu_common_finalize(Object *obj)
 {
     CPUState *cpu = CPU(obj);
     g_free(cpu->trace_dstate);
+    g_array_free(cpu->rr_breakpoints, true);
 }
 
 static int64_t cpu_common_get_arch_id(CPUState *cpu)
@@ -9576,8 +9576,8 @@ static void disas_simd_3same_int(DisasContext *s, uint32_t insn)
             case 0x10: /* ADD, SUB */
             {
                 static NeonGenTwoOpFn * const fns[3][2] = {
-                    { gen_helper_neon_add_u8, gen_helper_neon_sub_u8 },
-                    { gen_helper_neon_add_u16, gen_helper_neon_sub_u16 },
+                    { tcg_gen_vec_add8_i32, tcg_gen_vec_sub8_i32 },
+                    { tcg_gen_vec_add16_i32, tcg_gen_vec_sub16_i32 },
                     { tcg_gen_add_i32, tcg_gen_sub_i32 },
                 };
                 genfn = fns[size][u];
@@ -9634,8 +9634,8 @@ static void disas_simd_3same_int(DisasContext *s, uint32_t insn)
             if (opcode == 0xf || opcode == 0x12) {
                 /* SABA, UABA, MLA, MLS: accumulating ops */
                 static NeonGenTwoOpFn * const fns[3][2] = {
-                    { gen_helper_neon_add_u8, gen_helper_neon_sub_u8 },
-                    { gen_helper_neon_add_u16, gen_helper_neon_sub_u16 },
+                    { tcg_gen_vec_add8_i32, tcg_gen_vec_sub8_i32 },
+                    { tcg_gen_vec_add16_i32, tcg_gen_vec_sub16_i32 },
                     { tcg_gen_add_i32, tcg_gen_sub_i32 },
                 };
                 bool is_sub = (opcode == 0x12 && u); /* MLS */
@@ -10648,7 +10648,7 @@ static void disas_simd_indexed(DisasContext *s, uint32_t insn)
             case 0x8: /* MUL */
             {
                 static NeonGenTwoOpFn * const fns[2][2] = {
-                    { gen_helper_neon_add_u16, gen_helper_neon_sub_u16 },
+                    { tcg_gen_vec_add16_i32, tcg_gen_vec_sub16_i32 },
                     { tcg_gen_add_i32, tcg_gen_sub_i32 },
                 };
                 NeonGenTwoOpFn *genfn;
@@ -11261,6 +11261,9 @@ void gen_intermediate_code_a64(ARMCPU *cpu, TranslationBlock *tb)
     if (max_insns > TCG_MAX_INSNS) {
         max_insns = TCG_MAX_INSNS;
     }
+    if (tiered_llvm_lifting) {
+        max_insns = tb->icount;
+    }
 
     gen_tb_start(tb);
 
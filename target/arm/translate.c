@@ -4450,8 +4450,8 @@ static void gen_nop_hint(DisasContext *s, int val)
 static inline void gen_neon_add(int size, TCGv_i32 t0, TCGv_i32 t1)
 {
     switch (size) {
-    case 0: gen_helper_neon_add_u8(t0, t0, t1); break;
-    case 1: gen_helper_neon_add_u16(t0, t0, t1); break;
+    case 0: tcg_gen_vec_add8_i32(t0, t0, t1); break;
+    case 1: tcg_gen_vec_add16_i32(t0, t0, t1); break;
     case 2: tcg_gen_add_i32(t0, t0, t1); break;
     default: abort();
     }
@@ -4460,8 +4460,8 @@ static inline void gen_neon_add(int size, TCGv_i32 t0, TCGv_i32 t1)
 static inline void gen_neon_rsb(int size, TCGv_i32 t0, TCGv_i32 t1)
 {
     switch (size) {
-    case 0: gen_helper_neon_sub_u8(t0, t1, t0); break;
-    case 1: gen_helper_neon_sub_u16(t0, t1, t0); break;
+    case 0: tcg_gen_vec_sub8_i32(t0, t1, t0); break;
+    case 1: tcg_gen_vec_sub16_i32(t0, t1, t0); break;
     case 2: tcg_gen_sub_i32(t0, t1, t0); break;
     default: return;
     }
@@ -5783,8 +5783,8 @@ static int disas_neon_data_insn(DisasContext *s, uint32_t insn)
                 gen_neon_add(size, tmp, tmp2);
             } else { /* VSUB */
                 switch (size) {
-                case 0: gen_helper_neon_sub_u8(tmp, tmp, tmp2); break;
-                case 1: gen_helper_neon_sub_u16(tmp, tmp, tmp2); break;
+                case 0: tcg_gen_vec_sub8_i32(tmp, tmp, tmp2); break;
+                case 1: tcg_gen_vec_sub16_i32(tmp, tmp, tmp2); break;
                 case 2: tcg_gen_sub_i32(tmp, tmp, tmp2); break;
                 default: abort();
                 }
@@ -11799,7 +11799,9 @@ void gen_intermediate_code(CPUARMState *env, TranslationBlock *tb)
         max_insns = TCG_MAX_INSNS;
     }
 
-    if (rr_mode == RR_REPLAY) {
+    if (tiered_llvm_lifting) {
+        max_insns = tb->icount;
+    } else if (rr_mode == RR_REPLAY) {
         uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
         if (max_insns > until_interrupt) {
             max_insns = until_interrupt;
@@ -11908,10 +11910,14 @@ void gen_intermediate_code(CPUARMState *env, TranslationBlock *tb)
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
         // In LLVM mode we generate this more efficiently.
+        // Memory callbacks recover the precise PC from the host return
+        // address; storing it eagerly is only needed when asked for.
         if ((rr_mode != RR_OFF || panda_update_pc) && !generate_llvm) {
-            gen_op_update_panda_pc(dc->pc);
             gen_op_update_rr_icount();
         }
+        if (panda_update_pc && !generate_llvm) {
+            gen_op_update_panda_pc(dc->pc);
+        }
 #endif
 
         if (dc->ss_active && !dc->pstate_ss) {
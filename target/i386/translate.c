@@ -139,6 +139,7 @@ typedef struct DisasContext {
     int mem_index; /* select memory access functions */
     uint64_t flags; /* all execution flags */
     struct TranslationBlock *tb;
+    const TBTrace *trace; /* hot path followed by a superblock, or NULL */
     int popl_esp_hack; /* for correct popl with esp base handling */
     int rip_offset; /* only used in x86_64, but left for simplicity */
     int cpuid_features;
@@ -2168,10 +2169,46 @@ static inline void gen_goto_tb(DisasContext *s, int tb_num, target_ulong eip)
     }
 }
 
+/* Returns the direction (1 = taken) in which a superblock continues past
+   the branch to VAL ending at NEXT_EIP, or -1 to end the block there. */
+static int gen_trace_direction(DisasContext *s, target_ulong next_eip,
+                               target_ulong val)
+{
+    target_ulong pc = s->cs_base + val;
+    int dir;
+
+    if (!s->trace || !s->jmp_opt
+        || (s->flags & (HF_INHIBIT_IRQ_MASK | HF_RF_MASK))) {
+        return -1;
+    }
+    dir = tb_trace_direction(s->trace, s->cs_base + next_eip);
+    /* Only forward edges within the first page, like the profiler. */
+    if (dir == 1 && (val < next_eip
+                     || (pc & TARGET_PAGE_MASK)
+                        != (s->tb->pc & TARGET_PAGE_MASK))) {
+        return -1;
+    }
+    return dir;
+}
+
 static inline void gen_jcc(DisasContext *s, int b,
                            target_ulong val, target_ulong next_eip)
 {
     TCGLabel *l1, *l2;
+    int dir = gen_trace_direction(s, next_eip, val);
+
+    if (dir >= 0) {
+        /* Leave through the cpu loop when the branch goes the cold way,
+           otherwise keep translating along the trace. */
+        l1 = gen_new_label();
+        gen_jcc1(s, dir ? b : b ^ 1, l1);
+        gen_jmp_im(dir ? next_eip : val);
+        gen_eob(s);
+        s->is_jmp = DISAS_NEXT;
+        gen_set_label(l1);
+        s->pc = s->cs_base + (dir ? val : next_eip);
+        return;
+    }
 
     if (s->jmp_opt) {
         l1 = gen_new_label();
@@ -2575,6 +2612,14 @@ static void gen_jmp_tb(DisasContext *s, target_ulong eip, int tb_num)
 
 static void gen_jmp(DisasContext *s, target_ulong eip)
 {
+    target_ulong next_eip = s->pc - s->cs_base;
+
+    /* Jumps to the next insn end the block after a state change, so only
+       real jumps are followed into a superblock. */
+    if (eip != next_eip && gen_trace_direction(s, next_eip, eip) == 1) {
+        s->pc = s->cs_base + eip;
+        return;
+    }
     gen_jmp_tb(s, eip, 0);
 }
 
@@ -2966,6 +3011,71 @@ static const struct SSEOpHelper_eppi sse_op_table7[256] = {
     [0xdf] = AESNI_OP(aeskeygenassist),
 };
 
+typedef void (*SSEGenFunc_lane)(TCGv_i64 ret, TCGv_i64 a, TCGv_i64 b);
+
+static void gen_sse_pandn_lane(TCGv_i64 ret, TCGv_i64 a, TCGv_i64 b)
+{
+    tcg_gen_andc_i64(ret, b, a);
+}
+
+/* Bitwise and modular add/sub ops that are expanded inline one 64-bit
+   lane at a time instead of calling the ops_sse.h helpers.  */
+static SSEGenFunc_lane sse_inline_lane_op(int b)
+{
+    switch (b) {
+    case 0x54: /* andps, andpd */
+    case 0xdb: /* pand */
+        return tcg_gen_and_i64;
+    case 0x55: /* andnps, andnpd */
+    case 0xdf: /* pandn */
+        return gen_sse_pandn_lane;
+    case 0x56: /* orps, orpd */
+    case 0xeb: /* por */
+        return tcg_gen_or_i64;
+    case 0x57: /* xorps, xorpd */
+    case 0xef: /* pxor */
+        return tcg_gen_xor_i64;
+    case 0xfc: /* paddb */
+        return tcg_gen_vec_add8_i64;
+    case 0xfd: /* paddw */
+        return tcg_gen_vec_add16_i64;
+    case 0xfe: /* paddl */
+        return tcg_gen_vec_add32_i64;
+    case 0xd4: /* paddq */
+        return tcg_gen_add_i64;
+    case 0xf8: /* psubb */
+        return tcg_gen_vec_sub8_i64;
+    case 0xf9: /* psubw */
+        return tcg_gen_vec_sub16_i64;
+    case 0xfa: /* psubl */
+        return tcg_gen_vec_sub32_i64;
+    case 0xfb: /* psubq */
+        return tcg_gen_sub_i64;
+    default:
+        return NULL;
+    }
+}
+
+static void gen_sse_inline(SSEGenFunc_lane fn, int is_xmm,
+                           int op1_offset, int op2_offset)
+{
+    TCGv_i64 t0 = tcg_temp_new_i64();
+    TCGv_i64 t1 = tcg_temp_new_i64();
+    int i, lane_offset;
+
+    for (i = 0; i < (is_xmm ? 2 : 1); i++) {
+        lane_offset = is_xmm ? offsetof(ZMMReg, ZMM_Q(i))
+                             : offsetof(MMXReg, MMX_Q(0));
+        tcg_gen_ld_i64(t0, cpu_env, op1_offset + lane_offset);
+        tcg_gen_ld_i64(t1, cpu_env, op2_offset + lane_offset);
+        fn(t0, t0, t1);
+        tcg_gen_st_i64(t0, cpu_env, op1_offset + lane_offset);
+    }
+
+    tcg_temp_free_i64(t0);
+    tcg_temp_free_i64(t1);
+}
+
 static void gen_sse(CPUX86State *env, DisasContext *s, int b,
                     target_ulong pc_start, int rex_r)
 {
@@ -2975,6 +3085,7 @@ static void gen_sse(CPUX86State *env, DisasContext *s, int b,
     SSEFunc_0_eppi sse_fn_eppi;
     SSEFunc_0_ppi sse_fn_ppi;
     SSEFunc_0_eppt sse_fn_eppt;
+    SSEGenFunc_lane sse_fn_lane;
     TCGMemOp ot;
 
     b &= 0xff;
@@ -4390,6 +4501,11 @@ static void gen_sse(CPUX86State *env, DisasContext *s, int b,
             sse_fn_eppt(cpu_env, cpu_ptr0, cpu_ptr1, cpu_A0);
             break;
         default:
+            sse_fn_lane = sse_inline_lane_op(b);
+            if (sse_fn_lane) {
+                gen_sse_inline(sse_fn_lane, is_xmm, op1_offset, op2_offset);
+                break;
+            }
             tcg_gen_addi_ptr(cpu_ptr0, cpu_env, op1_offset);
             tcg_gen_addi_ptr(cpu_ptr1, cpu_env, op2_offset);
             sse_fn_epp(cpu_env, cpu_ptr0, cpu_ptr1);
@@ -6478,7 +6594,9 @@ static target_ulong disas_insn(CPUX86State *env, DisasContext *s,
             tcg_gen_movi_tl(cpu_T0, next_eip);
             gen_push_v(s, cpu_T0);
             gen_bnd_jmp(s);
-            gen_jmp(s, tval);
+            /* Not followed into a superblock: plugins such as
+               callstack_instr look for calls at the end of a block. */
+            gen_jmp_tb(s, tval, 0);
         }
         break;
     case 0x9a: /* lcall im */
@@ -8381,6 +8499,7 @@ void gen_intermediate_code(CPUX86State *env, TranslationBlock *tb)
     dc->cc_op_dirty = false;
     dc->cs_base = cs_base;
     dc->tb = tb;
+    dc->trace = (tb->cflags & CF_SUPERBLOCK) ? tcg_ctx.tb_ctx.trace : NULL;
     dc->popl_esp_hack = 0;
     /* select memory access functions */
     dc->mem_index = 0;
@@ -8449,15 +8568,26 @@ void gen_intermediate_code(CPUX86State *env, TranslationBlock *tb)
         max_insns = TCG_MAX_INSNS;
     }
 
-    if (rr_mode == RR_REPLAY) {
+    uint64_t rr_updated_instr_count = rr_get_guest_instr_count();
+
+    if (tiered_llvm_lifting) {
+        // Lift exactly the instructions the TCG version of this TB covers,
+        // whatever the replay position is now.
+        max_insns = tb->icount;
+    } else if (rr_mode == RR_REPLAY) {
         uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
         if (max_insns > until_interrupt) {
             max_insns = until_interrupt;
         }
+        // End the block before the next rr breakpoint or reverse-debugging
+        // stop, so that it can only fall on the first instruction.
+        uint64_t until_stop = cpu_rr_next_stop(cs, rr_updated_instr_count + 1)
+            - rr_updated_instr_count;
+        if (max_insns > until_stop) {
+            max_insns = until_stop;
+        }
     }
 
-    uint64_t rr_updated_instr_count = rr_get_guest_instr_count();
-
     /*
      * This function call emits a few instructions at the beginning of every
      * basic block checking for an exit request.  This probably won't affect
@@ -8468,20 +8598,33 @@ void gen_intermediate_code(CPUX86State *env, TranslationBlock *tb)
         tcg_gen_insn_start(pc_ptr, dc->cc_op);
         num_insns++;
 
-        // Check reverse-continue status and conditions
-        // potentially restoring to checkpoint
-        cpu_rcont_check_restore(cs, rr_updated_instr_count);
+        bool at_rr_stop = num_insns == 1 && !tiered_llvm_lifting && unlikely(
+            rr_updated_instr_count == cpu_rr_next_stop(cs, rr_updated_instr_count));
+        if (at_rr_stop) {
+            // Check reverse-continue status and conditions
+            // potentially restoring to checkpoint
+            cpu_rcont_check_restore(cs, rr_updated_instr_count);
+        }
 
         /* If RF is set, suppress an internally generated breakpoint.  */
-        if (unlikely(cpu_breakpoint_test(cs, pc_ptr,
-                                         tb->flags & HF_RF_MASK
-                                         ? BP_GDB : BP_ANY)) || 
-                unlikely(cpu_rr_breakpoint_test(cs, rr_updated_instr_count, 
-                                             tb->flags & HF_RF_MASK ? BP_GDB : BP_ANY))) {
+        bool pc_bp = unlikely(cpu_breakpoint_test(cs, pc_ptr,
+                                                  tb->flags & HF_RF_MASK
+                                                  ? BP_GDB : BP_ANY));
+        bool rr_bp = at_rr_stop &&
+            cpu_rr_breakpoint_test(cs, rr_updated_instr_count,
+                                   tb->flags & HF_RF_MASK ? BP_GDB : BP_ANY);
+        if (pc_bp || rr_bp) {
                 // If we're in reverse direction, don't gen a debug event. 
-                // Instead, record it so we can figure out the latest one
+                // Instead, record it so we can figure out the latest one.
+                // The block may be run again at other instruction counts,
+                // so pc breakpoint hits are recorded when executed.
                 if (unlikely(cs->reverse_flags & GDB_RCONT)) {
-                    cs->last_bp_hit_instr = rr_updated_instr_count;
+                    if (rr_bp) {
+                        cs->last_bp_hit_instr = rr_updated_instr_count;
+                    }
+                    if (pc_bp) {
+                        gen_helper_panda_rcont_bp_hit();
+                    }
                 } else if (cs->reverse_flags & GDB_RSTEP) {
                     if (rr_updated_instr_count >= cs->last_gdb_instr) {
                         fprintf(stderr, "GDB_RSTEP went too far");
@@ -8523,10 +8666,14 @@ generate_debug:
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
         // In LLVM mode we generate this more efficiently.
+        // Memory callbacks recover the precise PC from the host return
+        // address; storing it eagerly is only needed when asked for.
         if ((rr_mode != RR_OFF || panda_update_pc) && !generate_llvm) {
-            gen_op_update_panda_pc(pc_ptr);
             gen_op_update_rr_icount();
         }
+        if (panda_update_pc && !generate_llvm) {
+            gen_op_update_panda_pc(pc_ptr);
+        }
 #endif
 
         // PANDA: ask if anyone wants execution notification
@@ -37,6 +37,7 @@
 
 #ifdef CONFIG_SOFTMMU
 #include "panda/rr/rr_log.h"
+extern bool panda_update_pc;
 #endif
 
 #define CPU_SINGLE_STEP 0x1
@@ -7254,7 +7255,9 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
         max_insns = TCG_MAX_INSNS;
     }
 
-    if (rr_mode == RR_REPLAY) {
+    if (tiered_llvm_lifting) {
+        max_insns = tb->icount;
+    } else if (rr_mode == RR_REPLAY) {
         uint64_t until_interrupt = rr_num_instr_before_next_interrupt();
         if (max_insns > until_interrupt) {
             max_insns = until_interrupt;
@@ -7287,10 +7290,12 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
         // In LLVM mode we generate this more efficiently.
-        if (rr_mode != RR_OFF && !generate_llvm) {
-            gen_op_update_panda_pc(ctx.nip);
+        if ((rr_mode != RR_OFF || panda_update_pc) && !generate_llvm) {
             gen_op_update_rr_icount();
         }
+        if (panda_update_pc && !generate_llvm) {
+            gen_op_update_panda_pc(ctx.nip);
+        }
 #endif
 
         if (unlikely(need_byteswap(&ctx))) {
@@ -78,6 +78,9 @@
 
 #include "panda/rr/rr_log.h"
 #include "panda/callback_support.h"
+#include "panda/common.h"
+
+extern bool panda_update_pc;
 
 /* #define DEBUG_TB_INVALIDATE */
 /* #define DEBUG_TB_FLUSH */
@@ -181,9 +184,14 @@ static void page_table_config_init(void)
 #define assert_tb_locked() tcg_debug_assert(have_tb_lock)
 #define assert_tb_unlocked() tcg_debug_assert(!have_tb_lock)
 
+/* Whether tb_lock() also took PANDA's callback serialization lock, which
+ * ranks above tb_lock (see panda_cb_serialize_translate_begin).  */
+static __thread bool have_tb_panda_serial_lock;
+
 void tb_lock(void)
 {
     assert_tb_unlocked();
+    have_tb_panda_serial_lock = panda_cb_serialize_translate_begin();
     qemu_mutex_lock(&tcg_ctx.tb_ctx.tb_lock);
     have_tb_lock++;
 }
@@ -193,13 +201,29 @@ void tb_unlock(void)
     assert_tb_locked();
     have_tb_lock--;
     qemu_mutex_unlock(&tcg_ctx.tb_ctx.tb_lock);
+    panda_cb_serialize_end(have_tb_panda_serial_lock);
+    have_tb_panda_serial_lock = false;
 }
 
 void tb_lock_reset(void)
 {
     if (have_tb_lock) {
+        /* A translation we longjmp'd out of may have been following the
+           trace of tb_form_superblock, which lived on the stack. */
+        tcg_ctx.tb_ctx.trace = NULL;
+#ifdef CONFIG_LLVM
+        /* ... or lifting a TB for tiered mode, with the LLVM module
+           locked. */
+        if (tiered_llvm_lifting) {
+            tiered_llvm_lifting = 0;
+            generate_llvm = 0;
+            tcg_llvm_tier_unlock();
+        }
+#endif
         qemu_mutex_unlock(&tcg_ctx.tb_ctx.tb_lock);
         have_tb_lock = 0;
+        panda_cb_serialize_end(have_tb_panda_serial_lock);
+        have_tb_panda_serial_lock = false;
     }
 }
 
@@ -318,7 +342,9 @@ static int cpu_restore_state_from_tb(CPUState *cpu, TranslationBlock *tb,
 
 #if defined(CONFIG_LLVM)
     target_ulong guest_pc = cpu->panda_guest_pc;
-    if (execute_llvm) {
+    if (execute_llvm || (tiered_llvm && tb->llvm_tc_ptr
+                         && searched_pc >= (uintptr_t)tb->llvm_tc_ptr
+                         && searched_pc < (uintptr_t)tb->llvm_tc_end)) {
         assert(guest_pc >= tb->pc);
         assert(guest_pc < tb->pc + tb->size);
         for (i = 0; i < num_insns; ++i) {
@@ -403,6 +429,109 @@ bool cpu_restore_state(CPUState *cpu, uintptr_t retaddr)
     return r;
 }
 
+/* Precise guest PCs for PANDA, recovered on demand.
+ *
+ * Rather than storing panda_guest_pc before every guest instruction, the
+ * softmmu helpers that run PANDA memory callbacks look up the instruction
+ * their host return address belongs to in the TB's insn_start data, as
+ * cpu_restore_state does, but without touching any CPU state.  Host
+ * addresses only get reused after a tb_flush, so answers are cached per
+ * host address until the next flush; a memory access in a loop then costs a
+ * single cache probe.  Each vCPU has its own cache, so MTTCG threads never
+ * share entries.
+ */
+#define PANDA_PC_CACHE_BITS 10
+
+struct PandaPCCacheEntry {
+    uintptr_t host_pc;
+    target_ulong guest_pc;
+    unsigned flush_count;
+};
+
+static bool panda_pc_from_tb(TranslationBlock *tb, uintptr_t searched_pc,
+                             target_ulong *guest_pc)
+{
+    target_ulong data[TARGET_INSN_START_WORDS] = { tb->pc };
+    uintptr_t host_pc = (uintptr_t)tb->tc_ptr;
+    uint8_t *p = tb->tc_search;
+    int i, j;
+
+    searched_pc -= GETPC_ADJ;
+    if (searched_pc < host_pc) {
+        return false;
+    }
+    for (i = 0; i < tb->icount; ++i) {
+        for (j = 0; j < TARGET_INSN_START_WORDS; ++j) {
+            data[j] += decode_sleb128(&p);
+        }
+        host_pc += decode_sleb128(&p);
+        if (host_pc > searched_pc) {
+            *guest_pc = data[0];
+            return true;
+        }
+    }
+    return false;
+}
+
+void panda_update_guest_pc(CPUState *cpu, uintptr_t retaddr)
+{
+    unsigned flush_count = atomic_read(&tcg_ctx.tb_ctx.tb_flush_count);
+    unsigned h = (retaddr * 0x9e3779b9u) >> (32 - PANDA_PC_CACHE_BITS);
+    struct PandaPCCacheEntry *e;
+    TranslationBlock *tb;
+    target_ulong guest_pc;
+    bool found = false;
+    bool lock = !have_tb_lock;
+
+    /* Generated code keeps panda_guest_pc up to date itself when precise
+     * PCs were asked for, and in LLVM code, which is where any return
+     * address outside the TCG code buffer points (tiered TBs).  */
+    if (panda_update_pc || execute_llvm ||
+        (retaddr && (retaddr < (uintptr_t)tcg_ctx.code_gen_buffer ||
+                     retaddr >= (uintptr_t)tcg_ctx.code_gen_ptr))) {
+        return;
+    }
+    /* Helpers called from C have no return address to look up; report
+     * the PC the CPU state holds rather than whatever an earlier access
+     * left behind.  */
+    if (!retaddr) {
+        cpu->panda_guest_pc = panda_current_pc(cpu);
+        return;
+    }
+
+    if (unlikely(!cpu->panda_pc_cache)) {
+        cpu->panda_pc_cache = g_new0(struct PandaPCCacheEntry,
+                                     1 << PANDA_PC_CACHE_BITS);
+    }
+    h &= (1 << PANDA_PC_CACHE_BITS) - 1;
+    e = &cpu->panda_pc_cache[h];
+    if (e->host_pc == retaddr && e->flush_count == flush_count) {
+        cpu->panda_guest_pc = e->guest_pc;
+        return;
+    }
+
+    if (lock) {
+        tb_lock();
+    }
+    tb = tb_find_pc(retaddr);
+    if (tb) {
+        found = panda_pc_from_tb(tb, retaddr, &guest_pc);
+    }
+    if (lock) {
+        tb_unlock();
+    }
+    if (!found) {
+        cpu->panda_guest_pc = panda_current_pc(cpu);
+        return;
+    }
+    if (!(tb->cflags & CF_NOCACHE)) {
+        e->host_pc = retaddr;
+        e->guest_pc = guest_pc;
+        e->flush_count = flush_count;
+    }
+    cpu->panda_guest_pc = guest_pc;
+}
+
 void page_size_init(void)
 {
     /* NOTE: we can always suppose that qemu_host_page_size >=
@@ -878,6 +1007,8 @@ static TranslationBlock *tb_alloc(target_ulong pc)
     tb->pc = pc;
     tb->cflags = 0;
     tb->invalid = false;
+    tb->exit_count[0] = tb->exit_count[1] = 0;
+    tb->exit_pc[0] = tb->exit_pc[1] = -1;
 #ifdef CONFIG_LLVM
     tcg_llvm_tb_alloc(tb);
 #endif
@@ -970,6 +1101,9 @@ static void do_tb_flush(CPUState *cpu, run_on_cpu_data tb_flush_count)
 
 #if defined(CONFIG_LLVM)
     int i2;
+    if (tiered_llvm) {
+        tcg_llvm_tier_flush();
+    }
     for(i2 = 0; i2 < tcg_ctx.tb_ctx.nb_tbs; ++i2){
         tcg_llvm_tb_free(&tcg_ctx.tb_ctx.tbs[i2]);
     }
@@ -1301,6 +1435,72 @@ static void tb_link_page(TranslationBlock *tb, tb_page_addr_t phys_pc,
 #endif
 }
 
+#if defined(CONFIG_LLVM)
+/* Lift a hot TB to LLVM IR and queue it for optimization in the background.
+ * The guest code is translated again from scratch, covering the same
+ * tb->icount instructions as the TCG code whatever the replay position is
+ * now.  No host code is emitted; the TB keeps running its TCG code until
+ * the LLVM version is published.  If the background thread is busy with
+ * the LLVM module, the TB is counted again from zero and retried later,
+ * rather than holding up the vCPU for the length of a compile.
+ *
+ * Called with tb_lock held.
+ */
+void tb_tier_up(CPUState *cpu, TranslationBlock *tb)
+{
+    CPUArchState *env = cpu->env_ptr;
+    uint16_t size = tb->size, icount = tb->icount;
+
+    /* Superblocks can't be retranslated without the trace they were
+       formed from.  Plugins that instrument single instructions would see
+       the TB translated a second time, so hot code stays TCG for them. */
+    if (tb->llvm_function || (tb->cflags & CF_SUPERBLOCK)
+        || panda_has_insn_translate_callbacks()) {
+        return;
+    }
+    if (!tcg_llvm_tier_trylock()) {
+        atomic_set(&tb->llvm_exec_count, 0);
+        return;
+    }
+
+    /* The front ends leave the guest PC and instruction count updates to
+       the LLVM translator when generate_llvm is set.  Tiered mode excludes
+       the other LLVM modes, so it is otherwise clear. */
+    generate_llvm = 1;
+    tiered_llvm_lifting = 1;
+    tcg_func_start(&tcg_ctx);
+    tcg_ctx.cpu = cpu;
+    gen_intermediate_code(env, tb);
+    tcg_ctx.cpu = NULL;
+    tiered_llvm_lifting = 0;
+    generate_llvm = 0;
+
+    if (tb->size != size || tb->icount != icount) {
+        /* Only a breakpoint can end the block early, and inserting one
+           invalidates the TB anyway; keep running the TCG code. */
+        tb->size = size;
+        tb->icount = icount;
+        tcg_llvm_tier_unlock();
+        return;
+    }
+
+    tcg_optimize(&tcg_ctx);
+    tcg_llvm_tier_gen_code(tcg_llvm_ctx, &tcg_ctx, tb);
+}
+
+/* Reset the jumps chained to a TB whose LLVM code was just published, so
+ * that the TBs leading to it go back through the cpu loop, which runs the
+ * LLVM code.  tb_jmp_cache needs no update: it points at the TB, and
+ * cpu_tb_exec picks the LLVM code from there.
+ *
+ * Called with tb_lock held.
+ */
+void tb_tier_unchain(TranslationBlock *tb)
+{
+    tb_jmp_unlink(tb);
+}
+#endif
+
 /* Called with mmap_lock held for user mode emulation.  */
 TranslationBlock *tb_gen_code(CPUState *cpu,
                               target_ulong pc, target_ulong cs_base,
@@ -1348,6 +1548,7 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     tcg_func_start(&tcg_ctx);
 
     tcg_ctx.cpu = ENV_GET_CPU(env);
+    cpu->rr_translated_instr = rr_get_guest_instr_count();
     gen_intermediate_code(env, tb);
     tcg_ctx.cpu = NULL;
 
@@ -1758,7 +1959,9 @@ static TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
     }
 
 #ifdef CONFIG_LLVM
-    if (execute_llvm) {
+    if (execute_llvm || (tiered_llvm &&
+                         (tc_ptr < (uintptr_t)tcg_ctx.code_gen_buffer ||
+                          tc_ptr >= (uintptr_t)tcg_ctx.code_gen_ptr))) {
         /* first check last tb. optimization for coming from generated code. */
         tb = tcg_llvm_runtime.last_tb;
         if (tb && tb->llvm_function
@@ -1769,7 +1972,7 @@ static TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
         /* then do linear search. */
         for (m = 0; m < tcg_ctx.tb_ctx.nb_tbs; m++) {
             tb = &tcg_ctx.tb_ctx.tbs[m];
-            if (tb->llvm_function
+            if (tb->llvm_function && tb->llvm_tc_ptr
                     && tc_ptr >= (uintptr_t)tb->llvm_tc_ptr
                     && tc_ptr <  (uintptr_t)tb->llvm_tc_end) {
                 return tb;
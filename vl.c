@@ -154,6 +154,7 @@ void panda_set_os_name(char *os_name);
 extern void panda_callbacks_after_machine_init(void);
 
 extern void pandalog_cc_init_write(const char * fname); 
+extern void pandalog_cc_init_write_columnar(const char * fname);
 int pandalog = 0;
 int panda_in_main_loop = 0;
 extern bool panda_abort_requested;
@@ -167,12 +168,17 @@ struct TCGLLVMContext;
 extern struct TCGLLVMContext* tcg_llvm_ctx;
 extern int generate_llvm;
 extern int execute_llvm;
+extern int tiered_llvm;
+extern uint32_t tiered_llvm_threshold;
 extern const int has_llvm_engine;
 
 void tcg_llvm_initialize(void);
+void tcg_llvm_initialize_tiered(void);
 void tcg_llvm_destroy(void);
 #endif
 
+extern uint32_t superblock_threshold;
+
 #define MAX_VIRTIO_CONSOLES 1
 #define MAX_SCLP_CONSOLES 1
 
@@ -4200,16 +4206,43 @@ int main(int argc, char **argv, char **envp)
                 }
                 generate_llvm = 1;
                 break;
+            case QEMU_OPTION_tiered_llvm:
+                if (!has_llvm_engine) {
+                    fprintf(stderr, "Cannot execute un LLVM mode (S2E mode present or LLVM mode missing)\n");
+                    exit(1);
+                }
+                tiered_llvm_threshold = strtoul(optarg, NULL, 0);
+                if (tiered_llvm_threshold == 0) {
+                    fprintf(stderr, "-tiered-llvm: threshold must be a positive count\n");
+                    exit(1);
+                }
+                tiered_llvm = 1;
+                break;
 #endif
+            case QEMU_OPTION_superblocks:
+                superblock_threshold = strtoul(optarg, NULL, 0);
+                if (superblock_threshold == 0) {
+                    fprintf(stderr, "-superblocks: threshold must be a positive count\n");
+                    exit(1);
+                }
+                break;
             case QEMU_OPTION_replay:
                 display_type = DT_NONE;
                 replay_name = optarg;
                 break;
+            case QEMU_OPTION_replay_shared:
+                rr_replay_shared = 1;
+                break;
             case QEMU_OPTION_pandalog:
                 pandalog = 1;
                 pandalog_cc_init_write(optarg);
                 printf ("pandalogging to [%s]\n", optarg);
                 break;
+            case QEMU_OPTION_pandalog_columnar:
+                pandalog = 1;
+                pandalog_cc_init_write_columnar(optarg);
+                printf ("pandalogging (columnar) to [%s]\n", optarg);
+                break;
             case QEMU_OPTION_record_from:
                 record_name = optarg;
                 break;
@@ -4403,10 +4436,16 @@ int main(int argc, char **argv, char **envp)
     }
 
 #if defined(CONFIG_LLVM)
+    if (tiered_llvm && (generate_llvm || execute_llvm)) {
+        fprintf(stderr, "-tiered-llvm can't be combined with -llvm or -generate-llvm\n");
+        exit(1);
+    }
     if (generate_llvm || execute_llvm){
         if (tcg_llvm_ctx == NULL){
 	    tcg_llvm_initialize();
         }
+    } else if (tiered_llvm) {
+        tcg_llvm_initialize_tiered();
     }
 #endif
 
@@ -4680,6 +4719,21 @@ int main(int argc, char **argv, char **envp)
     }
 
     qemu_tcg_configure(accel_opts, &error_fatal);
+    if (qemu_tcg_mttcg_enabled() && (replay_name || record_name)) {
+        error_report("record/replay is not supported with multi-threaded TCG");
+        exit(1);
+    }
+#if defined(CONFIG_LLVM)
+    /* LLVM code (and the taint ops inlined into it) shares tcg_llvm_ctx and
+     * plugin state such as taint2's shadow memory across vCPUs.  Plugins
+     * that turned LLVM on in init_plugin are caught here too, since they
+     * were loaded above. */
+    if (qemu_tcg_mttcg_enabled() &&
+        (generate_llvm || execute_llvm || tiered_llvm)) {
+        error_report("LLVM modes are not supported with multi-threaded TCG");
+        exit(1);
+    }
+#endif
 
     if (default_net) {
         QemuOptsList *net = qemu_find_opts("net");
@@ -5044,7 +5098,7 @@ int main(int argc, char **argv, char **envp)
     qemu_chr_cleanup();
 
 #ifdef CONFIG_LLVM
-    if (generate_llvm || execute_llvm){
+    if (generate_llvm || execute_llvm || tiered_llvm){
         tcg_llvm_cleanup();
     }
 #endif